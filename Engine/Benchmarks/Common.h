@@ -0,0 +1,30 @@
+#ifndef ENGINE_BENCHMARKS_FILE_COMMON_H
+#define ENGINE_BENCHMARKS_FILE_COMMON_H
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <numeric>
+#include <random>
+#include <vector>
+
+inline void EntityCounts(benchmark::internal::Benchmark* Benchmark)
+{
+    Benchmark->Arg(1'000)->Arg(100'000)->Arg(1'000'000);
+}
+
+inline std::size_t GetCount(const benchmark::State& State)
+{
+    return static_cast<std::size_t>(State.range(0));
+}
+
+inline std::vector<std::size_t> GetShuffledIndices(const std::size_t Count)
+{
+    std::vector<std::size_t> Indices(Count);
+    std::iota(Indices.begin(), Indices.end(), std::size_t {});
+    std::ranges::shuffle(Indices, std::mt19937_64 { Count });
+    return Indices;
+}
+
+#endif // ENGINE_BENCHMARKS_FILE_COMMON_H
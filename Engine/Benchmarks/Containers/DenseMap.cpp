@@ -0,0 +1,140 @@
+#include "../Common.h"
+
+#include <benchmark/benchmark.h>
+#include <Containers/DenseMap/DenseMap.h>
+#include <Containers/DenseMap/SwissDenseMap.h>
+#include <Types/Types.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace
+{
+    using ChainedMapType = egg::Containers::DenseMap<std::uint64_t, std::uint64_t>;
+    using SwissMapType = egg::Containers::SwissDenseMap<std::uint64_t, std::uint64_t>;
+
+    std::vector<std::uint64_t> GetKeys(const std::size_t Count)
+    {
+        std::vector<std::uint64_t> Keys;
+        Keys.reserve(Count);
+
+        for (const std::size_t Index : GetShuffledIndices(Count))
+        {
+            Keys.push_back(Index * 0x9E3779B97F4A7C15ull);
+        }
+
+        return Keys;
+    }
+}
+
+template <typename MapType>
+static void DenseMapInsert(benchmark::State& State)
+{
+    const std::vector<std::uint64_t> Keys { GetKeys(GetCount(State)) };
+
+    for (auto _ : State)
+    {
+        MapType Map;
+
+        for (const std::uint64_t Key : Keys)
+        {
+            Map.TryEmplace(Key, Key);
+        }
+
+        benchmark::DoNotOptimize(Map);
+    }
+
+    State.SetItemsProcessed(State.iterations() * State.range(0));
+}
+
+template <typename MapType>
+static void DenseMapFind(benchmark::State& State)
+{
+    const std::vector<std::uint64_t> Keys { GetKeys(GetCount(State)) };
+    MapType Map;
+
+    for (const std::uint64_t Key : Keys)
+    {
+        Map.TryEmplace(Key, Key);
+    }
+
+    for (auto _ : State)
+    {
+        std::uint64_t Sum {};
+
+        for (const std::uint64_t Key : Keys)
+        {
+            Sum += Map.Find(Key)->second;
+        }
+
+        benchmark::DoNotOptimize(Sum);
+    }
+
+    State.SetItemsProcessed(State.iterations() * State.range(0));
+}
+
+template <typename MapType>
+static void DenseMapFindStrided(benchmark::State& State)
+{
+    std::vector<std::uint64_t> Keys;
+    MapType Map;
+
+    for (const std::size_t Index : GetShuffledIndices(static_cast<std::size_t>(State.range(0))))
+    {
+        Keys.push_back(static_cast<std::uint64_t>(Index) << 16u);
+        Map.TryEmplace(Keys.back(), Index);
+    }
+
+    for (auto _ : State)
+    {
+        std::uint64_t Sum {};
+
+        for (const std::uint64_t Key : Keys)
+        {
+            Sum += Map.Find(Key)->second;
+        }
+
+        benchmark::DoNotOptimize(Sum);
+    }
+
+    State.SetItemsProcessed(State.iterations() * State.range(0));
+}
+
+template <template <typename...> typename MapTemplate>
+static void DenseMapFindPoolID(benchmark::State& State)
+{
+    constexpr std::size_t PoolsCount { 64u };
+
+    MapTemplate<egg::Types::IDType, std::uint64_t> Map;
+    std::vector<egg::Types::IDType> Keys;
+
+    for (const std::size_t Index : GetShuffledIndices(PoolsCount))
+    {
+        Keys.push_back(static_cast<egg::Types::IDType>(Index * 0x9E3779B9u));
+        Map.TryEmplace(Keys.back(), Index);
+    }
+
+    for (auto _ : State)
+    {
+        std::uint64_t Sum {};
+
+        for (const egg::Types::IDType Key : Keys)
+        {
+            Sum += Map.Find(Key)->second;
+        }
+
+        benchmark::DoNotOptimize(Sum);
+    }
+
+    State.SetItemsProcessed(State.iterations() * static_cast<std::int64_t>(PoolsCount));
+}
+
+BENCHMARK(DenseMapInsert<ChainedMapType>)->Apply(EntityCounts)->Unit(benchmark::kMicrosecond);
+BENCHMARK(DenseMapInsert<SwissMapType>)->Apply(EntityCounts)->Unit(benchmark::kMicrosecond);
+BENCHMARK(DenseMapFind<ChainedMapType>)->Apply(EntityCounts)->Unit(benchmark::kMicrosecond);
+BENCHMARK(DenseMapFind<SwissMapType>)->Apply(EntityCounts)->Unit(benchmark::kMicrosecond);
+BENCHMARK(DenseMapFindStrided<ChainedMapType>)->Arg(1'000)->Unit(benchmark::kMicrosecond);
+BENCHMARK(DenseMapFindStrided<SwissMapType>)->Arg(1'000)->Unit(benchmark::kMicrosecond);
+BENCHMARK(DenseMapFindPoolID<egg::Containers::DenseMap>);
+BENCHMARK(DenseMapFindPoolID<egg::Containers::SwissDenseMap>);
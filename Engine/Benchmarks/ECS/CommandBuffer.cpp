@@ -0,0 +1,81 @@
+#include "../Common.h"
+
+#include <benchmark/benchmark.h>
+#include <ECS/Entity.h>
+#include <ECS/Registry.h>
+#include <ECS/CommandBuffer/CommandBuffer.h>
+
+#include <cstddef>
+#include <vector>
+
+namespace
+{
+    struct Position
+    {
+        float X;
+        float Y;
+        float Z;
+    };
+
+    struct Velocity
+    {
+        float X;
+        float Y;
+        float Z;
+    };
+
+    using EntityType = egg::ECS::Entity;
+    using RegistryType = egg::ECS::Registry<EntityType>;
+}
+
+static void RegistryEmplaceDirect(benchmark::State& State)
+{
+    RegistryType Registry;
+    std::vector<EntityType> Entities(GetCount(State));
+    Registry.Create(Entities.begin(), Entities.end());
+
+    for (auto _ : State)
+    {
+        for (const EntityType Entity : Entities)
+        {
+            Registry.Emplace<Position>(Entity, 0.f, 0.f, 0.f);
+            Registry.Emplace<Velocity>(Entity, 1.f, 1.f, 1.f);
+        }
+
+        State.PauseTiming();
+        Registry.ResetPoolFor<Position>();
+        Registry.ResetPoolFor<Velocity>();
+        State.ResumeTiming();
+    }
+
+    State.SetItemsProcessed(State.iterations() * State.range(0));
+}
+
+static void CommandBufferEmplaceFlush(benchmark::State& State)
+{
+    RegistryType Registry;
+    egg::ECS::CommandBuffer<RegistryType> Commands { Registry };
+    std::vector<EntityType> Entities(GetCount(State));
+    Registry.Create(Entities.begin(), Entities.end());
+
+    for (auto _ : State)
+    {
+        for (const EntityType Entity : Entities)
+        {
+            Commands.Emplace<Position>(Entity, 0.f, 0.f, 0.f);
+            Commands.Emplace<Velocity>(Entity, 1.f, 1.f, 1.f);
+        }
+
+        Commands.Flush();
+
+        State.PauseTiming();
+        Registry.ResetPoolFor<Position>();
+        Registry.ResetPoolFor<Velocity>();
+        State.ResumeTiming();
+    }
+
+    State.SetItemsProcessed(State.iterations() * State.range(0));
+}
+
+BENCHMARK(RegistryEmplaceDirect)->Apply(EntityCounts)->Unit(benchmark::kMicrosecond);
+BENCHMARK(CommandBufferEmplaceFlush)->Apply(EntityCounts)->Unit(benchmark::kMicrosecond);
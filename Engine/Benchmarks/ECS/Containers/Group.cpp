@@ -0,0 +1,118 @@
+#include "../../Common.h"
+
+#include <benchmark/benchmark.h>
+#include <ECS/Entity.h>
+#include <ECS/Registry.h>
+#include <ECS/Containers/Group/Group.h>
+#include <Jobs/JobPool/JobPool.h>
+
+#include <cmath>
+#include <cstddef>
+
+namespace
+{
+    struct Position
+    {
+        float X;
+        float Y;
+        float Z;
+    };
+
+    struct Velocity
+    {
+        float X;
+        float Y;
+        float Z;
+    };
+
+    using RegistryType = egg::ECS::Registry<egg::ECS::Entity>;
+
+    void Populate(RegistryType& Registry, const std::size_t Count)
+    {
+        for (std::size_t i = 0u; i < Count; ++i)
+        {
+            const egg::ECS::Entity Entity { Registry.Create() };
+            Registry.GetPoolFor<Position>().Emplace(Entity, 0.f, 0.f, 0.f);
+            Registry.GetPoolFor<Velocity>().Emplace(Entity, 1.f, 2.f, 3.f);
+        }
+    }
+
+    constexpr auto Integrate { [](Position& Current, const Velocity& Speed)
+    {
+        Current.X += std::sqrt(Speed.X * Speed.X + Current.Y);
+        Current.Y += std::sqrt(Speed.Y * Speed.Y + Current.Z);
+        Current.Z += std::sqrt(Speed.Z * Speed.Z + Current.X);
+    } };
+
+    egg::Jobs::JobPool& GetPool()
+    {
+        static egg::Jobs::JobPool Pool {};
+        return Pool;
+    }
+}
+
+static void GroupEachOwned(benchmark::State& State)
+{
+    RegistryType Registry;
+    Populate(Registry, static_cast<std::size_t>(State.range(0)));
+    const auto Group { Registry.Group<Position, Velocity>() };
+
+    for (auto _ : State)
+    {
+        Group.Each(Integrate);
+        benchmark::ClobberMemory();
+    }
+
+    State.SetItemsProcessed(State.iterations() * State.range(0));
+}
+
+static void GroupParallelEachOwned(benchmark::State& State)
+{
+    RegistryType Registry;
+    Populate(Registry, static_cast<std::size_t>(State.range(0)));
+    const auto Group { Registry.Group<Position, Velocity>() };
+
+    for (auto _ : State)
+    {
+        Group.ParallelEach(Integrate, GetPool());
+        benchmark::ClobberMemory();
+    }
+
+    State.SetItemsProcessed(State.iterations() * State.range(0));
+    State.counters["Concurrency"] = static_cast<double>(GetPool().GetConcurrency());
+}
+
+static void GroupEachNonOwned(benchmark::State& State)
+{
+    RegistryType Registry;
+    Populate(Registry, static_cast<std::size_t>(State.range(0)));
+    const auto Group { Registry.Group<>(egg::ECS::View<Position, const Velocity>) };
+
+    for (auto _ : State)
+    {
+        Group.Each(Integrate);
+        benchmark::ClobberMemory();
+    }
+
+    State.SetItemsProcessed(State.iterations() * State.range(0));
+}
+
+static void GroupParallelEachNonOwned(benchmark::State& State)
+{
+    RegistryType Registry;
+    Populate(Registry, static_cast<std::size_t>(State.range(0)));
+    const auto Group { Registry.Group<>(egg::ECS::View<Position, const Velocity>) };
+
+    for (auto _ : State)
+    {
+        Group.ParallelEach(Integrate, GetPool());
+        benchmark::ClobberMemory();
+    }
+
+    State.SetItemsProcessed(State.iterations() * State.range(0));
+}
+
+BENCHMARK(GroupEachOwned)->Apply(EntityCounts)->Unit(benchmark::kMicrosecond);
+BENCHMARK(GroupParallelEachOwned)->Apply(EntityCounts)->Unit(benchmark::kMicrosecond)->UseRealTime();
+BENCHMARK(GroupEachNonOwned)->Apply(EntityCounts)->Unit(benchmark::kMicrosecond);
+BENCHMARK(GroupParallelEachNonOwned)->Apply(EntityCounts)->Unit(benchmark::kMicrosecond)->UseRealTime();
@@ -0,0 +1,139 @@
+#include "../../Common.h"
+
+#include <benchmark/benchmark.h>
+#include <ECS/Entity.h>
+#include <ECS/Containers/Hierarchy/Hierarchy.h>
+#include <ECS/Containers/Storage/Storage.h>
+#include <ECS/Traits/EntityTraits.h>
+
+#include <cstddef>
+#include <random>
+#include <vector>
+
+namespace
+{
+    struct Transform
+    {
+        float LocalX;
+        float LocalY;
+        float LocalZ;
+        float LocalScale;
+        float WorldX;
+        float WorldY;
+        float WorldZ;
+        float WorldScale;
+    };
+
+    using EntityType = egg::ECS::Entity;
+    using EntityTraitsType = egg::ECS::EntityTraits<EntityType>;
+    using HierarchyType = egg::ECS::Containers::Hierarchy<EntityType>;
+    using StorageType = egg::ECS::Containers::Storage<Transform, EntityType>;
+
+    constexpr std::size_t RootsRatio { 100u };
+
+    void Combine(Transform& Current, const Transform* Parent)
+    {
+        if (!Parent)
+        {
+            Current.WorldX = Current.LocalX;
+            Current.WorldY = Current.LocalY;
+            Current.WorldZ = Current.LocalZ;
+            Current.WorldScale = Current.LocalScale;
+            return;
+        }
+
+        Current.WorldX = Parent->WorldX + Current.LocalX * Parent->WorldScale;
+        Current.WorldY = Parent->WorldY + Current.LocalY * Parent->WorldScale;
+        Current.WorldZ = Parent->WorldZ + Current.LocalZ * Parent->WorldScale;
+        Current.WorldScale = Parent->WorldScale * Current.LocalScale;
+    }
+
+    void PopulateScene(HierarchyType& Hierarchy, StorageType& Transforms, const std::size_t Count)
+    {
+        std::mt19937_64 Generator { Count };
+
+        for (const std::size_t Index : GetShuffledIndices(Count))
+        {
+            const EntityType Entity { EntityTraitsType::Construct(Index, {}) };
+            Transforms.Emplace(Entity, 1.f, 2.f, 3.f, 1.f, 0.f, 0.f, 0.f, 0.f);
+
+            const bool Root { Index < Count / RootsRatio + 1u };
+            Hierarchy.Attach(Entity, Root ? EntityTraitsType::Tombstone : EntityTraitsType::Construct(Generator() % Index, {}));
+        }
+    }
+}
+
+template <bool Arranged>
+static void HierarchyPropagate(benchmark::State& State)
+{
+    HierarchyType Hierarchy;
+    StorageType Transforms;
+    PopulateScene(Hierarchy, Transforms, GetCount(State));
+
+    if constexpr (Arranged)
+    {
+        Hierarchy.Arrange(Transforms);
+    }
+
+    std::vector<EntityType> Stack;
+
+    for (auto _ : State)
+    {
+        if constexpr (Arranged)
+        {
+            Hierarchy.Propagate(Transforms, &Combine);
+        }
+        else
+        {
+            for (auto [Entity, Node] : Hierarchy.Each())
+            {
+                if (Node.Parent != EntityTraitsType::Tombstone) continue;
+
+                Combine(Transforms.Get(Entity), nullptr);
+                Stack.push_back(Entity);
+
+                while (!Stack.empty())
+                {
+                    const EntityType Parent { Stack.back() };
+                    Stack.pop_back();
+
+                    for (EntityType Child { Hierarchy.Get(Parent).FirstChild };
+                         Child != EntityTraitsType::Tombstone;
+                         Child = Hierarchy.Get(Child).NextSibling)
+                    {
+                        Combine(Transforms.Get(Child), &Transforms.Get(Parent));
+                        Stack.push_back(Child);
+                    }
+                }
+            }
+        }
+
+        benchmark::DoNotOptimize(Transforms.Get(EntityTraitsType::Construct(GetCount(State) - 1u, {})));
+    }
+
+    State.SetItemsProcessed(State.iterations() * State.range(0));
+}
+
+static void HierarchyArrange(benchmark::State& State)
+{
+    HierarchyType Hierarchy;
+    StorageType Transforms;
+
+    for (auto _ : State)
+    {
+        State.PauseTiming();
+        Hierarchy.Clear();
+        Transforms.Clear();
+        PopulateScene(Hierarchy, Transforms, GetCount(State));
+        State.ResumeTiming();
+
+        Hierarchy.Arrange(Transforms);
+        benchmark::DoNotOptimize(Hierarchy.IsArranged());
+    }
+
+    State.SetItemsProcessed(State.iterations() * State.range(0));
+}
+
+BENCHMARK(HierarchyPropagate<false>)->Arg(200'000)->Unit(benchmark::kMicrosecond);
+BENCHMARK(HierarchyPropagate<true>)->Arg(200'000)->Unit(benchmark::kMicrosecond);
+BENCHMARK(HierarchyArrange)->Arg(200'000)->Unit(benchmark::kMicrosecond);
@@ -0,0 +1,114 @@
+#include "../../Common.h"
+
+#include <benchmark/benchmark.h>
+#include <ECS/Entity.h>
+#include <ECS/Containers/SparseSet/SparseSet.h>
+#include <ECS/Traits/EntityTraits.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <span>
+#include <vector>
+
+namespace
+{
+    using EntityType = egg::ECS::Entity;
+    using EntityTraitsType = egg::ECS::EntityTraits<EntityType>;
+    using SparseSetType = egg::ECS::Containers::SparseSet<EntityType>;
+
+    std::vector<EntityType> GetShuffledEntities(const std::size_t Count)
+    {
+        std::vector<EntityType> Entities;
+        Entities.reserve(Count);
+
+        for (const std::size_t Index : GetShuffledIndices(Count))
+        {
+            Entities.push_back(EntityTraitsType::Construct(Index, {}));
+        }
+
+        return Entities;
+    }
+}
+
+static void SparseSetPush(benchmark::State& State)
+{
+    const std::vector<EntityType> Entities { GetShuffledEntities(GetCount(State)) };
+    SparseSetType Set;
+
+    for (auto _ : State)
+    {
+        for (const EntityType Entity : Entities)
+        {
+            Set.Push(Entity);
+        }
+
+        State.PauseTiming();
+        Set.Clear();
+        State.ResumeTiming();
+    }
+
+    State.SetItemsProcessed(State.iterations() * State.range(0));
+}
+
+static void SparseSetSort(benchmark::State& State)
+{
+    const std::vector<EntityType> Entities { GetShuffledEntities(GetCount(State)) };
+    SparseSetType Set;
+
+    for (auto _ : State)
+    {
+        State.PauseTiming();
+        Set.Clear();
+        for (const EntityType Entity : Entities)
+        {
+            Set.Push(Entity);
+        }
+        State.ResumeTiming();
+
+        Set.Sort(std::less {});
+        benchmark::DoNotOptimize(Set.GetEntityData());
+    }
+
+    State.SetItemsProcessed(State.iterations() * State.range(0));
+}
+
+template <bool Batched>
+static void SparseSetContains(benchmark::State& State)
+{
+    const std::vector<EntityType> Entities { GetShuffledEntities(GetCount(State)) };
+    std::vector<std::uint64_t> Mask((Entities.size() + 63u) / 64u);
+    SparseSetType Set;
+
+    for (std::size_t i = 0u; i < Entities.size(); i += 2u)
+    {
+        Set.Push(Entities[i]);
+    }
+
+    for (auto _ : State)
+    {
+        if constexpr (Batched)
+        {
+            Set.ContainsMany(Entities, Mask);
+        }
+        else
+        {
+            std::ranges::fill(Mask, std::uint64_t {});
+
+            for (std::size_t i = 0u; i < Entities.size(); ++i)
+            {
+                Mask[i / 64u] |= std::uint64_t { Set.Contains(Entities[i]) } << i % 64u;
+            }
+        }
+
+        benchmark::DoNotOptimize(Mask.data());
+    }
+
+    State.SetItemsProcessed(State.iterations() * State.range(0));
+}
+
+BENCHMARK(SparseSetPush)->Apply(EntityCounts)->Unit(benchmark::kMicrosecond);
+BENCHMARK(SparseSetSort)->Apply(EntityCounts)->Unit(benchmark::kMicrosecond);
+BENCHMARK(SparseSetContains<false>)->Apply(EntityCounts)->Unit(benchmark::kMicrosecond);
+BENCHMARK(SparseSetContains<true>)->Apply(EntityCounts)->Unit(benchmark::kMicrosecond);
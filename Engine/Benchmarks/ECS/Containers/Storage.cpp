@@ -0,0 +1,292 @@
+#include "../../Common.h"
+
+#include <benchmark/benchmark.h>
+#include <Containers/Algorithms/RadixSort.h>
+#include <ECS/Entity.h>
+#include <ECS/Containers/Storage/Storage.h>
+#include <ECS/Traits/EntityTraits.h>
+#include <Jobs/JobPool/JobPool.h>
+#include <Memory/PagePool/PagePoolAllocator.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <random>
+#include <vector>
+
+namespace
+{
+    struct Position
+    {
+        float X;
+        float Y;
+        float Z;
+    };
+
+    struct DrawKey
+    {
+        std::uint64_t Value;
+        float Depth;
+    };
+
+    struct Body
+    {
+        float Values[16];
+    };
+
+    struct StableBody
+    {
+        float Values[16];
+
+        static constexpr bool InPlaceDelete { true };
+    };
+
+    using EntityType = egg::ECS::Entity;
+    using EntityTraitsType = egg::ECS::EntityTraits<EntityType>;
+    using StorageType = egg::ECS::Containers::Storage<Position, EntityType>;
+
+    template <typename Type>
+    void Populate(Type& Pool, const std::size_t Count)
+    {
+        for (std::size_t i = 0u; i < Count; ++i)
+        {
+            Pool.Emplace(EntityTraitsType::Construct(i, {}), 0.f, 0.f, 0.f);
+        }
+    }
+}
+
+static void StorageEmplace(benchmark::State& State)
+{
+    StorageType Pool;
+
+    for (auto _ : State)
+    {
+        Populate(Pool, GetCount(State));
+
+        State.PauseTiming();
+        Pool.Clear();
+        State.ResumeTiming();
+    }
+
+    State.SetItemsProcessed(State.iterations() * State.range(0));
+}
+
+static void StorageErase(benchmark::State& State)
+{
+    const std::vector<std::size_t> Indices { GetShuffledIndices(GetCount(State)) };
+    StorageType Pool;
+
+    for (auto _ : State)
+    {
+        State.PauseTiming();
+        Populate(Pool, Indices.size());
+        State.ResumeTiming();
+
+        for (const std::size_t Index : Indices)
+        {
+            Pool.Erase(EntityTraitsType::Construct(Index, {}));
+        }
+    }
+
+    State.SetItemsProcessed(State.iterations() * State.range(0));
+}
+
+template <typename Type>
+static void StorageEraseIterate(benchmark::State& State)
+{
+    const std::vector<std::size_t> Indices { GetShuffledIndices(GetCount(State)) };
+    egg::ECS::Containers::Storage<Type, EntityType> Pool;
+
+    for (auto _ : State)
+    {
+        State.PauseTiming();
+        Pool.Clear();
+
+        for (const std::size_t Index : Indices)
+        {
+            Pool.Emplace(EntityTraitsType::Construct(Index, {}));
+        }
+
+        State.ResumeTiming();
+
+        for (std::size_t i = 0u; i < Indices.size() / 4u; ++i)
+        {
+            Pool.Erase(EntityTraitsType::Construct(Indices[i], {}));
+        }
+
+        float Sum {};
+
+        for (auto&& [Entity, Element] : Pool.Each())
+        {
+            Sum += Element.Values[0];
+        }
+
+        Pool.Compact();
+        benchmark::DoNotOptimize(Sum);
+    }
+
+    State.SetItemsProcessed(State.iterations() * State.range(0));
+}
+
+template <typename AllocatorType>
+static void StorageChurn(benchmark::State& State)
+{
+    egg::ECS::Containers::Storage<Position, EntityType, AllocatorType> Pool;
+
+    for (auto _ : State)
+    {
+        Populate(Pool, GetCount(State));
+        Pool.Clear();
+        Pool.ShrinkToFit();
+    }
+
+    State.SetItemsProcessed(State.iterations() * State.range(0));
+}
+
+template <egg::Memory::PagePool::Backing Mode>
+static void StorageIteratePagePool(benchmark::State& State)
+{
+    using AllocatorType = egg::Memory::PagePoolAllocator<Position>;
+
+    egg::Memory::PagePool Pages { Mode };
+    egg::ECS::Containers::Storage<Position, EntityType, AllocatorType> Pool { AllocatorType { Pages } };
+    Populate(Pool, GetCount(State));
+
+    for (auto _ : State)
+    {
+        float Sum {};
+
+        for (auto First = Pool.ElementsBegin(), Last = Pool.ElementsEnd(); First != Last; ++First)
+        {
+            Sum += First->X + First->Y + First->Z;
+        }
+
+        benchmark::DoNotOptimize(Sum);
+    }
+
+    State.SetItemsProcessed(State.iterations() * State.range(0));
+}
+
+template <typename SortType>
+static void StorageSortByKey(benchmark::State& State)
+{
+    egg::ECS::Containers::Storage<DrawKey, EntityType> Pool;
+    std::mt19937_64 Generator { GetCount(State) };
+
+    for (std::size_t i = 0u, Count = GetCount(State); i < Count; ++i)
+    {
+        Pool.Emplace(EntityTraitsType::Construct(i, {}), 0u, 0.f);
+    }
+
+    const auto Projection { [&Pool](const EntityType Entity) { return Pool.Get(Entity).Value; } };
+
+    for (auto _ : State)
+    {
+        State.PauseTiming();
+        for (DrawKey& Key : Pool.Elements())
+        {
+            Key.Value = Generator();
+        }
+        State.ResumeTiming();
+
+        Pool.Sort(std::ranges::less {}, SortType {}, Projection);
+        benchmark::DoNotOptimize(Pool.GetEntityData());
+    }
+
+    State.SetItemsProcessed(State.iterations() * State.range(0));
+}
+
+template <bool Incremental>
+static void StorageSortNearlySorted(benchmark::State& State)
+{
+    egg::ECS::Containers::Storage<DrawKey, EntityType> Pool;
+    std::mt19937_64 Generator { GetCount(State) };
+    std::uniform_real_distribution<float> Jitter { -4.f, 4.f };
+
+    for (std::size_t i = 0u, Count = GetCount(State); i < Count; ++i)
+    {
+        Pool.Emplace(EntityTraitsType::Construct(i, {}), 0u, static_cast<float>(Generator() % Count));
+    }
+
+    const auto Projection { [&Pool](const EntityType Entity) { return Pool.Get(Entity).Depth; } };
+    Pool.Sort(std::ranges::less {}, std::ranges::sort, Projection);
+
+    for (auto _ : State)
+    {
+        State.PauseTiming();
+        for (std::size_t i = 0u, Count = GetCount(State); i < Count / 100u; ++i)
+        {
+            Pool.Get(Pool[Generator() % Count]).Depth += Jitter(Generator);
+        }
+        State.ResumeTiming();
+
+        if constexpr (Incremental)
+        {
+            Pool.SortIncremental(std::ranges::less {}, Projection);
+        }
+        else
+        {
+            Pool.Sort(std::ranges::less {}, std::ranges::sort, Projection);
+        }
+
+        benchmark::DoNotOptimize(Pool.GetEntityData());
+    }
+
+    State.SetItemsProcessed(State.iterations() * State.range(0));
+}
+
+template <bool Parallel>
+static void StorageSortParallel(benchmark::State& State)
+{
+    egg::Jobs::JobPool Pool {};
+    egg::ECS::Containers::Storage<DrawKey, EntityType> Keys;
+    std::mt19937_64 Generator { GetCount(State) };
+
+    for (std::size_t i = 0u, Count = GetCount(State); i < Count; ++i)
+    {
+        Keys.Emplace(EntityTraitsType::Construct(i, {}), 0u, 0.f);
+    }
+
+    const auto Projection { [&Keys](const EntityType Entity) { return Keys.Get(Entity).Value; } };
+
+    for (auto _ : State)
+    {
+        State.PauseTiming();
+        for (DrawKey& Key : Keys.Elements())
+        {
+            Key.Value = Generator();
+        }
+        State.ResumeTiming();
+
+        if constexpr (Parallel)
+        {
+            Keys.ParallelSort(std::ranges::less {}, Pool, Projection);
+        }
+        else
+        {
+            Keys.Sort(std::ranges::less {}, std::ranges::sort, Projection);
+        }
+
+        benchmark::DoNotOptimize(Keys.GetEntityData());
+    }
+
+    State.SetItemsProcessed(State.iterations() * State.range(0));
+    State.counters["Concurrency"] = static_cast<double>(Pool.GetConcurrency());
+}
+
+BENCHMARK(StorageEmplace)->Apply(EntityCounts)->Unit(benchmark::kMicrosecond);
+BENCHMARK(StorageErase)->Apply(EntityCounts)->Unit(benchmark::kMicrosecond);
+BENCHMARK(StorageEraseIterate<Body>)->Apply(EntityCounts)->Unit(benchmark::kMicrosecond);
+BENCHMARK(StorageEraseIterate<StableBody>)->Apply(EntityCounts)->Unit(benchmark::kMicrosecond);
+BENCHMARK(StorageChurn<std::allocator<Position>>)->Apply(EntityCounts)->Unit(benchmark::kMicrosecond);
+BENCHMARK(StorageChurn<egg::Memory::PagePoolAllocator<Position>>)->Apply(EntityCounts)->Unit(benchmark::kMicrosecond);
+BENCHMARK(StorageIteratePagePool<egg::Memory::PagePool::Backing::Regular>)->Arg(1'000'000)->Unit(benchmark::kMicrosecond);
+BENCHMARK(StorageIteratePagePool<egg::Memory::PagePool::Backing::Huge>)->Arg(1'000'000)->Unit(benchmark::kMicrosecond);
+BENCHMARK(StorageSortByKey<decltype(std::ranges::sort)>)->Apply(EntityCounts)->Unit(benchmark::kMicrosecond);
+BENCHMARK(StorageSortByKey<egg::Containers::RadixSortType>)->Apply(EntityCounts)->Unit(benchmark::kMicrosecond);
+BENCHMARK(StorageSortNearlySorted<false>)->Apply(EntityCounts)->Unit(benchmark::kMicrosecond);
+BENCHMARK(StorageSortNearlySorted<true>)->Apply(EntityCounts)->Unit(benchmark::kMicrosecond);
+BENCHMARK(StorageSortParallel<false>)->Apply(EntityCounts)->Unit(benchmark::kMicrosecond)->UseRealTime();
+BENCHMARK(StorageSortParallel<true>)->Apply(EntityCounts)->Unit(benchmark::kMicrosecond)->UseRealTime();
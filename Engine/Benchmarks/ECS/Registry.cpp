@@ -0,0 +1,288 @@
+#include "../Common.h"
+
+#include <benchmark/benchmark.h>
+#include <ECS/ArchetypeRegistry.h>
+#include <ECS/Entity.h>
+#include <ECS/Registry.h>
+#include <Memory/FrameArena/ArenaAllocator.h>
+#include <Memory/FrameArena/FrameArena.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+namespace
+{
+    struct Position
+    {
+        float X;
+        float Y;
+        float Z;
+    };
+
+    struct Velocity
+    {
+        float X;
+        float Y;
+        float Z;
+    };
+
+    struct Health
+    {
+        int Value;
+    };
+
+    struct Replicated
+    {
+        float X;
+        static constexpr bool TrackChanges { true };
+    };
+
+    using EntityType = egg::ECS::Entity;
+
+    template <typename RegistryType>
+    void Populate(RegistryType& Registry, const std::size_t Count)
+    {
+        for (std::size_t i = 0u; i < Count; ++i)
+        {
+            const EntityType Entity { Registry.Create() };
+            Registry.template Emplace<Position>(Entity, 0.f, 0.f, 0.f);
+
+            if (i % 2u)
+            {
+                Registry.template Emplace<Velocity>(Entity, 1.f, 2.f, 3.f);
+            }
+
+            if (i % 3u)
+            {
+                Registry.template Emplace<Health>(Entity, 100);
+            }
+        }
+    }
+}
+
+static void RegistryCreate(benchmark::State& State)
+{
+    for (auto _ : State)
+    {
+        egg::ECS::Registry<EntityType> Registry;
+
+        for (std::size_t i = 0u, Count = GetCount(State); i < Count; ++i)
+        {
+            benchmark::DoNotOptimize(Registry.Create());
+        }
+    }
+
+    State.SetItemsProcessed(State.iterations() * State.range(0));
+}
+
+template <typename RegistryType>
+static void RegistryCreateEmplace(benchmark::State& State)
+{
+    for (auto _ : State)
+    {
+        RegistryType Registry;
+        Populate(Registry, static_cast<std::size_t>(State.range(0)));
+        benchmark::DoNotOptimize(Registry);
+    }
+
+    State.SetItemsProcessed(State.iterations() * State.range(0));
+}
+
+static void RegistryCreateEmplaceArena(benchmark::State& State)
+{
+    using AllocatorType = egg::Memory::ArenaAllocator<EntityType>;
+
+    egg::Memory::FrameArena Arena;
+
+    for (auto _ : State)
+    {
+        {
+            egg::ECS::Registry<EntityType, AllocatorType> Registry { AllocatorType { Arena } };
+            Populate(Registry, static_cast<std::size_t>(State.range(0)));
+            benchmark::DoNotOptimize(Registry);
+        }
+
+        Arena.Reset();
+    }
+
+    State.SetItemsProcessed(State.iterations() * State.range(0));
+    State.counters["ArenaBytes"] = static_cast<double>(Arena.GetCapacity());
+}
+
+template <typename RegistryType>
+static void RegistryIterateTwo(benchmark::State& State)
+{
+    RegistryType Registry;
+    Populate(Registry, static_cast<std::size_t>(State.range(0)));
+    const auto Group { Registry.template Group<>(egg::ECS::View<Position, const Velocity>) };
+
+    for (auto _ : State)
+    {
+        Group.Each([](Position& Current, const Velocity& Speed)
+        {
+            Current.X += Speed.X;
+            Current.Y += Speed.Y;
+            Current.Z += Speed.Z;
+        });
+        benchmark::ClobberMemory();
+    }
+
+    State.SetItemsProcessed(State.iterations() * static_cast<std::int64_t>(Group.GetSize()));
+}
+
+template <typename RegistryType>
+static void RegistryIterateThree(benchmark::State& State)
+{
+    RegistryType Registry;
+    Populate(Registry, static_cast<std::size_t>(State.range(0)));
+    const auto Group { Registry.template Group<>(egg::ECS::View<Position, const Velocity, Health>) };
+
+    for (auto _ : State)
+    {
+        Group.Each([](Position& Current, const Velocity& Speed, Health& Points)
+        {
+            Current.X += Speed.X;
+            Points.Value -= 1;
+        });
+        benchmark::ClobberMemory();
+    }
+
+    State.SetItemsProcessed(State.iterations() * static_cast<std::int64_t>(Group.GetSize()));
+}
+
+template <bool Filtered>
+static void RegistryIterateChanged(benchmark::State& State)
+{
+    egg::ECS::Registry<EntityType> Registry;
+    Populate(Registry, GetCount(State));
+
+    std::vector<EntityType> Entities(Registry.template GetPoolFor<Position>().Begin(), Registry.template GetPoolFor<Position>().End());
+
+    for (const EntityType Entity : Entities)
+    {
+        Registry.Emplace<Replicated>(Entity, 0.f);
+    }
+
+    const std::vector<std::size_t> Indices { GetShuffledIndices(Entities.size()) };
+    const std::size_t Touched { Entities.size() / 20u };
+    const auto View { Registry.View<const Replicated, const Position>() };
+
+    for (auto _ : State)
+    {
+        const egg::ECS::ChangeTick Since { Registry.GetChangeTick() };
+        Registry.AdvanceChangeTick();
+
+        for (std::size_t i = 0u; i < Touched; ++i)
+        {
+            Registry.Patch<Replicated>(Entities[Indices[i]], [](Replicated& Current) { Current.X += 1.f; });
+        }
+
+        float Sum {};
+        const auto Replicate { [&Sum](const Replicated& Current, const Position& Where) { Sum += Current.X + Where.X; } };
+
+        if constexpr (Filtered)
+        {
+            View.Each(egg::ECS::Changed<const Replicated>, Since, Replicate);
+        }
+        else
+        {
+            View.Each(Replicate);
+        }
+
+        benchmark::DoNotOptimize(Sum);
+    }
+
+    State.SetItemsProcessed(State.iterations() * State.range(0));
+    State.counters["Touched"] = static_cast<double>(Touched);
+}
+
+static void RegistryCreateDestroySingle(benchmark::State& State)
+{
+    egg::ECS::Registry<EntityType> Registry;
+    std::vector<EntityType> Entities(static_cast<std::size_t>(State.range(0)));
+
+    for (auto _ : State)
+    {
+        for (EntityType& Entity : Entities)
+        {
+            Entity = Registry.Create();
+            Registry.Emplace<Position>(Entity, 0.f, 0.f, 0.f);
+        }
+
+        for (const EntityType Entity : Entities)
+        {
+            Registry.Destroy(Entity);
+        }
+    }
+
+    State.SetItemsProcessed(State.iterations() * State.range(0));
+}
+
+static void RegistryCreateDestroyBulk(benchmark::State& State)
+{
+    egg::ECS::Registry<EntityType> Registry;
+    std::vector<EntityType> Entities(static_cast<std::size_t>(State.range(0)));
+
+    for (auto _ : State)
+    {
+        Registry.Create(Entities.begin(), Entities.end());
+
+        for (const EntityType Entity : Entities)
+        {
+            Registry.Emplace<Position>(Entity, 0.f, 0.f, 0.f);
+        }
+
+        Registry.Destroy(Entities.begin(), Entities.end());
+    }
+
+    State.SetItemsProcessed(State.iterations() * State.range(0));
+}
+
+template <bool Bulk>
+static void RegistryDestroyManyPools(benchmark::State& State)
+{
+    egg::ECS::Registry<EntityType> Registry;
+    std::vector<EntityType> Entities(static_cast<std::size_t>(State.range(0)));
+
+    for (auto _ : State)
+    {
+        State.PauseTiming();
+        Populate(Registry, Entities.size());
+        const auto& Pool { Registry.GetPoolFor<Position>() };
+        std::copy(Pool.Begin(), Pool.End(), Entities.begin());
+        State.ResumeTiming();
+
+        if constexpr (Bulk)
+        {
+            Registry.Destroy(Entities.begin(), Entities.end());
+        }
+        else
+        {
+            for (const EntityType Entity : Entities)
+            {
+                Registry.Destroy(Entity);
+            }
+        }
+    }
+
+    State.SetItemsProcessed(State.iterations() * State.range(0));
+}
+
+using SparseSetRegistry = egg::ECS::Registry<EntityType>;
+using TableRegistry = egg::ECS::ArchetypeRegistry<EntityType>;
+
+BENCHMARK(RegistryCreate)->Apply(EntityCounts)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(RegistryCreateEmplace, SparseSetRegistry)->Apply(EntityCounts)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(RegistryCreateEmplace, TableRegistry)->Apply(EntityCounts)->Unit(benchmark::kMicrosecond);
+BENCHMARK(RegistryCreateEmplaceArena)->Apply(EntityCounts)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(RegistryIterateTwo, SparseSetRegistry)->Apply(EntityCounts)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(RegistryIterateTwo, TableRegistry)->Apply(EntityCounts)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(RegistryIterateThree, SparseSetRegistry)->Apply(EntityCounts)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(RegistryIterateThree, TableRegistry)->Apply(EntityCounts)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(RegistryIterateChanged, false)->Apply(EntityCounts)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(RegistryIterateChanged, true)->Apply(EntityCounts)->Unit(benchmark::kMicrosecond);
+BENCHMARK(RegistryCreateDestroySingle)->Apply(EntityCounts)->Unit(benchmark::kMicrosecond);
+BENCHMARK(RegistryCreateDestroyBulk)->Apply(EntityCounts)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(RegistryDestroyManyPools, false)->Apply(EntityCounts)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(RegistryDestroyManyPools, true)->Apply(EntityCounts)->Unit(benchmark::kMicrosecond);
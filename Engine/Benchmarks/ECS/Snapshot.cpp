@@ -0,0 +1,116 @@
+#include "../Common.h"
+
+#include <benchmark/benchmark.h>
+#include <ECS/Entity.h>
+#include <ECS/Registry.h>
+#include <ECS/Snapshot/Archive.h>
+#include <ECS/Snapshot/Cooker.h>
+#include <ECS/Snapshot/MappedLoader.h>
+#include <ECS/Snapshot/Snapshot.h>
+#include <ECS/Snapshot/SnapshotLoader.h>
+#include <Memory/MappedFile/MappedFile.h>
+
+#include <cstddef>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <vector>
+
+namespace
+{
+    struct Position
+    {
+        float X;
+        float Y;
+        float Z;
+    };
+
+    struct Velocity
+    {
+        float X;
+        float Y;
+        float Z;
+    };
+
+    using EntityType = egg::ECS::Entity;
+    using RegistryType = egg::ECS::Registry<EntityType>;
+
+    void Populate(RegistryType& Registry, const std::size_t Count)
+    {
+        std::vector<EntityType> Entities(Count);
+        Registry.Create(Entities.begin(), Entities.end());
+
+        for (const EntityType Entity : Entities)
+        {
+            Registry.Emplace<Position>(Entity, 0.f, 0.f, 0.f);
+            Registry.Emplace<Velocity>(Entity, 1.f, 1.f, 1.f);
+        }
+    }
+}
+
+static void SnapshotSave(benchmark::State& State)
+{
+    RegistryType Registry;
+    Populate(Registry, GetCount(State));
+
+    egg::ECS::MemoryOutputArchive Output;
+
+    for (auto _ : State)
+    {
+        Output.Clear();
+        egg::ECS::Snapshot { Registry }.Entities(Output).Elements<Position, Velocity>(Output);
+        benchmark::DoNotOptimize(Output.GetData().data());
+    }
+
+    State.SetBytesProcessed(State.iterations() * static_cast<std::int64_t>(Output.GetData().size()));
+}
+
+static void SnapshotLoad(benchmark::State& State)
+{
+    RegistryType Source;
+    Populate(Source, GetCount(State));
+
+    egg::ECS::MemoryOutputArchive Output;
+    egg::ECS::Snapshot { Source }.Entities(Output).Elements<Position, Velocity>(Output);
+
+    RegistryType Target;
+
+    for (auto _ : State)
+    {
+        egg::ECS::MemoryInputArchive Input { Output.GetData() };
+        egg::ECS::SnapshotLoader { Target }.Entities(Input).Elements<Position, Velocity>(Input);
+        benchmark::ClobberMemory();
+    }
+
+    State.SetBytesProcessed(State.iterations() * static_cast<std::int64_t>(Output.GetData().size()));
+}
+
+static void SnapshotLoadMapped(benchmark::State& State)
+{
+    const std::filesystem::path Path { std::filesystem::temp_directory_path() / "egg_bench_mapped.bin" };
+
+    {
+        RegistryType Source;
+        Populate(Source, GetCount(State));
+
+        std::ofstream Stream { Path, std::ios::binary };
+        egg::ECS::StreamOutputArchive Output { Stream };
+        egg::ECS::Cooker { Source }.Cook<Position, Velocity>(Output);
+    }
+
+    const auto File { std::make_shared<egg::Memory::MappedFile>(Path) };
+
+    for (auto _ : State)
+    {
+        RegistryType Target;
+        egg::ECS::MappedLoader { Target }.Load<Position, Velocity>(File);
+        benchmark::ClobberMemory();
+    }
+
+    State.SetItemsProcessed(State.iterations() * State.range(0));
+    std::filesystem::remove(Path);
+}
+
+BENCHMARK(SnapshotSave)->Apply(EntityCounts)->Unit(benchmark::kMicrosecond);
+BENCHMARK(SnapshotLoad)->Apply(EntityCounts)->Unit(benchmark::kMicrosecond);
+BENCHMARK(SnapshotLoadMapped)->Apply(EntityCounts)->Unit(benchmark::kMicrosecond);
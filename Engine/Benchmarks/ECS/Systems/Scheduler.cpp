@@ -0,0 +1,89 @@
+#include <benchmark/benchmark.h>
+#include <ECS/Systems/System.h>
+#include <ECS/Systems/Scheduler/Scheduler.h>
+#include <Jobs/JobPool/JobPool.h>
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace
+{
+    template <std::size_t Index>
+    struct Component
+    {
+    };
+
+    class EmptySystem final : public egg::Systems::System
+    {
+    public:
+        template <std::size_t Read, std::size_t Write>
+        static std::unique_ptr<EmptySystem> Make()
+        {
+            auto Result { std::make_unique<EmptySystem>() };
+            Result->Reads<Component<Read>>();
+            Result->Writes<Component<Write>>();
+            return Result;
+        }
+
+        void Initialize() override
+        {
+        }
+
+        void Update(float) override
+        {
+            benchmark::ClobberMemory();
+        }
+
+        void Terminate() override
+        {
+        }
+    };
+
+    template <std::size_t... Indices>
+    std::vector<std::unique_ptr<EmptySystem>> MakeSystems(std::index_sequence<Indices...>)
+    {
+        std::vector<std::unique_ptr<EmptySystem>> Result;
+        (Result.push_back(EmptySystem::Make<Indices % 7u, Indices % 11u>()), ...);
+        return Result;
+    }
+}
+
+static void SchedulerUpdate(benchmark::State& State)
+{
+    egg::Jobs::JobPool Pool {};
+    egg::Systems::Scheduler Scheduler { Pool };
+    const auto Systems { MakeSystems(std::make_index_sequence<100u> {}) };
+
+    for (const auto& Current : Systems)
+    {
+        Scheduler.Add(*Current);
+    }
+
+    Scheduler.Build();
+
+    for (auto _ : State)
+    {
+        Scheduler.Update(0.f);
+    }
+
+    State.SetItemsProcessed(State.iterations() * static_cast<std::int64_t>(Systems.size()));
+}
+
+static void SequentialUpdate(benchmark::State& State)
+{
+    const auto Systems { MakeSystems(std::make_index_sequence<100u> {}) };
+
+    for (auto _ : State)
+    {
+        for (const auto& Current : Systems)
+        {
+            Current->Update(0.f);
+        }
+    }
+
+    State.SetItemsProcessed(State.iterations() * static_cast<std::int64_t>(Systems.size()));
+}
+
+BENCHMARK(SchedulerUpdate)->Unit(benchmark::kMicrosecond)->UseRealTime();
+BENCHMARK(SequentialUpdate)->Unit(benchmark::kMicrosecond);
@@ -0,0 +1,298 @@
+#include "../Common.h"
+
+#include <benchmark/benchmark.h>
+#include <Events/EventLoop/EventLoop.h>
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    struct Message
+    {
+        std::size_t Producer;
+        std::size_t Value;
+    };
+
+    struct Listener
+    {
+        void Receive(const Message& Event)
+        {
+            Sum += Event.Value;
+        }
+
+        void ReceiveBatch(const std::span<const Message> Events)
+        {
+            for (const Message& Event : Events)
+            {
+                Sum += Event.Value;
+            }
+        }
+
+        std::size_t Sum;
+    };
+
+    class MutexQueue
+    {
+    public:
+        void Push(const Message& Event)
+        {
+            const std::scoped_lock Lock { Mutex };
+            Events.push_back(Event);
+        }
+
+        template <typename LoopType>
+        void Flush(LoopType& Loop)
+        {
+            {
+                const std::scoped_lock Lock { Mutex };
+                Events.swap(Swapped);
+            }
+
+            for (const Message& Event : Swapped)
+            {
+                Loop.Enqueue(Event);
+            }
+
+            Swapped.clear();
+            Loop.Publish();
+        }
+
+    private:
+        std::mutex Mutex;
+        std::vector<Message> Events;
+        std::vector<Message> Swapped;
+    };
+
+    std::size_t AllocationsCount {};
+    std::size_t MovesCount {};
+
+    struct FrameEvent
+    {
+        FrameEvent(const std::size_t Depth, const std::size_t Value) noexcept : Depth { Depth }, Value { Value }
+        {
+        }
+
+        FrameEvent(FrameEvent&& Other) noexcept : Depth { Other.Depth }, Value { Other.Value }
+        {
+            ++MovesCount;
+        }
+
+        FrameEvent& operator=(FrameEvent&& Other) noexcept
+        {
+            Depth = Other.Depth;
+            Value = Other.Value;
+            ++MovesCount;
+            return *this;
+        }
+
+        std::size_t Depth;
+        std::size_t Value;
+    };
+
+    template <typename Type>
+    struct CountingAllocator
+    {
+        using value_type = Type;
+
+        CountingAllocator() = default;
+
+        template <typename Other>
+        constexpr CountingAllocator(const CountingAllocator<Other>&) noexcept
+        {
+        }
+
+        [[nodiscard]] Type* allocate(const std::size_t Count)
+        {
+            ++AllocationsCount;
+            return std::allocator<Type> {}.allocate(Count);
+        }
+
+        void deallocate(Type* const Pointer, const std::size_t Count) noexcept
+        {
+            std::allocator<Type> {}.deallocate(Pointer, Count);
+        }
+
+        friend bool operator==(const CountingAllocator&, const CountingAllocator&) noexcept = default;
+    };
+
+    struct Echo
+    {
+        void Receive(const FrameEvent& Event)
+        {
+            Sum += Event.Value;
+
+            if (Event.Depth != 0u)
+            {
+                Loop->Enqueue(Event.Depth - 1u, Event.Value);
+            }
+        }
+
+        egg::Events::EventLoop<FrameEvent, CountingAllocator<FrameEvent>>* Loop;
+        std::size_t Sum;
+    };
+
+    constexpr std::size_t ListenersCount { 4u };
+    constexpr std::size_t ProducersCount { 8u };
+    constexpr std::size_t EchoDepth { 1u };
+
+    template <typename PushType, typename PublishType>
+    void RunProducers(const std::size_t Count, PushType Push, PublishType Publish)
+    {
+        std::atomic<std::size_t> Finished {};
+        std::vector<std::jthread> Producers;
+        Producers.reserve(ProducersCount);
+
+        for (std::size_t Producer = 0u; Producer < ProducersCount; ++Producer)
+        {
+            Producers.emplace_back([&, Producer]
+            {
+                for (std::size_t i = Producer; i < Count; i += ProducersCount)
+                {
+                    Push(Message { Producer, i });
+                }
+
+                Finished.fetch_add(1u, std::memory_order_release);
+            });
+        }
+
+        while (Finished.load(std::memory_order_acquire) != ProducersCount)
+        {
+            Publish();
+        }
+
+        Producers.clear();
+        Publish();
+    }
+}
+
+static void EventLoopEnqueueConcurrent(benchmark::State& State)
+{
+    egg::Events::EventLoop<Message> Loop;
+    Listener Target {};
+    Loop.GetSink().Connect<&Listener::Receive>(Target);
+
+    for (auto _ : State)
+    {
+        RunProducers(GetCount(State), [&Loop](const Message& Event)
+        {
+            Loop.EnqueueConcurrent(Event);
+        }, [&Loop]
+        {
+            Loop.Publish();
+        });
+
+        benchmark::DoNotOptimize(Target);
+    }
+
+    State.SetItemsProcessed(State.iterations() * State.range(0));
+    State.counters["Producers"] = static_cast<double>(ProducersCount);
+}
+
+static void EventLoopEnqueueMutex(benchmark::State& State)
+{
+    egg::Events::EventLoop<Message> Loop;
+    Listener Target {};
+    Loop.GetSink().Connect<&Listener::Receive>(Target);
+    MutexQueue Queue;
+
+    for (auto _ : State)
+    {
+        RunProducers(GetCount(State), [&Queue](const Message& Event)
+        {
+            Queue.Push(Event);
+        }, [&Queue, &Loop]
+        {
+            Queue.Flush(Loop);
+        });
+
+        benchmark::DoNotOptimize(Target);
+    }
+
+    State.SetItemsProcessed(State.iterations() * State.range(0));
+    State.counters["Producers"] = static_cast<double>(ProducersCount);
+}
+
+static void EventLoopPublishFrame(benchmark::State& State)
+{
+    egg::Events::EventLoop<FrameEvent, CountingAllocator<FrameEvent>> Loop;
+    Echo Target { &Loop, 0u };
+    Loop.GetSink().Connect<&Echo::Receive>(Target);
+
+    const std::size_t Count { GetCount(State) };
+    const auto Frame { [&Loop, Count]
+    {
+        for (std::size_t i = 0u; i < Count; ++i)
+        {
+            Loop.Enqueue(i % 2u ? EchoDepth : 0u, i);
+        }
+
+        Loop.Publish();
+    } };
+
+    Frame();
+    Frame();
+    AllocationsCount = 0u;
+    MovesCount = 0u;
+
+    for (auto _ : State)
+    {
+        Frame();
+        benchmark::DoNotOptimize(Target);
+    }
+
+    State.SetItemsProcessed(State.iterations() * State.range(0));
+    State.counters["Allocations"] = benchmark::Counter(
+        static_cast<double>(AllocationsCount), benchmark::Counter::kAvgIterations
+    );
+    State.counters["Moves"] = benchmark::Counter(static_cast<double>(MovesCount), benchmark::Counter::kAvgIterations);
+}
+
+template <bool Batched>
+static void EventLoopPublishListeners(benchmark::State& State)
+{
+    egg::Events::EventLoop<Message> Loop;
+    std::array<Listener, ListenersCount> Listeners {};
+
+    for (Listener& Current : Listeners)
+    {
+        if constexpr (Batched)
+        {
+            Loop.GetBatchSink().Connect<&Listener::ReceiveBatch>(Current);
+        }
+        else
+        {
+            Loop.GetSink().Connect<&Listener::Receive>(Current);
+        }
+    }
+
+    for (auto _ : State)
+    {
+        State.PauseTiming();
+
+        for (std::size_t i = 0u, Count = GetCount(State); i < Count; ++i)
+        {
+            Loop.Enqueue(0u, i);
+        }
+
+        State.ResumeTiming();
+
+        Loop.Publish();
+        benchmark::DoNotOptimize(Listeners);
+    }
+
+    State.SetItemsProcessed(State.iterations() * State.range(0));
+    State.counters["Listeners"] = static_cast<double>(ListenersCount);
+}
+
+BENCHMARK(EventLoopPublishListeners<false>)->Arg(50'000)->Unit(benchmark::kMicrosecond);
+BENCHMARK(EventLoopPublishListeners<true>)->Arg(50'000)->Unit(benchmark::kMicrosecond);
+BENCHMARK(EventLoopPublishFrame)->Arg(10'000)->Unit(benchmark::kMicrosecond);
+BENCHMARK(EventLoopEnqueueConcurrent)->Apply(EntityCounts)->Unit(benchmark::kMicrosecond)->UseRealTime();
+BENCHMARK(EventLoopEnqueueMutex)->Apply(EntityCounts)->Unit(benchmark::kMicrosecond)->UseRealTime();
@@ -0,0 +1,113 @@
+#include "../Common.h"
+
+#include <benchmark/benchmark.h>
+#include <Events/Delegate/InlineDelegate.h>
+#include <Events/Signal/Signal.h>
+
+#include <array>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <vector>
+
+namespace
+{
+    struct Listener
+    {
+        void Receive(const std::size_t Value)
+        {
+            Sum += Value;
+        }
+
+        std::size_t Sum;
+    };
+
+    constexpr std::size_t ListenersCount { 4u };
+}
+
+static void SignalPublish(benchmark::State& State)
+{
+    egg::Events::Signal<void(std::size_t)> Signal;
+    std::array<Listener, ListenersCount> Listeners {};
+
+    for (Listener& Current : Listeners)
+    {
+        Signal.Connect<&Listener::Receive>(Current);
+    }
+
+    for (auto _ : State)
+    {
+        for (std::size_t i = 0u, Count = GetCount(State); i < Count; ++i)
+        {
+            Signal.Publish(i);
+        }
+
+        benchmark::DoNotOptimize(Listeners);
+    }
+
+    State.SetItemsProcessed(State.iterations() * State.range(0));
+    State.counters["Listeners"] = static_cast<double>(ListenersCount);
+}
+
+static void SignalPublishInline(benchmark::State& State)
+{
+    using SlotType = egg::Events::InlineDelegate<void(std::size_t)>;
+
+    egg::Events::Signal<void(std::size_t), std::allocator<SlotType>, SlotType> Signal;
+    std::array<Listener, ListenersCount> Listeners {};
+
+    for (std::size_t Index = 0u; Listener& Current : Listeners)
+    {
+        Signal.Connect([&Current, Scale = ++Index, Offset = Index * 3u](const std::size_t Value)
+        {
+            Current.Sum += Value * Scale + Offset;
+        });
+    }
+
+    for (auto _ : State)
+    {
+        for (std::size_t i = 0u, Count = GetCount(State); i < Count; ++i)
+        {
+            Signal.Publish(i);
+        }
+
+        benchmark::DoNotOptimize(Listeners);
+    }
+
+    State.SetItemsProcessed(State.iterations() * State.range(0));
+    State.counters["Listeners"] = static_cast<double>(ListenersCount);
+}
+
+static void SignalPublishFunction(benchmark::State& State)
+{
+    std::vector<std::function<void(std::size_t)>> Slots;
+    std::array<Listener, ListenersCount> Listeners {};
+
+    for (std::size_t Index = 0u; Listener& Current : Listeners)
+    {
+        Slots.emplace_back([&Current, Scale = ++Index, Offset = Index * 3u](const std::size_t Value)
+        {
+            Current.Sum += Value * Scale + Offset;
+        });
+    }
+
+    for (auto _ : State)
+    {
+        for (std::size_t i = 0u, Count = GetCount(State); i < Count; ++i)
+        {
+            for (std::size_t Position = Slots.size(); Position--;)
+            {
+                Slots[Position](i);
+            }
+        }
+
+        benchmark::DoNotOptimize(Listeners);
+    }
+
+    State.SetItemsProcessed(State.iterations() * State.range(0));
+    State.counters["Listeners"] = static_cast<double>(ListenersCount);
+}
+
+BENCHMARK(SignalPublish)->Apply(EntityCounts)->Unit(benchmark::kMicrosecond);
+BENCHMARK(SignalPublishInline)->Apply(EntityCounts)->Unit(benchmark::kMicrosecond);
+BENCHMARK(SignalPublishFunction)->Apply(EntityCounts)->Unit(benchmark::kMicrosecond);
@@ -10,4 +10,10 @@
 
 #define EGG_EVENTS_RESOLVE_MEMBER_FUNCTORS true
 
+#ifndef EGG_CONTAINERS_SWISS_LOOKUP
+
+#define EGG_CONTAINERS_SWISS_LOOKUP false
+
+#endif
+
 #endif // ENGINE_SOURCES_CONFIG_CONFIG_H
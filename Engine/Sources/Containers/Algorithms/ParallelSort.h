@@ -0,0 +1,110 @@
+#ifndef ENGINE_SOURCES_CONTAINERS_ALGORITHMS_FILE_PARALLEL_SORT_H
+#define ENGINE_SOURCES_CONTAINERS_ALGORITHMS_FILE_PARALLEL_SORT_H
+
+#include <Jobs/Executor.h>
+
+#include <algorithm>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace egg::Containers
+{
+    inline constexpr std::size_t ParallelSortThreshold { 65'536u };
+
+
+    template <Jobs::Executor ExecutorParameter>
+    class ParallelSort final
+    {
+    public:
+        explicit ParallelSort(ExecutorParameter& Executor) noexcept : Executor { std::addressof(Executor) }
+        {
+        }
+
+        template <std::random_access_iterator IteratorType,
+                  std::sentinel_for<IteratorType> SentinelType,
+                  typename CompareType = std::ranges::less,
+                  typename ProjectionType = std::identity> requires
+            std::sortable<IteratorType, CompareType, ProjectionType> &&
+            std::default_initializable<std::iter_value_t<IteratorType>>
+        void operator()(IteratorType First, SentinelType Last, CompareType Compare = {}, ProjectionType Projection = {}) const
+        {
+            const auto Count { static_cast<std::size_t>(std::ranges::distance(First, Last)) };
+            const std::size_t Concurrency { Executor->GetConcurrency() };
+
+            if (Count < ParallelSortThreshold || Concurrency < 2u)
+            {
+                std::ranges::sort(First, First + static_cast<std::ptrdiff_t>(Count), std::move(Compare), std::move(Projection));
+                return;
+            }
+
+            const std::size_t RunsCount { std::bit_ceil(Concurrency) };
+            const std::size_t RunSize { (Count + RunsCount - 1u) / RunsCount };
+
+            const auto At { [Count](auto Base, const std::size_t Position)
+            {
+                return Base + static_cast<std::ptrdiff_t>(std::min(Position, Count));
+            } };
+
+            Executor->ParallelFor(RunsCount, 1u, [&](const std::size_t FirstRun, const std::size_t LastRun)
+            {
+                for (std::size_t Run = FirstRun; Run < LastRun; ++Run)
+                {
+                    std::ranges::sort(At(First, Run * RunSize), At(First, (Run + 1u) * RunSize), Compare, Projection);
+                }
+            });
+
+            std::vector<std::iter_value_t<IteratorType>> Buffer(Count);
+
+            const auto MergeRuns { [&](auto Source, auto Target, const std::size_t Width)
+            {
+                Executor->ParallelFor((Count + Width * 2u - 1u) / (Width * 2u), 1u, [&](const std::size_t FirstPair, const std::size_t LastPair)
+                {
+                    for (std::size_t Pair = FirstPair; Pair < LastPair; ++Pair)
+                    {
+                        const std::size_t Low { Pair * Width * 2u };
+
+                        std::ranges::merge(
+                            std::make_move_iterator(At(Source, Low)), std::make_move_iterator(At(Source, Low + Width)),
+                            std::make_move_iterator(At(Source, Low + Width)), std::make_move_iterator(At(Source, Low + Width * 2u)),
+                            At(Target, Low),
+                            Compare, Projection, Projection
+                        );
+                    }
+                });
+            } };
+
+            bool Buffered {};
+
+            for (std::size_t Width = RunSize; Width < Count; Width *= 2u, Buffered = !Buffered)
+            {
+                if (Buffered)
+                {
+                    MergeRuns(Buffer.begin(), First, Width);
+                }
+                else
+                {
+                    MergeRuns(First, Buffer.begin(), Width);
+                }
+            }
+
+            if (Buffered)
+            {
+                Executor->ParallelFor(Count, Jobs::GetChunkSize(Count, Concurrency, 1u), [&](const std::size_t From, const std::size_t To)
+                {
+                    std::ranges::move(At(Buffer.begin(), From), At(Buffer.begin(), To), At(First, From));
+                });
+            }
+        }
+
+    private:
+        ExecutorParameter* Executor;
+    };
+}
+
+#endif // ENGINE_SOURCES_CONTAINERS_ALGORITHMS_FILE_PARALLEL_SORT_H
@@ -0,0 +1,187 @@
+#ifndef ENGINE_SOURCES_CONTAINERS_ALGORITHMS_FILE_RADIX_SORT_H
+#define ENGINE_SOURCES_CONTAINERS_ALGORITHMS_FILE_RADIX_SORT_H
+
+#include <Types/Capabilities/Capabilities.h>
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <climits>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace egg::Containers
+{
+    template <typename Type>
+    concept RadixKey =
+        (std::integral<Type> && !std::same_as<Type, bool>) ||
+        (std::floating_point<Type> && std::numeric_limits<Type>::is_iec559 && (sizeof(Type) == 4u || sizeof(Type) == 8u));
+
+    template <typename Type>
+    concept AscendingOrder = std::same_as<Type, std::ranges::less> || Types::InstanceOf<Type, std::less>;
+
+    template <typename Type>
+    concept DescendingOrder = std::same_as<Type, std::ranges::greater> || Types::InstanceOf<Type, std::greater>;
+
+    template <typename Type>
+    concept RadixOrder = AscendingOrder<Type> || DescendingOrder<Type>;
+
+
+    namespace Internal
+    {
+        template <typename KeyType>
+        struct RadixBits
+        {
+            using Type = std::make_unsigned_t<KeyType>;
+        };
+
+        template <std::floating_point KeyType>
+        struct RadixBits<KeyType>
+        {
+            using Type = std::conditional_t<sizeof(KeyType) == 4u, std::uint32_t, std::uint64_t>;
+        };
+
+        template <RadixKey Type>
+        using RadixBitsType = typename RadixBits<Type>::Type;
+
+        template <RadixKey Type>
+        [[nodiscard]] constexpr RadixBitsType<Type> ToRadixBits(const Type Key) noexcept
+        {
+            using BitsType = RadixBitsType<Type>;
+            constexpr BitsType SignBit { BitsType { 1u } << (sizeof(BitsType) * CHAR_BIT - 1u) };
+
+            if constexpr (std::floating_point<Type>)
+            {
+                const BitsType Bits { std::bit_cast<BitsType>(Key) };
+                return Bits & SignBit ? static_cast<BitsType>(~Bits) : static_cast<BitsType>(Bits | SignBit);
+            }
+            else if constexpr (std::signed_integral<Type>)
+            {
+                return static_cast<BitsType>(static_cast<BitsType>(Key) ^ SignBit);
+            }
+            else
+            {
+                return Key;
+            }
+        }
+    }
+
+
+    struct RadixSortType final
+    {
+        static constexpr std::size_t DigitBits { 11u };
+        static constexpr std::size_t BucketsCount { std::size_t { 1u } << DigitBits };
+        static constexpr std::size_t SmallSortThreshold { 256u };
+
+        template <std::random_access_iterator IteratorType,
+                  std::sentinel_for<IteratorType> SentinelType,
+                  RadixOrder CompareType = std::ranges::less,
+                  typename ProjectionType = std::identity> requires
+            std::permutable<IteratorType> &&
+            std::default_initializable<std::iter_value_t<IteratorType>> &&
+            RadixKey<std::remove_cvref_t<std::indirect_result_t<ProjectionType&, IteratorType>>>
+        void operator()(IteratorType First, SentinelType Last, CompareType = {}, ProjectionType Projection = {}) const
+        {
+            using KeyType = std::remove_cvref_t<std::indirect_result_t<ProjectionType&, IteratorType>>;
+            using BitsType = Internal::RadixBitsType<KeyType>;
+            using ValueType = std::iter_value_t<IteratorType>;
+
+            struct Entry
+            {
+                BitsType Bits;
+                ValueType Value;
+            };
+
+            static constexpr std::size_t DigitsCount { (sizeof(BitsType) * CHAR_BIT + DigitBits - 1u) / DigitBits };
+            static constexpr BitsType OrderMask { DescendingOrder<CompareType> ? std::numeric_limits<BitsType>::max() : BitsType {} };
+
+            const auto Count { static_cast<std::size_t>(std::ranges::distance(First, Last)) };
+
+            if (Count < 2u)
+            {
+                return;
+            }
+
+            thread_local std::vector<Entry> Entries;
+            thread_local std::vector<Entry> Scratch;
+            thread_local std::vector<std::array<std::size_t, BucketsCount>> Histograms;
+
+            Entries.clear();
+            Entries.reserve(Count);
+
+            for (IteratorType It { First }; It != Last; ++It)
+            {
+                Entries.push_back(Entry {
+                    static_cast<BitsType>(Internal::ToRadixBits(std::invoke(Projection, *It)) ^ OrderMask),
+                    std::move(*It)
+                });
+            }
+
+            if (Count <= SmallSortThreshold)
+            {
+                std::ranges::stable_sort(Entries, std::ranges::less {}, &Entry::Bits);
+
+                for (Entry& Current : Entries)
+                {
+                    *First++ = std::move(Current.Value);
+                }
+
+                return;
+            }
+
+            Scratch.resize(Count);
+            Histograms.assign(DigitsCount, {});
+
+            for (const Entry& Current : Entries)
+            {
+                for (std::size_t Digit = 0u; Digit < DigitsCount; ++Digit)
+                {
+                    ++Histograms[Digit][Current.Bits >> (Digit * DigitBits) & (BucketsCount - 1u)];
+                }
+            }
+
+            Entry* Source { Entries.data() };
+            Entry* Target { Scratch.data() };
+
+            for (std::size_t Digit = 0u; Digit < DigitsCount; ++Digit)
+            {
+                std::array<std::size_t, BucketsCount>& Offsets { Histograms[Digit] };
+                const std::size_t Shift { Digit * DigitBits };
+
+                if (Offsets[Source->Bits >> Shift & (BucketsCount - 1u)] == Count)
+                {
+                    continue;
+                }
+
+                for (std::size_t Bucket = 0u, Offset = 0u; Bucket < BucketsCount; ++Bucket)
+                {
+                    Offset += std::exchange(Offsets[Bucket], Offset);
+                }
+
+                for (const Entry* Current { Source }, * const End { Source + Count }; Current != End; ++Current)
+                {
+                    Target[Offsets[Current->Bits >> Shift & (BucketsCount - 1u)]++] = std::move(*Current);
+                }
+
+                std::swap(Source, Target);
+            }
+
+            for (Entry* Current { Source }, * const End { Source + Count }; Current != End; ++Current, ++First)
+            {
+                *First = std::move(Current->Value);
+            }
+        }
+    };
+
+
+    inline constexpr RadixSortType RadixSort {};
+}
+
+#endif // ENGINE_SOURCES_CONTAINERS_ALGORITHMS_FILE_RADIX_SORT_H
@@ -0,0 +1,134 @@
+#ifndef ENGINE_SOURCES_CONTAINERS_DENSE_MAP_INTERNAL_FILE_SWISS_GROUP_H
+#define ENGINE_SOURCES_CONTAINERS_DENSE_MAP_INTERNAL_FILE_SWISS_GROUP_H
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define EGG_CONTAINERS_SWISS_SSE2
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) || defined(_M_ARM64)
+#define EGG_CONTAINERS_SWISS_NEON
+#include <arm_neon.h>
+#endif
+
+namespace egg::Containers::Internal
+{
+    enum SwissControl : std::int8_t
+    {
+        SwissEmpty = -128,
+        SwissDeleted = -2
+    };
+
+
+    template <int Shift>
+    class SwissMask final
+    {
+    public:
+        constexpr explicit SwissMask(const std::uint64_t Mask) noexcept : Mask { Mask }
+        {
+        }
+
+        [[nodiscard]] constexpr explicit operator bool() const noexcept
+        {
+            return Mask != 0u;
+        }
+
+        [[nodiscard]] constexpr std::size_t GetLowest() const noexcept
+        {
+            return static_cast<std::size_t>(std::countr_zero(Mask)) >> Shift;
+        }
+
+        constexpr SwissMask& operator++() noexcept
+        {
+            Mask &= Mask - 1u;
+            return *this;
+        }
+
+    private:
+        std::uint64_t Mask;
+    };
+
+
+    class SwissGroup final
+    {
+    public:
+        static constexpr std::size_t Width { 16u };
+
+#ifdef EGG_CONTAINERS_SWISS_NEON
+        using MaskType = SwissMask<2>;
+#else
+        using MaskType = SwissMask<0>;
+#endif
+
+
+        explicit SwissGroup(const std::int8_t* Control) noexcept
+#if defined(EGG_CONTAINERS_SWISS_SSE2)
+            : Control { _mm_loadu_si128(reinterpret_cast<const __m128i*>(Control)) }
+#elif defined(EGG_CONTAINERS_SWISS_NEON)
+            : Control { vld1q_s8(Control) }
+#else
+            : Control { Control }
+#endif
+        {
+        }
+
+        [[nodiscard]] MaskType Match(const std::int8_t Hash) const noexcept
+        {
+#if defined(EGG_CONTAINERS_SWISS_SSE2)
+            return MaskType { static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(Control, _mm_set1_epi8(Hash)))) };
+#elif defined(EGG_CONTAINERS_SWISS_NEON)
+            return ToMask(vceqq_s8(Control, vdupq_n_s8(Hash)));
+#else
+            return MatchIf([Hash](const std::int8_t Value) { return Value == Hash; });
+#endif
+        }
+
+        [[nodiscard]] MaskType MatchEmpty() const noexcept
+        {
+            return Match(SwissEmpty);
+        }
+
+        [[nodiscard]] MaskType MatchEmptyOrDeleted() const noexcept
+        {
+#if defined(EGG_CONTAINERS_SWISS_SSE2)
+            return MaskType { static_cast<std::uint32_t>(_mm_movemask_epi8(Control)) };
+#elif defined(EGG_CONTAINERS_SWISS_NEON)
+            return ToMask(vcltq_s8(Control, vdupq_n_s8(0)));
+#else
+            return MatchIf([](const std::int8_t Value) { return Value < 0; });
+#endif
+        }
+
+    private:
+#if defined(EGG_CONTAINERS_SWISS_SSE2)
+        __m128i Control;
+#elif defined(EGG_CONTAINERS_SWISS_NEON)
+        static MaskType ToMask(const uint8x16_t Compared) noexcept
+        {
+            const uint8x8_t Narrowed { vshrn_n_u16(vreinterpretq_u16_u8(Compared), 4) };
+            return MaskType { vget_lane_u64(vreinterpret_u64_u8(Narrowed), 0) & 0x8888888888888888u };
+        }
+
+        int8x16_t Control;
+#else
+        template <typename PredicateType>
+        MaskType MatchIf(const PredicateType Predicate) const noexcept
+        {
+            std::uint64_t Mask {};
+
+            for (std::size_t i = 0u; i < Width; ++i)
+            {
+                Mask |= static_cast<std::uint64_t>(Predicate(Control[i])) << i;
+            }
+
+            return MaskType { Mask };
+        }
+
+        const std::int8_t* Control;
+#endif
+    };
+}
+
+#endif // ENGINE_SOURCES_CONTAINERS_DENSE_MAP_INTERNAL_FILE_SWISS_GROUP_H
@@ -0,0 +1,25 @@
+#ifndef ENGINE_SOURCES_CONTAINERS_DENSE_MAP_FILE_LOOKUP_MAP_H
+#define ENGINE_SOURCES_CONTAINERS_DENSE_MAP_FILE_LOOKUP_MAP_H
+
+#include <Config/Config.h>
+#include <Containers/DenseMap/DenseMap.h>
+#include <Containers/DenseMap/SwissDenseMap.h>
+
+#include <functional>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+namespace egg::Containers
+{
+    template <typename KeyType, typename ValueType,
+              typename HashType = std::identity, typename KeyEqualType = std::equal_to<>,
+              typename AllocatorType = std::allocator<std::pair<const KeyType, ValueType>>>
+    using LookupMap = std::conditional_t<
+        EGG_CONTAINERS_SWISS_LOOKUP,
+        SwissDenseMap<KeyType, ValueType, HashType, KeyEqualType, AllocatorType>,
+        DenseMap<KeyType, ValueType, HashType, KeyEqualType, AllocatorType>
+    >;
+}
+
+#endif // ENGINE_SOURCES_CONTAINERS_DENSE_MAP_FILE_LOOKUP_MAP_H
@@ -0,0 +1,611 @@
+#ifndef ENGINE_SOURCES_CONTAINERS_DENSE_MAP_FILE_SWISS_DENSE_MAP_H
+#define ENGINE_SOURCES_CONTAINERS_DENSE_MAP_FILE_SWISS_DENSE_MAP_H
+
+#include "./Internal/DenseMapIterator.h"
+#include "./Internal/DenseMapNode.h"
+#include "./Internal/SwissGroup.h"
+
+#include <Config/Config.h>
+#include <Containers/Container.h>
+#include <Containers/CompressedPair/CompressedPair.h>
+#include <Memory/Utils.h>
+#include <Types/Capabilities/Capabilities.h>
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+namespace egg::Containers
+{
+    template <typename KeyParameter, typename ValueParameter,
+              typename HashParameter = std::identity, typename KeyEqualParameter = std::equal_to<>,
+              Types::ValidAllocator<std::pair<const KeyParameter, ValueParameter>> AllocatorParameter
+              = std::allocator<std::pair<const KeyParameter, ValueParameter>>>
+    class SwissDenseMap
+    {
+        static constexpr float MaxLoadFactor { 0.875f };
+        static constexpr std::size_t GroupWidth { Internal::SwissGroup::Width };
+        static constexpr std::size_t MinimumCapacity { GroupWidth };
+
+        using ContainerAllocatorTraits = AllocatorTraits<AllocatorParameter>;
+
+        using NodeType = Internal::DenseMapNode<KeyParameter, ValueParameter>;
+
+        using ControlContainer = std::vector<std::int8_t, typename ContainerAllocatorTraits::template rebind_alloc<std::int8_t>>;
+        using SlotContainer = std::vector<std::size_t, typename ContainerAllocatorTraits::template rebind_alloc<std::size_t>>;
+        using PackedContainer = std::vector<NodeType, typename ContainerAllocatorTraits::template rebind_alloc<NodeType>>;
+
+        using ControlPair = CompressedPair<ControlContainer, HashParameter>;
+        using PackedPair = CompressedPair<PackedContainer, KeyEqualParameter>;
+
+    public:
+        using AllocatorType = AllocatorParameter;
+        using KeyType = KeyParameter;
+        using MappedType = ValueParameter;
+        using ValueType = std::pair<const KeyType, ValueParameter>;
+
+        using HashType = HashParameter;
+        using KeyEqualType = KeyEqualParameter;
+
+        using Iterator = Internal::DenseMapIterator<typename PackedContainer::iterator>;
+        using ConstIterator = Internal::DenseMapIterator<typename PackedContainer::const_iterator>;
+        using ReverseIterator = Internal::DenseMapIterator<typename PackedContainer::reverse_iterator>;
+        using ConstReverseIterator = Internal::DenseMapIterator<typename PackedContainer::const_reverse_iterator>;
+
+
+        SwissDenseMap() : SwissDenseMap { MinimumCapacity }
+        {
+        }
+
+        explicit SwissDenseMap(const AllocatorType& Allocator) : SwissDenseMap { MinimumCapacity, Allocator }
+        {
+        }
+
+        SwissDenseMap(const std::size_t Capacity, const AllocatorType& Allocator)
+            : SwissDenseMap { Capacity, HashType {}, KeyEqualType {}, Allocator }
+        {
+        }
+
+        explicit SwissDenseMap(const std::size_t Capacity,
+                               const HashType& Hash = HashType {}, const KeyEqualType& KeyEqual = KeyEqualType {},
+                               const AllocatorType& Allocator = AllocatorType {})
+            : Control { Allocator, Hash },
+              Slots { Allocator },
+              Packed { Allocator, KeyEqual },
+              Tombstones {}
+        {
+            Rehash(Capacity);
+        }
+
+        SwissDenseMap(const SwissDenseMap&) = default;
+
+        SwissDenseMap(const SwissDenseMap& Other, const AllocatorType& Allocator)
+            : Control {
+                  std::piecewise_construct,
+                  std::forward_as_tuple(Other.Control.GetFirst(), Allocator),
+                  std::forward_as_tuple(Other.Control.GetSecond())
+              },
+              Slots { Other.Slots, Allocator },
+              Packed {
+                  std::piecewise_construct,
+                  std::forward_as_tuple(Other.Packed.GetFirst(), Allocator),
+                  std::forward_as_tuple(Other.Packed.GetSecond())
+              },
+              Tombstones { Other.Tombstones }
+        {
+        }
+
+        SwissDenseMap(SwissDenseMap&&) noexcept(
+            std::is_nothrow_move_constructible_v<ControlPair> &&
+            std::is_nothrow_move_constructible_v<SlotContainer> &&
+            std::is_nothrow_move_constructible_v<PackedPair>) = default;
+
+        SwissDenseMap(SwissDenseMap&& Other, const AllocatorType& Allocator)
+            : Control {
+                  std::piecewise_construct,
+                  std::forward_as_tuple(std::move(Other.Control.GetFirst()), Allocator),
+                  std::forward_as_tuple(std::move(Other.Control.GetSecond()))
+              },
+              Slots { std::move(Other.Slots), Allocator },
+              Packed {
+                  std::piecewise_construct,
+                  std::forward_as_tuple(std::move(Other.Packed.GetFirst()), Allocator),
+                  std::forward_as_tuple(std::move(Other.Packed.GetSecond()))
+              },
+              Tombstones { Other.Tombstones }
+        {
+        }
+
+        ~SwissDenseMap() noexcept = default;
+
+        SwissDenseMap& operator=(const SwissDenseMap&) = default;
+
+        SwissDenseMap& operator=(SwissDenseMap&&) noexcept(
+            std::is_nothrow_move_assignable_v<ControlPair> &&
+            std::is_nothrow_move_assignable_v<SlotContainer> &&
+            std::is_nothrow_move_assignable_v<PackedPair>) = default;
+
+        friend void swap(SwissDenseMap& Left, SwissDenseMap& Right) noexcept(
+            std::is_nothrow_swappable_v<ControlPair> &&
+            std::is_nothrow_swappable_v<SlotContainer> &&
+            std::is_nothrow_swappable_v<PackedPair>)
+        {
+            using std::swap;
+            swap(Left.Control, Right.Control);
+            swap(Left.Slots, Right.Slots);
+            swap(Left.Packed, Right.Packed);
+            swap(Left.Tombstones, Right.Tombstones);
+        }
+
+        template <typename Arg> requires std::constructible_from<ValueType, Arg&&>
+        std::pair<Iterator, bool> Insert(Arg&& Value)
+        {
+            return InsertOrDoNothing(std::forward_like<Arg>(Value.first), std::forward_like<Arg>(Value.second));
+        }
+
+        template <typename IteratorType, std::sentinel_for<IteratorType> SentinelType>
+        void Insert(IteratorType First, SentinelType Last)
+        {
+            for (; First != Last; ++First)
+            {
+                Insert(*First);
+            }
+        }
+
+        template <typename Arg>
+        std::pair<Iterator, bool> InsertOrAssign(const KeyType& Key, Arg&& Value)
+        {
+            return InsertOrOverwrite(Key, std::forward<Arg>(Value));
+        }
+
+        template <typename Arg>
+        std::pair<Iterator, bool> InsertOrAssign(KeyType&& Key, Arg&& Value)
+        {
+            return InsertOrOverwrite(std::move(Key), std::forward<Arg>(Value));
+        }
+
+        template <typename... Args>
+        std::pair<Iterator, bool> Emplace([[maybe_unused]] Args&&... Arguments)
+        {
+            if constexpr (!sizeof...(Args))
+            {
+                return InsertOrDoNothing(KeyType {});
+            }
+            else if constexpr (sizeof...(Args) == 1u)
+            {
+                return InsertOrDoNothing(std::forward_like<Args>(Arguments.first)..., std::forward_like<Args>(Arguments.second)...);
+            }
+            else if constexpr (sizeof...(Args) == 2u)
+            {
+                return InsertOrDoNothing(std::forward<Args>(Arguments)...);
+            }
+            else
+            {
+                NodeType Node { GetCapacity(), std::forward<Args>(Arguments)... };
+                const std::size_t Hash { GetHashOf(Node.Value.first) };
+
+                if (const auto It { FindWithHash(Node.Value.first, Hash) }; It != End())
+                {
+                    return std::make_pair(It, false);
+                }
+
+                ReserveForInsertion();
+
+                const std::size_t Slot { FindInsertionSlot(Hash) };
+
+                Node.Next = Slot;
+                Packed.GetFirst().push_back(std::move(Node));
+                Occupy(Slot, Hash, GetSize() - 1u);
+
+                return std::make_pair(--End(), true);
+            }
+        }
+
+        template <typename... Args>
+        std::pair<Iterator, bool> TryEmplace(const KeyType& Key, Args&&... Arguments)
+        {
+            return InsertOrDoNothing(Key, std::forward<Args>(Arguments)...);
+        }
+
+        template <typename... Args>
+        std::pair<Iterator, bool> TryEmplace(KeyType&& Key, Args&&... Arguments)
+        {
+            return InsertOrDoNothing(std::move(Key), std::forward<Args>(Arguments)...);
+        }
+
+        Iterator Erase(ConstIterator Position)
+        {
+            const auto Difference { Position - ConstBegin() };
+            Erase(Position->first);
+            return Begin() + Difference;
+        }
+
+        bool Erase(const KeyType& Key)
+        {
+            const auto It { Find(Key) };
+
+            if (It == End())
+            {
+                return false;
+            }
+
+            const auto Index { static_cast<std::size_t>(It - Begin()) };
+            Vacate(Packed.GetFirst()[Index].Next);
+            MoveAndPop(Index);
+            return true;
+        }
+
+        void Clear() noexcept
+        {
+            Packed.GetFirst().clear();
+            Control.GetFirst().clear();
+            Slots.clear();
+            Rehash(0u);
+        }
+
+        void Reserve(const std::size_t Count)
+        {
+            Packed.GetFirst().reserve(Count);
+            Rehash(static_cast<std::size_t>(std::ceil(static_cast<float>(Count) / MaxLoadFactor)));
+        }
+
+        void Rehash(const std::size_t Capacity)
+        {
+            const auto NewCapacity {
+                std::bit_ceil(std::max({
+                    Capacity,
+                    MinimumCapacity,
+                    static_cast<std::size_t>(std::ceil(static_cast<float>(GetSize()) / MaxLoadFactor))
+                }))
+            };
+
+            if (NewCapacity != GetCapacity() || Tombstones)
+            {
+                Resize(NewCapacity);
+            }
+        }
+
+        [[nodiscard]] Iterator Find(const KeyType& Key)
+        {
+            return FindWithHash(Key, GetHashOf(Key));
+        }
+
+        [[nodiscard]] ConstIterator Find(const KeyType& Key) const
+        {
+            return ConstIterator { const_cast<SwissDenseMap&>(*this).Find(Key) };
+        }
+
+        template <typename Other>
+        [[nodiscard]] Iterator Find(const Other& Key)
+            requires (Types::Transparent<HashType> && Types::Transparent<KeyEqualType>)
+        {
+            return FindWithHash(Key, GetHashOf(Key));
+        }
+
+        template <typename Other>
+        [[nodiscard]] ConstIterator Find(const Other& Key) const
+            requires (Types::Transparent<HashType> && Types::Transparent<KeyEqualType>)
+        {
+            return ConstIterator { const_cast<SwissDenseMap&>(*this).Find(Key) };
+        }
+
+        [[nodiscard]] MappedType& At(const KeyType& Key)
+        {
+            const auto It { Find(Key) };
+            EGG_ASSERT(It != End(), "Invalid key");
+            return It->second;
+        }
+
+        [[nodiscard]] const MappedType& At(const KeyType& Key) const
+        {
+            const auto It { Find(Key) };
+            EGG_ASSERT(It != End(), "Invalid key");
+            return It->second;
+        }
+
+        [[nodiscard]] MappedType& operator[](const KeyType& Key)
+        {
+            return InsertOrDoNothing(Key).first->second;
+        }
+
+        [[nodiscard]] MappedType& operator[](KeyType&& Key)
+        {
+            return InsertOrDoNothing(std::move(Key)).first->second;
+        }
+
+        [[nodiscard]] bool Contains(const KeyType& Key) const
+        {
+            return Find(Key) != End();
+        }
+
+        template <typename Other>
+        [[nodiscard]] bool Contains(const Other& Key) const
+            requires (Types::Transparent<HashType> && Types::Transparent<KeyEqualType>)
+        {
+            return Find(Key) != End();
+        }
+
+        [[nodiscard]] constexpr std::size_t GetSize() const noexcept
+        {
+            return Packed.GetFirst().size();
+        }
+
+        [[nodiscard]] constexpr std::size_t GetMaxSize() const noexcept
+        {
+            return Packed.GetFirst().max_size();
+        }
+
+        [[nodiscard]] constexpr bool Empty() const noexcept
+        {
+            return Packed.GetFirst().empty();
+        }
+
+        [[nodiscard]] constexpr std::size_t GetCapacity() const noexcept
+        {
+            return Control.GetFirst().size();
+        }
+
+        [[nodiscard]] constexpr float GetLoadFactor() const noexcept
+        {
+            return GetSize() / static_cast<float>(GetCapacity());
+        }
+
+        [[nodiscard]] constexpr float GetMaxLoadFactor() const noexcept
+        {
+            return MaxLoadFactor;
+        }
+
+        [[nodiscard]] constexpr Iterator Begin() noexcept
+        {
+            return Iterator { Packed.GetFirst().begin() };
+        }
+
+        [[nodiscard]] constexpr ConstIterator Begin() const noexcept
+        {
+            return ConstIterator { Packed.GetFirst().begin() };
+        }
+
+        [[nodiscard]] constexpr ConstIterator ConstBegin() const noexcept
+        {
+            return Begin();
+        }
+
+        [[nodiscard]] constexpr Iterator End() noexcept
+        {
+            return Iterator { Packed.GetFirst().end() };
+        }
+
+        [[nodiscard]] constexpr ConstIterator End() const noexcept
+        {
+            return ConstIterator { Packed.GetFirst().end() };
+        }
+
+        [[nodiscard]] constexpr ConstIterator ConstEnd() const noexcept
+        {
+            return End();
+        }
+
+        [[nodiscard]] constexpr ReverseIterator ReverseBegin() noexcept
+        {
+            return ReverseIterator { Packed.GetFirst().rbegin() };
+        }
+
+        [[nodiscard]] constexpr ConstReverseIterator ReverseBegin() const noexcept
+        {
+            return ConstReverseIterator { Packed.GetFirst().rbegin() };
+        }
+
+        [[nodiscard]] constexpr ConstReverseIterator ConstReverseBegin() const noexcept
+        {
+            return ReverseBegin();
+        }
+
+        [[nodiscard]] constexpr ReverseIterator ReverseEnd() noexcept
+        {
+            return ReverseIterator { Packed.GetFirst().rend() };
+        }
+
+        [[nodiscard]] constexpr ConstReverseIterator ReverseEnd() const noexcept
+        {
+            return ConstReverseIterator { Packed.GetFirst().rend() };
+        }
+
+        [[nodiscard]] constexpr ConstReverseIterator ConstReverseEnd() const noexcept
+        {
+            return ReverseEnd();
+        }
+
+        [[nodiscard]] constexpr HashType GetHash() const
+        {
+            return Control.GetSecond();
+        }
+
+        [[nodiscard]] constexpr KeyEqualType GetKeyEqual() const
+        {
+            return Packed.GetSecond();
+        }
+
+        [[nodiscard]] constexpr AllocatorType GetAllocator() const noexcept
+        {
+            return Packed.GetFirst().get_allocator();
+        }
+
+    private:
+        template <typename Other>
+        [[nodiscard]] std::size_t GetHashOf(const Other& Key) const
+        {
+            constexpr auto Multiplier { static_cast<std::size_t>(0x9E3779B97F4A7C15u) };
+            return Memory::ShiftMix(static_cast<std::size_t>(Control.GetSecond()(Key)) * Multiplier, std::size_t { sizeof(std::size_t) * 4u });
+        }
+
+        [[nodiscard]] static constexpr std::int8_t GetControlOf(const std::size_t Hash) noexcept
+        {
+            return static_cast<std::int8_t>(Hash & 0x7Fu);
+        }
+
+        [[nodiscard]] constexpr std::size_t GetFirstGroup(const std::size_t Hash) const noexcept
+        {
+            return (Hash >> 7u) & (GetCapacity() / GroupWidth - 1u);
+        }
+
+        template <typename Other>
+        [[nodiscard]] Iterator FindWithHash(const Other& Key, const std::size_t Hash)
+        {
+            const std::int8_t Expected { GetControlOf(Hash) };
+            const std::size_t GroupMask { GetCapacity() / GroupWidth - 1u };
+
+            for (std::size_t Group = GetFirstGroup(Hash), Step = 0u;; Group = (Group + ++Step) & GroupMask)
+            {
+                const std::size_t Offset { Group * GroupWidth };
+                const Internal::SwissGroup Current { Control.GetFirst().data() + Offset };
+
+                for (auto Mask = Current.Match(Expected); Mask; ++Mask)
+                {
+                    const std::size_t Index { Slots[Offset + Mask.GetLowest()] };
+
+                    if (Packed.GetSecond()(Packed.GetFirst()[Index].Value.first, Key))
+                    {
+                        return Begin() + static_cast<typename Iterator::difference_type>(Index);
+                    }
+                }
+
+                if (Current.MatchEmpty())
+                {
+                    return End();
+                }
+            }
+        }
+
+        [[nodiscard]] std::size_t FindInsertionSlot(const std::size_t Hash) const noexcept
+        {
+            const std::size_t GroupMask { GetCapacity() / GroupWidth - 1u };
+
+            for (std::size_t Group = GetFirstGroup(Hash), Step = 0u;; Group = (Group + ++Step) & GroupMask)
+            {
+                const std::size_t Offset { Group * GroupWidth };
+
+                if (const auto Mask { Internal::SwissGroup { Control.GetFirst().data() + Offset }.MatchEmptyOrDeleted() })
+                {
+                    return Offset + Mask.GetLowest();
+                }
+            }
+        }
+
+        template <typename Other, typename... Args>
+        [[nodiscard]] std::pair<Iterator, bool> InsertOrDoNothing(Other&& Key, Args&&... Arguments)
+        {
+            const std::size_t Hash { GetHashOf(Key) };
+
+            if (const auto It { FindWithHash(Key, Hash) }; It != End())
+            {
+                return std::make_pair(It, false);
+            }
+
+            ReserveForInsertion();
+
+            const std::size_t Slot { FindInsertionSlot(Hash) };
+
+            Packed.GetFirst().emplace_back(
+                Slot,
+                std::piecewise_construct,
+                std::forward_as_tuple(std::forward<Other>(Key)),
+                std::forward_as_tuple(std::forward<Args>(Arguments)...)
+            );
+
+            Occupy(Slot, Hash, GetSize() - 1u);
+
+            return std::make_pair(--End(), true);
+        }
+
+        template <typename Other, typename Arg>
+        [[nodiscard]] std::pair<Iterator, bool> InsertOrOverwrite(Other&& Key, Arg&& Value)
+        {
+            const std::size_t Hash { GetHashOf(Key) };
+
+            if (const auto It { FindWithHash(Key, Hash) }; It != End())
+            {
+                It->second = std::forward<Arg>(Value);
+                return std::make_pair(It, false);
+            }
+
+            ReserveForInsertion();
+
+            const std::size_t Slot { FindInsertionSlot(Hash) };
+
+            Packed.GetFirst().emplace_back(Slot, std::forward<Other>(Key), std::forward<Arg>(Value));
+            Occupy(Slot, Hash, GetSize() - 1u);
+
+            return std::make_pair(--End(), true);
+        }
+
+        void Occupy(const std::size_t Slot, const std::size_t Hash, const std::size_t Index) noexcept
+        {
+            std::int8_t& Current { Control.GetFirst()[Slot] };
+            Tombstones -= Current == Internal::SwissDeleted;
+            Current = GetControlOf(Hash);
+            Slots[Slot] = Index;
+            Packed.GetFirst()[Index].Next = Slot;
+        }
+
+        void Vacate(const std::size_t Slot) noexcept
+        {
+            const std::size_t Offset { Slot / GroupWidth * GroupWidth };
+
+            if (Internal::SwissGroup { Control.GetFirst().data() + Offset }.MatchEmpty())
+            {
+                Control.GetFirst()[Slot] = Internal::SwissEmpty;
+            }
+            else
+            {
+                Control.GetFirst()[Slot] = Internal::SwissDeleted;
+                ++Tombstones;
+            }
+        }
+
+        void MoveAndPop(const std::size_t Position)
+        {
+            if (const auto Last { GetSize() - 1u }; Position != Last)
+            {
+                Packed.GetFirst()[Position] = std::move(Packed.GetFirst().back());
+                Slots[Packed.GetFirst()[Position].Next] = Position;
+            }
+
+            Packed.GetFirst().pop_back();
+        }
+
+        void ReserveForInsertion()
+        {
+            const auto Limit { static_cast<std::size_t>(static_cast<float>(GetCapacity()) * MaxLoadFactor) };
+
+            if (GetSize() + Tombstones + 1u > Limit)
+            {
+                Resize(GetSize() + 1u > Limit / 2u ? GetCapacity() << 1u : GetCapacity());
+            }
+        }
+
+        void Resize(const std::size_t Capacity)
+        {
+            Control.GetFirst().assign(Capacity, Internal::SwissEmpty);
+            Slots.resize(Capacity);
+            Tombstones = 0u;
+
+            for (std::size_t Index = 0u, Last = GetSize(); Index < Last; ++Index)
+            {
+                const std::size_t Hash { GetHashOf(Packed.GetFirst()[Index].Value.first) };
+                Occupy(FindInsertionSlot(Hash), Hash, Index);
+            }
+        }
+
+        ControlPair Control;
+        SlotContainer Slots;
+        PackedPair Packed;
+        std::size_t Tombstones;
+    };
+}
+
+#endif // ENGINE_SOURCES_CONTAINERS_DENSE_MAP_FILE_SWISS_DENSE_MAP_H
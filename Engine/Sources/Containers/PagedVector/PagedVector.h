@@ -9,7 +9,9 @@
 #include <Math/Math.h>
 #include <Types/Capabilities/Capabilities.h>
 
+#include <algorithm>
 #include <memory>
+#include <span>
 #include <vector>
 
 namespace egg::ECS::Containers
@@ -91,6 +93,16 @@ namespace egg::ECS::Containers
             return Payload.GetFirst().size() * PageSize::value;
         }
 
+        [[nodiscard]] constexpr std::size_t GetPagesCount() const noexcept
+        {
+            return Payload.GetFirst().size();
+        }
+
+        [[nodiscard]] constexpr std::span<const Pointer> GetPages() const noexcept
+        {
+            return Payload.GetFirst();
+        }
+
         [[nodiscard]] constexpr AllocatorType GetAllocator() const noexcept
         {
             return Payload.GetSecond();
@@ -191,12 +203,36 @@ namespace egg::ECS::Containers
 
             for (auto Position = From; Position < Payload.GetFirst().size(); ++Position)
             {
+                if (!Payload.GetFirst()[Position]) continue;
                 ContainerAllocatorTraits::deallocate(Payload.GetSecond(), Payload.GetFirst()[Position], PageSize::value);
             }
 
             Payload.GetFirst().resize(From);
         }
 
+        constexpr void Adopt(const std::span<ValueType> Pages)
+            requires std::same_as<Pointer, ValueType*>
+        {
+            EGG_ASSERT(!GetExtent(), "Cannot adopt pages into a non-empty paged vector");
+            EGG_ASSERT(Pages.size() % PageSize::value == 0u, "Adopted memory must consist of whole pages");
+
+            const auto Count { Pages.size() / PageSize::value };
+
+            Payload.GetFirst().reserve(Count);
+
+            for (std::size_t Page = 0u; Page < Count; ++Page)
+            {
+                Payload.GetFirst().push_back(Pages.data() + Page * PageSize::value);
+            }
+        }
+
+        constexpr void Detach(const std::size_t FirstPage, const std::size_t LastPage) noexcept
+        {
+            EGG_ASSERT(LastPage <= Payload.GetFirst().size(), "Detached pages are out of range");
+            const auto Pages { Payload.GetFirst().begin() };
+            std::fill(Pages + static_cast<std::ptrdiff_t>(FirstPage), Pages + static_cast<std::ptrdiff_t>(LastPage), nullptr);
+        }
+
     private:
         template <std::same_as<ValueType>...DefaultValueType> requires(sizeof...(DefaultValueType) <= 1u)
         constexpr ValueType& AssurePosition(const std::size_t Position, const DefaultValueType&... DefaultValue)
@@ -0,0 +1,365 @@
+#ifndef ENGINE_SOURCES_ECS_FILE_ARCHETYPE_REGISTRY_H
+#define ENGINE_SOURCES_ECS_FILE_ARCHETYPE_REGISTRY_H
+
+#include <Config/Config.h>
+#include <Containers/DenseMap/DenseMap.h>
+#include <ECS/Entity.h>
+#include <ECS/Ownership.h>
+#include <ECS/Recycler.h>
+#include <ECS/Containers/Archetype/Archetype.h>
+#include <ECS/Containers/ArchetypeGroup/ArchetypeGroup.h>
+#include <ECS/Containers/Storage/Storage.h>
+#include <Memory/Utils.h>
+#include <Types/Types.h>
+#include <Types/Capabilities/Capabilities.h>
+#include <Types/TypeInfo/TypeInfo.h>
+
+#include <algorithm>
+#include <array>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <ranges>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace egg::ECS
+{
+    //Experimental standalone container: it mirrors Registry's Create/Destroy/Emplace/Erase/Get/Contains surface,
+    //but it is not a storage policy of Registry, so View, Snapshot, Observer and MemoryReport do not accept it
+    template <ValidEntity EntityParameter, Types::ValidAllocator<EntityParameter> AllocatorParameter = std::allocator<EntityParameter>>
+    class ArchetypeRegistry final
+    {
+        using RegistryAllocatorTraits = std::allocator_traits<AllocatorParameter>;
+
+        template <typename KeyType, typename MappedType>
+        using DenseMapFor = egg::Containers::DenseMap<
+            KeyType, MappedType, std::identity, std::equal_to<>,
+            typename RegistryAllocatorTraits::template rebind_alloc<std::pair<const KeyType, MappedType>>
+        >;
+
+        template <typename Type>
+        using VectorFor = std::vector<Type, typename RegistryAllocatorTraits::template rebind_alloc<Type>>;
+
+        using RecyclerType = Recycler<EntityParameter, AllocatorParameter>;
+
+        using ArchetypeType = Containers::Archetype<EntityParameter, AllocatorParameter>;
+        using ArchetypePointer = std::unique_ptr<
+            ArchetypeType,
+            Memory::AllocationDeleter<typename RegistryAllocatorTraits::template rebind_alloc<ArchetypeType>>
+        >;
+
+        using ColumnType = typename ArchetypeType::ColumnType;
+
+        using QueryType = Containers::Internal::ArchetypeQuery<ArchetypeType>;
+        using QueryContainerType = DenseMapFor<Types::IDType, std::shared_ptr<QueryType>>;
+
+        using EntityTraitsType = EntityTraits<EntityParameter>;
+
+        struct Location
+        {
+            ArchetypeType* Table;
+            std::size_t Row;
+        };
+
+    public:
+        using AllocatorType = AllocatorParameter;
+
+        using EntityType = EntityParameter;
+        using VersionType = typename EntityTraitsType::VersionType;
+
+
+        constexpr ArchetypeRegistry() : ArchetypeRegistry { AllocatorType {} }
+        {
+        }
+
+        constexpr explicit ArchetypeRegistry(const AllocatorType& Allocator)
+            : Entities { Allocator },
+              Locations { Allocator },
+              Archetypes { Allocator },
+              Queries { Allocator }
+        {
+            CreateArchetype(std::span<const ColumnType> {});
+        }
+
+        ArchetypeRegistry(const ArchetypeRegistry&) = delete;
+
+        constexpr ArchetypeRegistry(ArchetypeRegistry&&) noexcept = default;
+
+        constexpr ~ArchetypeRegistry() noexcept = default;
+
+        ArchetypeRegistry& operator=(const ArchetypeRegistry&) = delete;
+
+        constexpr ArchetypeRegistry& operator=(ArchetypeRegistry&&) noexcept = default;
+
+        [[nodiscard]] constexpr bool Valid(const EntityType Entity) const noexcept
+        {
+            return Entities.Valid(Entity);
+        }
+
+        [[nodiscard]] constexpr VersionType GetVersion(const EntityType Entity) const noexcept
+        {
+            return Entities.GetVersion(Entity);
+        }
+
+        [[nodiscard]] constexpr EntityType Create()
+        {
+            const EntityType Entity { Entities.Create() };
+            const std::size_t Index { EntityTraitsType::ToEntity(Entity) };
+
+            if (Index >= Locations.size())
+            {
+                Locations.resize(Index + 1u);
+            }
+
+            Locations[Index] = Location { GetRoot(), GetRoot()->Push(Entity) };
+            return Entity;
+        }
+
+        constexpr VersionType Destroy(const EntityType Entity)
+        {
+            EGG_ASSERT(Valid(Entity), "Invalid entity");
+
+            const Location& Current { GetLocation(Entity) };
+            UpdateMoved(Current.Table->Erase(Current.Row), Current.Row);
+
+            return Entities.Recycle(Entity);
+        }
+
+        constexpr void Clear()
+        {
+            for (const ArchetypePointer& Current : Archetypes)
+            {
+                Current->Clear();
+            }
+
+            Entities.Recycle();
+        }
+
+        template <Types::Decayed ElementType, typename... Args>
+        constexpr decltype(auto) Emplace(const EntityType Entity, Args&&... Arguments)
+        {
+            EGG_ASSERT(Valid(Entity), "Invalid entity");
+            EGG_ASSERT(!Contains<ElementType>(Entity), "Entity already has the element");
+
+            const Types::IDType ID { GetHashFor<ElementType>() };
+
+            Location& Current { GetLocation(Entity) };
+            ArchetypeType& Target { GetAddTarget(*Current.Table, Containers::Internal::GetColumnInfo<ElementType, EntityType>(ID)) };
+            const std::size_t Row { Target.Push(Entity) };
+
+            if constexpr (!Containers::OptimizableElement<ElementType, EntityType>)
+            {
+                auto* Element { static_cast<ElementType*>(Target.GetAddress(Target.GetColumnIndex(ID), Row)) };
+
+                try
+                {
+                    if constexpr (std::is_aggregate_v<ElementType>)
+                    {
+                        std::construct_at(Element, ElementType { std::forward<Args>(Arguments)... });
+                    }
+                    else
+                    {
+                        std::construct_at(Element, std::forward<Args>(Arguments)...);
+                    }
+                }
+                catch (...)
+                {
+                    Target.Extract(Row);
+                    throw;
+                }
+            }
+
+            Current.Table->MoveTo(Current.Row, Target, Row);
+            UpdateMoved(Current.Table->Extract(Current.Row), Current.Row);
+            Current = Location { &Target, Row };
+
+            if constexpr (!Containers::OptimizableElement<ElementType, EntityType>)
+            {
+                return Get<ElementType>(Entity);
+            }
+        }
+
+        template <Types::Decayed ElementType>
+        constexpr void Erase(const EntityType Entity)
+        {
+            EGG_ASSERT(Valid(Entity), "Invalid entity");
+            EGG_ASSERT(Contains<ElementType>(Entity), "Entity does not have the element");
+
+            Location& Current { GetLocation(Entity) };
+            ArchetypeType& Target { GetRemoveTarget(*Current.Table, GetHashFor<ElementType>()) };
+            const std::size_t Row { Target.Push(Entity) };
+
+            Current.Table->MoveTo(Current.Row, Target, Row);
+            UpdateMoved(Current.Table->Extract(Current.Row), Current.Row);
+            Current = Location { &Target, Row };
+        }
+
+        template <Types::Decayed ElementType> requires (!Containers::OptimizableElement<ElementType, EntityParameter>)
+        [[nodiscard]] constexpr ElementType& Get(const EntityType Entity)
+        {
+            return const_cast<ElementType&>(std::as_const(*this).template Get<ElementType>(Entity));
+        }
+
+        template <Types::Decayed ElementType> requires (!Containers::OptimizableElement<ElementType, EntityParameter>)
+        [[nodiscard]] constexpr const ElementType& Get(const EntityType Entity) const
+        {
+            EGG_ASSERT(Contains<ElementType>(Entity), "Entity does not have the element");
+
+            const Location& Current { GetLocation(Entity) };
+            return *std::launder(static_cast<const ElementType*>(
+                Current.Table->GetAddress(Current.Table->GetColumnIndex(GetHashFor<ElementType>()), Current.Row)
+            ));
+        }
+
+        template <Types::Decayed... ElementTypes>
+        [[nodiscard]] constexpr bool Contains(const EntityType Entity) const noexcept
+        {
+            return Valid(Entity) && (GetLocation(Entity).Table->Contains(GetHashFor<ElementTypes>()) && ...);
+        }
+
+        template <typename... OwnTypes, typename... ViewTypes, typename... ExcludeTypes>
+        [[nodiscard]] constexpr
+        Containers::ArchetypeGroup<OwnType<OwnTypes...>, ViewType<ViewTypes...>, ExcludeType<ExcludeTypes...>, EntityType, AllocatorType>
+        Group(ViewType<ViewTypes...> = ViewType {}, ExcludeType<ExcludeTypes...> = ExcludeType {})
+        {
+            using GroupType = Containers::ArchetypeGroup<
+                OwnType<OwnTypes...>,
+                ViewType<ViewTypes...>,
+                ExcludeType<ExcludeTypes...>,
+                EntityType,
+                AllocatorType
+            >;
+
+            const auto [It, Inserted] { Queries.TryEmplace(GetHashFor<GroupType>()) };
+
+            if (Inserted)
+            {
+                const std::array<Types::IDType, sizeof...(OwnTypes) + sizeof...(ViewTypes)> Includes {
+                    GetHashFor<std::remove_const_t<OwnTypes>>()...,
+                    GetHashFor<std::remove_const_t<ViewTypes>>()...
+                };
+
+                const std::array<Types::IDType, sizeof...(ExcludeTypes)> Excludes {
+                    GetHashFor<std::remove_const_t<ExcludeTypes>>()...
+                };
+
+                It->second = std::allocate_shared<QueryType>(GetAllocator(), Includes, Excludes, GetAllocator());
+
+                for (const ArchetypePointer& Current : Archetypes)
+                {
+                    It->second->TryAdd(*Current);
+                }
+            }
+
+            return GroupType { *It->second };
+        }
+
+        [[nodiscard]] constexpr std::size_t GetArchetypesCount() const noexcept
+        {
+            return Archetypes.size();
+        }
+
+        [[nodiscard]] constexpr AllocatorType GetAllocator() const noexcept
+        {
+            return Entities.GetAllocator();
+        }
+
+    private:
+        template <typename Type>
+        [[nodiscard]] static constexpr Types::IDType GetHashFor()
+        {
+            return Types::TypeInfo<Type>::template GetID<ArchetypeRegistry>();
+        }
+
+        [[nodiscard]] constexpr ArchetypeType* GetRoot() const noexcept
+        {
+            return Archetypes.front().get();
+        }
+
+        [[nodiscard]] constexpr Location& GetLocation(const EntityType Entity) noexcept
+        {
+            return Locations[EntityTraitsType::ToEntity(Entity)];
+        }
+
+        [[nodiscard]] constexpr const Location& GetLocation(const EntityType Entity) const noexcept
+        {
+            return Locations[EntityTraitsType::ToEntity(Entity)];
+        }
+
+        constexpr void UpdateMoved(const EntityType Moved, const std::size_t Row) noexcept
+        {
+            if (Moved != EntityTraitsType::Tombstone)
+            {
+                GetLocation(Moved).Row = Row;
+            }
+        }
+
+        constexpr ArchetypeType& GetAddTarget(ArchetypeType& Source, const ColumnType& Column)
+        {
+            if (ArchetypeType* Edge { Source.GetAddEdge(Column.ID) })
+            {
+                return *Edge;
+            }
+
+            VectorFor<ColumnType> Signature { Source.GetColumns().begin(), Source.GetColumns().end(), GetAllocator() };
+            Signature.insert(std::ranges::upper_bound(Signature, Column.ID, {}, &ColumnType::ID), Column);
+
+            ArchetypeType& Target { FindOrCreateArchetype(Signature) };
+            Source.SetAddEdge(Column.ID, Target);
+            return Target;
+        }
+
+        constexpr ArchetypeType& GetRemoveTarget(ArchetypeType& Source, const Types::IDType ID)
+        {
+            if (ArchetypeType* Edge { Source.GetRemoveEdge(ID) })
+            {
+                return *Edge;
+            }
+
+            VectorFor<ColumnType> Signature { GetAllocator() };
+            std::ranges::copy_if(Source.GetColumns(), std::back_inserter(Signature), [ID](const ColumnType& Column) constexpr
+            {
+                return Column.ID != ID;
+            });
+
+            ArchetypeType& Target { FindOrCreateArchetype(Signature) };
+            Target.SetAddEdge(ID, Source);
+            return Target;
+        }
+
+        constexpr ArchetypeType& FindOrCreateArchetype(const std::span<const ColumnType> Signature)
+        {
+            for (const ArchetypePointer& Current : Archetypes)
+            {
+                if (std::ranges::equal(Current->GetColumns(), Signature, {}, &ColumnType::ID, &ColumnType::ID))
+                {
+                    return *Current;
+                }
+            }
+
+            return CreateArchetype(Signature);
+        }
+
+        constexpr ArchetypeType& CreateArchetype(const std::span<const ColumnType> Signature)
+        {
+            ArchetypeType& Created { *Archetypes.emplace_back(Memory::AllocateUnique<ArchetypeType>(GetAllocator(), Signature, GetAllocator())) };
+
+            for (auto&& Query : Queries | std::views::values)
+            {
+                Query->TryAdd(Created);
+            }
+
+            return Created;
+        }
+
+        RecyclerType Entities;
+        VectorFor<Location> Locations;
+        VectorFor<ArchetypePointer> Archetypes;
+        QueryContainerType Queries;
+    };
+}
+
+#endif // ENGINE_SOURCES_ECS_FILE_ARCHETYPE_REGISTRY_H
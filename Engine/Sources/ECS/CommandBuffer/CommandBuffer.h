@@ -0,0 +1,407 @@
+#ifndef ENGINE_SOURCES_ECS_COMMAND_BUFFER_FILE_COMMAND_BUFFER_H
+#define ENGINE_SOURCES_ECS_COMMAND_BUFFER_FILE_COMMAND_BUFFER_H
+
+#include "./Internal/CommandArena.h"
+
+#include <Config/Config.h>
+#include <Containers/DenseMap/DenseMap.h>
+#include <ECS/Registry.h>
+#include <ECS/Containers/Storage/Storage.h>
+#include <ECS/Containers/Traits/PoolTraits.h>
+#include <ECS/Traits/EntityTraits.h>
+#include <Types/Capabilities/Capabilities.h>
+#include <Types/TypeInfo/TypeInfo.h>
+
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace egg::ECS
+{
+    template <Types::InstanceOf<Registry> RegistryParameter>
+    class CommandBuffer final
+    {
+        using BufferAllocatorTraits = std::allocator_traits<typename RegistryParameter::AllocatorType>;
+
+        template <typename Type>
+        using VectorFor = std::vector<Type, typename BufferAllocatorTraits::template rebind_alloc<Type>>;
+
+        using PoolBaseType = typename Containers::PoolTraits<
+            typename RegistryParameter::EntityType,
+            typename RegistryParameter::AllocatorType
+        >::SparseSetType;
+
+        using ArenaType = Internal::CommandArena<typename BufferAllocatorTraits::template rebind_alloc<std::byte>>;
+
+        using EntityTraitsType = EntityTraits<typename RegistryParameter::EntityType>;
+
+        static constexpr std::size_t ResolvedEntity { std::numeric_limits<std::size_t>::max() };
+
+        using AssureType = PoolBaseType& (*)(RegistryParameter&);
+
+        struct Command
+        {
+            void (*Apply)(PoolBaseType&, typename RegistryParameter::EntityType, void*);
+            void (*Discard)(void*);
+            void* Payload;
+            typename RegistryParameter::EntityType Entity;
+            std::size_t Pending;
+        };
+
+        struct Batch
+        {
+            Types::IDType PoolID;
+            AssureType Assure;
+            VectorFor<Command> Commands;
+        };
+
+        using BatchIndicesType = egg::Containers::DenseMap<
+            Types::IDType, std::size_t, std::identity, std::equal_to<>,
+            typename BufferAllocatorTraits::template rebind_alloc<std::pair<const Types::IDType, std::size_t>>
+        >;
+
+    public:
+        using RegistryType = RegistryParameter;
+        using AllocatorType = typename RegistryType::AllocatorType;
+        using EntityType = typename RegistryType::EntityType;
+
+        struct PendingEntity
+        {
+            std::size_t Index;
+        };
+
+        template <typename Type>
+        static constexpr bool ValidTarget { std::same_as<Type, EntityType> || std::same_as<Type, PendingEntity> };
+
+
+        explicit CommandBuffer(RegistryType& Registry)
+            : Owner { &Registry },
+              Arena { Registry.GetAllocator() },
+              Batches { Registry.GetAllocator() },
+              BatchIndices { Registry.GetAllocator() },
+              Destroyed { Registry.GetAllocator() },
+              Created { Registry.GetAllocator() },
+              PendingCount {},
+              CommandsCount {}
+        {
+        }
+
+        CommandBuffer(const CommandBuffer&) = delete;
+
+        CommandBuffer(CommandBuffer&&) noexcept = default;
+
+        ~CommandBuffer() noexcept
+        {
+            Clear();
+        }
+
+        CommandBuffer& operator=(const CommandBuffer&) = delete;
+
+        CommandBuffer& operator=(CommandBuffer&& Other) noexcept
+        {
+            if (this != &Other)
+            {
+                Clear();
+                Owner = Other.Owner;
+                Arena = std::move(Other.Arena);
+                Batches = std::move(Other.Batches);
+                BatchIndices = std::move(Other.BatchIndices);
+                Destroyed = std::move(Other.Destroyed);
+                Created = std::move(Other.Created);
+                PendingCount = std::exchange(Other.PendingCount, 0u);
+                CommandsCount = std::exchange(Other.CommandsCount, 0u);
+            }
+
+            return *this;
+        }
+
+        [[nodiscard]] PendingEntity Create() noexcept
+        {
+            return PendingEntity { PendingCount++ };
+        }
+
+        void Destroy(const EntityType Entity)
+        {
+            Destroyed.push_back(Entity);
+        }
+
+        template <Types::Decayed ElementType, typename TargetType, typename... Args> requires ValidTarget<TargetType>
+        void Emplace(const TargetType Target, Args&&... Arguments)
+        {
+            using PoolType = typename RegistryType::template PoolFor<ElementType>;
+
+            if constexpr (Containers::OptimizableElement<ElementType, EntityType>)
+            {
+                Record<ElementType>(Target, nullptr, [](PoolBaseType& Pool, const EntityType Entity, void*)
+                {
+                    static_cast<PoolType&>(Pool).Push(Entity);
+                });
+            }
+            else
+            {
+                Record<ElementType, ElementType>(
+                    Target,
+                    Store<ElementType>(std::forward<Args>(Arguments)...),
+                    [](PoolBaseType& Pool, const EntityType Entity, void* Payload)
+                    {
+                        ElementType& Element { *static_cast<ElementType*>(Payload) };
+                        static_cast<PoolType&>(Pool).Emplace(Entity, std::move(Element));
+                        std::destroy_at(&Element);
+                    });
+            }
+        }
+
+        template <Types::Decayed ElementType, typename TargetType> requires ValidTarget<TargetType>
+        void Erase(const TargetType Target)
+        {
+            Record<ElementType>(Target, nullptr, [](PoolBaseType& Pool, const EntityType Entity, void*)
+            {
+                Pool.Erase(Entity);
+            });
+        }
+
+        template <Types::Decayed ElementType, typename TargetType, typename CallableType> requires
+            ValidTarget<TargetType> &&
+            (!Containers::OptimizableElement<ElementType, EntityType>) &&
+            std::invocable<std::decay_t<CallableType>&, ElementType&>
+        void Patch(const TargetType Target, CallableType&& Callable)
+        {
+            using PoolType = typename RegistryType::template PoolFor<ElementType>;
+            using StoredType = std::decay_t<CallableType>;
+
+            Record<ElementType, StoredType>(
+                Target,
+                Store<StoredType>(std::forward<CallableType>(Callable)),
+                [](PoolBaseType& Pool, const EntityType Entity, void* Payload)
+                {
+                    StoredType& Stored { *static_cast<StoredType*>(Payload) };
+                    static_cast<PoolType&>(Pool).Patch(Entity, Stored);
+                    std::destroy_at(&Stored);
+                });
+        }
+
+        std::size_t Splice(CommandBuffer& Other)
+        {
+            EGG_ASSERT(Owner == Other.Owner, "Command buffers are bound to different registries");
+
+            Arena.Adopt(std::move(Other.Arena));
+
+            for (Batch& Source : Other.Batches)
+            {
+                VectorFor<Command>& Target { GetBatch(Source.PoolID, Source.Assure).Commands };
+                Target.reserve(Target.size() + Source.Commands.size());
+
+                for (Command Current : Source.Commands)
+                {
+                    if (Current.Pending != ResolvedEntity)
+                    {
+                        Current.Pending += PendingCount;
+                    }
+
+                    Target.push_back(Current);
+                }
+
+                Source.Commands.clear();
+            }
+
+            Destroyed.insert(Destroyed.end(), Other.Destroyed.begin(), Other.Destroyed.end());
+            const std::size_t Offset { std::exchange(PendingCount, PendingCount + std::exchange(Other.PendingCount, 0u)) };
+            CommandsCount += std::exchange(Other.CommandsCount, 0u);
+
+            Other.Destroyed.clear();
+            return Offset;
+        }
+
+        void Flush()
+        {
+            Created.resize(PendingCount);
+            Owner->Create(Created.begin(), Created.end());
+
+            auto Current { Batches.begin() };
+            typename VectorFor<Command>::iterator First {};
+
+            try
+            {
+                for (; Current != Batches.end(); ++Current)
+                {
+                    First = Current->Commands.begin();
+
+                    if (First == Current->Commands.end())
+                    {
+                        continue;
+                    }
+
+                    PoolBaseType& Pool { Current->Assure(*Owner) };
+
+                    for (; First != Current->Commands.end(); ++First)
+                    {
+                        const EntityType Entity { First->Pending == ResolvedEntity ? First->Entity : Created[First->Pending] };
+                        First->Apply(Pool, Entity, First->Payload);
+                    }
+                }
+            }
+            catch (...)
+            {
+                Discard(First, Current->Commands.end());
+
+                while (++Current != Batches.end())
+                {
+                    Discard(Current->Commands.begin(), Current->Commands.end());
+                }
+
+                Reset();
+                throw;
+            }
+
+            std::ranges::sort(Destroyed);
+            const auto Unique { std::ranges::unique(Destroyed) };
+            const auto Valid { std::ranges::remove_if(Destroyed.begin(), Unique.begin(), [this](const EntityType Entity)
+            {
+                return !Owner->Valid(Entity);
+            }) };
+            Owner->Destroy(Destroyed.begin(), Valid.begin());
+
+            Reset();
+        }
+
+        void Clear() noexcept
+        {
+            for (Batch& Current : Batches)
+            {
+                Discard(Current.Commands.begin(), Current.Commands.end());
+            }
+
+            Reset();
+            Created.clear();
+        }
+
+        [[nodiscard]] EntityType Resolve(const PendingEntity Entity) const noexcept
+        {
+            EGG_ASSERT(Entity.Index < Created.size(), "Pending entity has not been flushed");
+            return Created[Entity.Index];
+        }
+
+        [[nodiscard]] std::size_t GetSize() const noexcept
+        {
+            return CommandsCount + Destroyed.size() + PendingCount;
+        }
+
+        [[nodiscard]] bool Empty() const noexcept
+        {
+            return !GetSize();
+        }
+
+        [[nodiscard]] RegistryType& GetRegistry() const noexcept
+        {
+            return *Owner;
+        }
+
+    private:
+        template <typename Type, typename... Args>
+        [[nodiscard]] Type* Store(Args&&... Arguments)
+        {
+            return std::construct_at(static_cast<Type*>(Arena.Allocate(sizeof(Type), alignof(Type))), std::forward<Args>(Arguments)...);
+        }
+
+        [[nodiscard]] Batch& GetBatch(const Types::IDType PoolID, const AssureType Assure)
+        {
+            const auto [It, Inserted] { BatchIndices.TryEmplace(PoolID, Batches.size()) };
+
+            if (Inserted)
+            {
+                try
+                {
+                    Batches.push_back(Batch { PoolID, Assure, VectorFor<Command> { Owner->GetAllocator() } });
+                }
+                catch (...)
+                {
+                    BatchIndices.Erase(PoolID);
+                    throw;
+                }
+            }
+
+            return Batches[It->second];
+        }
+
+        template <typename ElementType, typename StoredType = void, typename TargetType, typename ApplyType>
+        void Record(const TargetType Target, void* Payload, const ApplyType Apply)
+        {
+            Command Current { Apply, nullptr, Payload, EntityTraitsType::Tombstone, ResolvedEntity };
+
+            if constexpr (!std::is_void_v<StoredType> && !std::is_trivially_destructible_v<StoredType>)
+            {
+                Current.Discard = [](void* Stored)
+                {
+                    std::destroy_at(static_cast<StoredType*>(Stored));
+                };
+            }
+
+            if constexpr (std::same_as<TargetType, PendingEntity>)
+            {
+                EGG_ASSERT(Target.Index < PendingCount, "Unknown pending entity");
+                Current.Pending = Target.Index;
+            }
+            else
+            {
+                Current.Entity = Target;
+            }
+
+            try
+            {
+                GetBatch(RegistryType::template GetPoolID<ElementType>(), [](RegistryType& Registry) -> PoolBaseType&
+                {
+                    return Registry.template GetPoolFor<ElementType>();
+                }).Commands.push_back(Current);
+            }
+            catch (...)
+            {
+                if (Current.Discard) Current.Discard(Payload);
+                throw;
+            }
+
+            ++CommandsCount;
+        }
+
+        template <typename IteratorType>
+        static void Discard(IteratorType First, const IteratorType Last) noexcept
+        {
+            for (; First != Last; ++First)
+            {
+                if (First->Discard && First->Payload)
+                {
+                    First->Discard(First->Payload);
+                }
+            }
+        }
+
+        void Reset() noexcept
+        {
+            for (Batch& Current : Batches)
+            {
+                Current.Commands.clear();
+            }
+
+            Destroyed.clear();
+            PendingCount = 0u;
+            CommandsCount = 0u;
+            Arena.Reset();
+        }
+
+        RegistryType* Owner;
+        ArenaType Arena;
+        VectorFor<Batch> Batches;
+        BatchIndicesType BatchIndices;
+        VectorFor<EntityType> Destroyed;
+        VectorFor<EntityType> Created;
+        std::size_t PendingCount;
+        std::size_t CommandsCount;
+    };
+}
+
+#endif // ENGINE_SOURCES_ECS_COMMAND_BUFFER_FILE_COMMAND_BUFFER_H
@@ -0,0 +1,155 @@
+#ifndef ENGINE_SOURCES_ECS_COMMAND_BUFFER_INTERNAL_FILE_COMMAND_ARENA_H
+#define ENGINE_SOURCES_ECS_COMMAND_BUFFER_INTERNAL_FILE_COMMAND_ARENA_H
+
+#include <Config/Config.h>
+#include <Types/Capabilities/Capabilities.h>
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace egg::ECS::Internal
+{
+    template <Types::ValidAllocator<std::byte> AllocatorParameter>
+    class CommandArena final
+    {
+        using ArenaAllocatorTraits = std::allocator_traits<AllocatorParameter>;
+
+        struct Block
+        {
+            std::byte* Data;
+            std::size_t Size;
+        };
+
+        using BlocksType = std::vector<Block, typename ArenaAllocatorTraits::template rebind_alloc<Block>>;
+
+    public:
+        using AllocatorType = AllocatorParameter;
+
+        static constexpr std::size_t BlockSize { 64u * 1024u };
+
+
+        constexpr explicit CommandArena(const AllocatorType& Allocator = {})
+            : Allocator { Allocator },
+              Blocks { Allocator },
+              Current {},
+              Offset {}
+        {
+        }
+
+        CommandArena(const CommandArena&) = delete;
+
+        constexpr CommandArena(CommandArena&& Other) noexcept
+            : Allocator { Other.Allocator },
+              Blocks { std::move(Other.Blocks) },
+              Current { std::exchange(Other.Current, 0u) },
+              Offset { std::exchange(Other.Offset, 0u) }
+        {
+        }
+
+        constexpr ~CommandArena() noexcept
+        {
+            Release();
+        }
+
+        CommandArena& operator=(const CommandArena&) = delete;
+
+        constexpr CommandArena& operator=(CommandArena&& Other) noexcept
+        {
+            if (this != &Other)
+            {
+                Release();
+                Allocator = Other.Allocator;
+                Blocks = std::move(Other.Blocks);
+                Current = std::exchange(Other.Current, 0u);
+                Offset = std::exchange(Other.Offset, 0u);
+            }
+
+            return *this;
+        }
+
+        [[nodiscard]] void* Allocate(const std::size_t Size, const std::size_t Alignment)
+        {
+            EGG_ASSERT(std::has_single_bit(Alignment), "Alignment must be a power of two");
+
+            while (true)
+            {
+                if (Current == Blocks.size())
+                {
+                    const std::size_t Capacity { std::max(BlockSize, Size + Alignment) };
+                    Blocks.push_back(Block { ArenaAllocatorTraits::allocate(Allocator, Capacity), Capacity });
+                }
+
+                const Block& Target { Blocks[Current] };
+                const std::uintptr_t Address { reinterpret_cast<std::uintptr_t>(Target.Data) + Offset };
+                const std::size_t Padding { (Alignment - Address % Alignment) % Alignment };
+
+                if (Offset + Padding + Size <= Target.Size)
+                {
+                    void* Result { Target.Data + Offset + Padding };
+                    Offset += Padding + Size;
+                    return Result;
+                }
+
+                ++Current;
+                Offset = 0u;
+            }
+        }
+
+        void Adopt(CommandArena&& Other)
+        {
+            EGG_ASSERT(ArenaAllocatorTraits::is_always_equal::value || Allocator == Other.Allocator,
+                       "Cannot adopt blocks from an arena with an incompatible allocator");
+
+            const std::size_t Used { std::min(Other.Current + (Other.Offset != 0u), Other.Blocks.size()) };
+            const auto First { Other.Blocks.begin() };
+
+            Blocks.insert(Blocks.begin() + static_cast<std::ptrdiff_t>(Current), First, First + static_cast<std::ptrdiff_t>(Used));
+            Other.Blocks.erase(First, First + static_cast<std::ptrdiff_t>(Used));
+
+            Current += Used;
+            Other.Reset();
+        }
+
+        constexpr void Reset() noexcept
+        {
+            Current = 0u;
+            Offset = 0u;
+        }
+
+        [[nodiscard]] constexpr std::size_t GetCapacity() const noexcept
+        {
+            std::size_t Capacity {};
+
+            for (const Block& Target : Blocks)
+            {
+                Capacity += Target.Size;
+            }
+
+            return Capacity;
+        }
+
+    private:
+        constexpr void Release() noexcept
+        {
+            for (const Block& Target : Blocks)
+            {
+                ArenaAllocatorTraits::deallocate(Allocator, Target.Data, Target.Size);
+            }
+
+            Blocks.clear();
+            Reset();
+        }
+
+        AllocatorType Allocator;
+        BlocksType Blocks;
+        std::size_t Current;
+        std::size_t Offset;
+    };
+}
+
+#endif // ENGINE_SOURCES_ECS_COMMAND_BUFFER_INTERNAL_FILE_COMMAND_ARENA_H
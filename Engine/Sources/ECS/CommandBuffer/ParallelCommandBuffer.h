@@ -0,0 +1,132 @@
+#ifndef ENGINE_SOURCES_ECS_COMMAND_BUFFER_FILE_PARALLEL_COMMAND_BUFFER_H
+#define ENGINE_SOURCES_ECS_COMMAND_BUFFER_FILE_PARALLEL_COMMAND_BUFFER_H
+
+#include "./CommandBuffer.h"
+
+#include <Jobs/JobPool/JobPool.h>
+#include <Memory/Constants.h>
+#include <Types/Capabilities/Capabilities.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <thread>
+#include <vector>
+
+namespace egg::ECS
+{
+    template <Types::InstanceOf<Registry> RegistryParameter>
+    class ParallelCommandBuffer final
+    {
+        using CommandBufferType = CommandBuffer<RegistryParameter>;
+
+        struct alignas(Memory::CacheLineSize) Slot
+        {
+            CommandBufferType Buffer;
+            std::size_t Offset;
+        };
+
+    public:
+        using RegistryType = RegistryParameter;
+        using PendingEntity = typename CommandBufferType::PendingEntity;
+        using EntityType = typename CommandBufferType::EntityType;
+
+
+        ParallelCommandBuffer(RegistryType& Registry, Jobs::JobPool& Pool) : Pool { &Pool }, ExternalOwner {}
+        {
+            Slots.reserve(Pool.GetConcurrency());
+
+            for (std::size_t Index = 0u; Index < Pool.GetConcurrency(); ++Index)
+            {
+                Slots.push_back(Slot { CommandBufferType { Registry }, 0u });
+            }
+        }
+
+        //Every thread outside the job pool shares the last slot, so only one of them may record between flushes
+        [[nodiscard]] CommandBufferType& GetLocal() noexcept
+        {
+            const std::size_t Index { Pool->GetThreadIndex() };
+
+            if (Index == Pool->GetWorkersCount())
+            {
+                const std::thread::id Current { std::this_thread::get_id() };
+                std::thread::id Owner { ExternalOwner.load(std::memory_order_relaxed) };
+
+                if (Owner != Current)
+                {
+                    const bool Claimed { Owner == std::thread::id {} && ExternalOwner.compare_exchange_strong(Owner, Current) };
+                    EGG_ASSERT(Claimed, "Only one thread outside the job pool can record between flushes");
+                    static_cast<void>(Claimed);
+                }
+            }
+
+            return Slots[Index].Buffer;
+        }
+
+        void Flush()
+        {
+            CommandBufferType& Target { Slots.front().Buffer };
+
+            for (std::size_t Index = 1u; Index < Slots.size(); ++Index)
+            {
+                Slots[Index].Offset = Target.Splice(Slots[Index].Buffer);
+            }
+
+            Target.Flush();
+
+            for (std::size_t Index = 1u; Index < Slots.size(); ++Index)
+            {
+                Slots[Index].Buffer.Clear();
+            }
+
+            ExternalOwner.store(std::thread::id {}, std::memory_order_relaxed);
+        }
+
+        void Clear() noexcept
+        {
+            for (Slot& Current : Slots)
+            {
+                Current.Buffer.Clear();
+            }
+
+            ExternalOwner.store(std::thread::id {}, std::memory_order_relaxed);
+        }
+
+        [[nodiscard]] std::thread::id GetExternalOwner() const noexcept
+        {
+            return ExternalOwner.load(std::memory_order_relaxed);
+        }
+
+        [[nodiscard]] EntityType Resolve(const CommandBufferType& Local, const PendingEntity Entity) const noexcept
+        {
+            const auto Owner { std::ranges::find_if(Slots, [&Local](const Slot& Current) { return &Current.Buffer == &Local; }) };
+            EGG_ASSERT(Owner != Slots.end(), "Command buffer does not belong to this parallel command buffer");
+
+            return Slots.front().Buffer.Resolve(PendingEntity { Owner->Offset + Entity.Index });
+        }
+
+        [[nodiscard]] std::size_t GetSize() const noexcept
+        {
+            std::size_t Size {};
+
+            for (const Slot& Current : Slots)
+            {
+                Size += Current.Buffer.GetSize();
+            }
+
+            return Size;
+        }
+
+        [[nodiscard]] bool Empty() const noexcept
+        {
+            return !GetSize();
+        }
+
+    private:
+        Jobs::JobPool* Pool;
+        std::vector<Slot> Slots;
+        std::atomic<std::thread::id> ExternalOwner;
+    };
+}
+
+#endif // ENGINE_SOURCES_ECS_COMMAND_BUFFER_FILE_PARALLEL_COMMAND_BUFFER_H
@@ -0,0 +1,291 @@
+#ifndef ENGINE_SOURCES_ECS_CONTAINERS_ARCHETYPE_FILE_ARCHETYPE_H
+#define ENGINE_SOURCES_ECS_CONTAINERS_ARCHETYPE_FILE_ARCHETYPE_H
+
+#include "./Internal/ColumnInfo.h"
+
+#include <Config/Config.h>
+#include <Containers/DenseMap/DenseMap.h>
+#include <ECS/Entity.h>
+#include <Memory/Constants.h>
+#include <Types/Types.h>
+#include <Types/Capabilities/Capabilities.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <span>
+#include <vector>
+
+namespace egg::ECS::Containers
+{
+    template <ValidEntity EntityParameter, Types::ValidAllocator<EntityParameter> AllocatorParameter = std::allocator<EntityParameter>>
+    class Archetype final
+    {
+        struct alignas(Memory::CacheLineSize) ChunkBlock
+        {
+            std::byte Bytes[Memory::CacheLineSize];
+        };
+
+        using ArchetypeAllocatorTraits = std::allocator_traits<AllocatorParameter>;
+
+        using ChunkAllocatorType = typename ArchetypeAllocatorTraits::template rebind_alloc<ChunkBlock>;
+        using ChunkAllocatorTraits = std::allocator_traits<ChunkAllocatorType>;
+
+        template <typename Type>
+        using VectorFor = std::vector<Type, typename ArchetypeAllocatorTraits::template rebind_alloc<Type>>;
+
+        using EdgesType = egg::Containers::DenseMap<
+            Types::IDType, Archetype*, std::identity, std::equal_to<>,
+            typename ArchetypeAllocatorTraits::template rebind_alloc<std::pair<const Types::IDType, Archetype*>>
+        >;
+
+        using TraitsType = EntityTraits<EntityParameter>;
+
+    public:
+        using AllocatorType = AllocatorParameter;
+        using EntityType = EntityParameter;
+        using ColumnType = Internal::ColumnInfo;
+
+        static constexpr std::size_t NoColumn { std::numeric_limits<std::size_t>::max() };
+
+
+        constexpr Archetype(const std::span<const ColumnType> Signature, const AllocatorType& Allocator)
+            : Columns { Signature.begin(), Signature.end(), Allocator },
+              Offsets(Signature.size(), Allocator),
+              Chunks { Allocator },
+              AddEdges { Allocator },
+              RemoveEdges { Allocator },
+              ChunkAllocator { Allocator },
+              Capacity {},
+              ChunkBlocks {},
+              Size {}
+        {
+            EGG_ASSERT(std::ranges::is_sorted(Columns, {}, &ColumnType::ID), "Archetype signature must be sorted by identifier");
+
+            std::size_t RowBytes { sizeof(EntityType) };
+            std::size_t Padding {};
+
+            for (const ColumnType& Column : Columns)
+            {
+                RowBytes += Column.Size;
+                Padding += Column.Alignment;
+            }
+
+            Capacity = std::max(
+                (Memory::PageSizeInBytes - std::min(Padding, Memory::PageSizeInBytes)) / RowBytes,
+                std::size_t { 1u }
+            );
+
+            std::size_t Offset { Capacity * sizeof(EntityType) };
+
+            for (std::size_t Index = 0u; Index < Columns.size(); ++Index)
+            {
+                Offset = (Offset + Columns[Index].Alignment - 1u) / Columns[Index].Alignment * Columns[Index].Alignment;
+                Offsets[Index] = Offset;
+                Offset += Capacity * Columns[Index].Size;
+            }
+
+            ChunkBlocks = (Offset + Memory::CacheLineSize - 1u) / Memory::CacheLineSize;
+        }
+
+        Archetype(const Archetype&) = delete;
+
+        Archetype(Archetype&&) = delete;
+
+        constexpr ~Archetype()
+        {
+            Clear();
+
+            for (ChunkBlock* Chunk : Chunks)
+            {
+                ChunkAllocatorTraits::deallocate(ChunkAllocator, Chunk, ChunkBlocks);
+            }
+        }
+
+        Archetype& operator=(const Archetype&) = delete;
+
+        Archetype& operator=(Archetype&&) = delete;
+
+        constexpr std::size_t Push(const EntityType Entity)
+        {
+            if (Size == Chunks.size() * Capacity)
+            {
+                Chunks.push_back(ChunkAllocatorTraits::allocate(ChunkAllocator, ChunkBlocks));
+            }
+
+            GetEntities(Size / Capacity)[Size % Capacity] = Entity;
+            return Size++;
+        }
+
+        constexpr EntityType Erase(const std::size_t Row)
+        {
+            EGG_ASSERT(Row < Size, "Row is out of range");
+
+            for (std::size_t Index = 0u; Index < Columns.size(); ++Index)
+            {
+                if (Columns[Index].Size)
+                {
+                    Columns[Index].Destroy(GetAddress(Index, Row));
+                }
+            }
+
+            return Extract(Row);
+        }
+
+        constexpr EntityType Extract(const std::size_t Row)
+        {
+            EGG_ASSERT(Row < Size, "Row is out of range");
+
+            const std::size_t Last { --Size };
+
+            if (Row == Last)
+            {
+                return TraitsType::Tombstone;
+            }
+
+            for (std::size_t Index = 0u; Index < Columns.size(); ++Index)
+            {
+                if (Columns[Index].Size)
+                {
+                    Columns[Index].Relocate(GetAddress(Index, Row), GetAddress(Index, Last));
+                }
+            }
+
+            const EntityType Moved { GetEntity(Last) };
+            GetEntities(Row / Capacity)[Row % Capacity] = Moved;
+            return Moved;
+        }
+
+        constexpr void MoveTo(const std::size_t Row, Archetype& Target, const std::size_t TargetRow)
+        {
+            EGG_ASSERT(Target.GetEntity(TargetRow) == GetEntity(Row), "Target row belongs to another entity");
+
+            for (std::size_t Index = 0u; Index < Columns.size(); ++Index)
+            {
+                if (!Columns[Index].Size)
+                {
+                    continue;
+                }
+
+                if (const std::size_t TargetIndex { Target.GetColumnIndex(Columns[Index].ID) }; TargetIndex != NoColumn)
+                {
+                    Columns[Index].Relocate(Target.GetAddress(TargetIndex, TargetRow), GetAddress(Index, Row));
+                }
+                else
+                {
+                    Columns[Index].Destroy(GetAddress(Index, Row));
+                }
+            }
+        }
+
+        constexpr void Clear()
+        {
+            for (std::size_t Row = 0u; Row < Size; ++Row)
+            {
+                for (std::size_t Index = 0u; Index < Columns.size(); ++Index)
+                {
+                    if (Columns[Index].Size)
+                    {
+                        Columns[Index].Destroy(GetAddress(Index, Row));
+                    }
+                }
+            }
+
+            Size = 0u;
+        }
+
+        [[nodiscard]] constexpr std::size_t GetColumnIndex(const Types::IDType ID) const noexcept
+        {
+            const auto Found { std::ranges::lower_bound(Columns, ID, {}, &ColumnType::ID) };
+            return Found != Columns.end() && Found->ID == ID ? static_cast<std::size_t>(Found - Columns.begin()) : NoColumn;
+        }
+
+        [[nodiscard]] constexpr bool Contains(const Types::IDType ID) const noexcept
+        {
+            return GetColumnIndex(ID) != NoColumn;
+        }
+
+        [[nodiscard]] constexpr std::span<const ColumnType> GetColumns() const noexcept
+        {
+            return Columns;
+        }
+
+        [[nodiscard]] constexpr void* GetAddress(const std::size_t Column, const std::size_t Row) const noexcept
+        {
+            return GetColumn(Column, Row / Capacity) + (Row % Capacity) * Columns[Column].Size;
+        }
+
+        [[nodiscard]] constexpr std::byte* GetColumn(const std::size_t Column, const std::size_t Chunk) const noexcept
+        {
+            return Chunks[Chunk]->Bytes + Offsets[Column];
+        }
+
+        [[nodiscard]] constexpr EntityType* GetEntities(const std::size_t Chunk) const noexcept
+        {
+            return reinterpret_cast<EntityType*>(Chunks[Chunk]->Bytes);
+        }
+
+        [[nodiscard]] constexpr EntityType GetEntity(const std::size_t Row) const noexcept
+        {
+            return GetEntities(Row / Capacity)[Row % Capacity];
+        }
+
+        [[nodiscard]] constexpr std::size_t GetChunksCount() const noexcept
+        {
+            return (Size + Capacity - 1u) / Capacity;
+        }
+
+        [[nodiscard]] constexpr std::size_t GetSizeOf(const std::size_t Chunk) const noexcept
+        {
+            return std::min(Size - Chunk * Capacity, Capacity);
+        }
+
+        [[nodiscard]] constexpr std::size_t GetChunkCapacity() const noexcept
+        {
+            return Capacity;
+        }
+
+        [[nodiscard]] constexpr std::size_t GetSize() const noexcept
+        {
+            return Size;
+        }
+
+        [[nodiscard]] constexpr bool Empty() const noexcept
+        {
+            return !Size;
+        }
+
+        [[nodiscard]] constexpr Archetype* GetAddEdge(const Types::IDType ID) const
+        {
+            const auto Found { AddEdges.Find(ID) };
+            return Found != AddEdges.End() ? Found->second : nullptr;
+        }
+
+        [[nodiscard]] constexpr Archetype* GetRemoveEdge(const Types::IDType ID) const
+        {
+            const auto Found { RemoveEdges.Find(ID) };
+            return Found != RemoveEdges.End() ? Found->second : nullptr;
+        }
+
+        constexpr void SetAddEdge(const Types::IDType ID, Archetype& Target)
+        {
+            AddEdges.InsertOrAssign(ID, &Target);
+            Target.RemoveEdges.InsertOrAssign(ID, this);
+        }
+
+    private:
+        VectorFor<ColumnType> Columns;
+        VectorFor<std::size_t> Offsets;
+        VectorFor<ChunkBlock*> Chunks;
+        EdgesType AddEdges;
+        EdgesType RemoveEdges;
+        ChunkAllocatorType ChunkAllocator;
+        std::size_t Capacity;
+        std::size_t ChunkBlocks;
+        std::size_t Size;
+    };
+}
+
+#endif // ENGINE_SOURCES_ECS_CONTAINERS_ARCHETYPE_FILE_ARCHETYPE_H
@@ -0,0 +1,55 @@
+#ifndef ENGINE_SOURCES_ECS_CONTAINERS_ARCHETYPE_INTERNAL_FILE_COLUMN_INFO_H
+#define ENGINE_SOURCES_ECS_CONTAINERS_ARCHETYPE_INTERNAL_FILE_COLUMN_INFO_H
+
+#include <ECS/Entity.h>
+#include <ECS/Containers/Storage/Storage.h>
+#include <Memory/Constants.h>
+#include <Types/Types.h>
+
+#include <cstddef>
+#include <memory>
+#include <utility>
+
+namespace egg::ECS::Containers::Internal
+{
+    struct ColumnInfo
+    {
+        Types::IDType ID;
+        std::size_t Size;
+        std::size_t Alignment;
+        void (*Relocate)(void* To, void* From);
+        void (*Destroy)(void* Target);
+    };
+
+
+    template <typename Type, ValidEntity EntityType>
+    [[nodiscard]] constexpr ColumnInfo GetColumnInfo(const Types::IDType ID) noexcept
+    {
+        if constexpr (OptimizableElement<Type, EntityType>)
+        {
+            return ColumnInfo { ID, 0u, 1u, nullptr, nullptr };
+        }
+        else
+        {
+            static_assert(alignof(Type) <= Memory::CacheLineSize, "Over-aligned types cannot be stored in archetype chunks");
+
+            return ColumnInfo {
+                ID,
+                sizeof(Type),
+                alignof(Type),
+                [](void* To, void* From)
+                {
+                    Type& Source { *static_cast<Type*>(From) };
+                    std::construct_at(static_cast<Type*>(To), std::move(Source));
+                    std::destroy_at(&Source);
+                },
+                [](void* Target)
+                {
+                    std::destroy_at(static_cast<Type*>(Target));
+                }
+            };
+        }
+    }
+}
+
+#endif // ENGINE_SOURCES_ECS_CONTAINERS_ARCHETYPE_INTERNAL_FILE_COLUMN_INFO_H
@@ -0,0 +1,140 @@
+#ifndef ENGINE_SOURCES_ECS_CONTAINERS_ARCHETYPE_GROUP_FILE_ARCHETYPE_GROUP_H
+#define ENGINE_SOURCES_ECS_CONTAINERS_ARCHETYPE_GROUP_FILE_ARCHETYPE_GROUP_H
+
+#include "./Internal/ArchetypeQuery.h"
+
+#include <ECS/Entity.h>
+#include <ECS/Ownership.h>
+#include <ECS/Containers/Archetype/Archetype.h>
+#include <ECS/Containers/Traits/PoolTraits.h>
+#include <Types/Capabilities/Capabilities.h>
+#include <Types/Deduction/Deduction.h>
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <new>
+#include <span>
+#include <tuple>
+#include <type_traits>
+
+namespace egg::ECS::Containers
+{
+    template <
+        Types::InstanceOf<OwnType>, Types::InstanceOf<ViewType>, Types::InstanceOf<ExcludeType>,
+        ValidEntity EntityParameter, Types::ValidAllocator<EntityParameter> = std::allocator<EntityParameter>>
+    class ArchetypeGroup;
+
+
+    template <typename... OwnParameters, typename... ViewParameters, typename... ExcludeParameters,
+              ValidEntity EntityParameter, Types::ValidAllocator<EntityParameter> AllocatorParameter> requires
+        Types::AllTupleUnique<Types::InstantiateTuple<
+            std::remove_const_t,
+            std::tuple<OwnParameters..., ViewParameters..., ExcludeParameters...>
+        >> && (sizeof...(OwnParameters) + sizeof...(ViewParameters) != 0u)
+    class ArchetypeGroup<OwnType<OwnParameters...>, ViewType<ViewParameters...>, ExcludeType<ExcludeParameters...>,
+                         EntityParameter, AllocatorParameter>
+    {
+        using TraitsType = PoolTraits<EntityParameter, AllocatorParameter>;
+
+        using IncludesTuple = std::tuple<OwnParameters..., ViewParameters...>;
+
+        using StorableTypes = Types::FilterTuple<TraitsType::template StorablePredicate, IncludesTuple>;
+
+        using ArgumentsType = typename TraitsType::template StorableTuple<OwnParameters..., ViewParameters...>;
+
+    public:
+        using AllocatorType = AllocatorParameter;
+        using EntityType = EntityParameter;
+
+        using ArchetypeType = Archetype<EntityType, AllocatorType>;
+        using QueryType = Internal::ArchetypeQuery<ArchetypeType>;
+
+
+        constexpr explicit ArchetypeGroup(const QueryType& Query) : Query { Query }
+        {
+        }
+
+        template <typename CallableType> requires
+            Types::Applicable<CallableType&, ArgumentsType> ||
+            Types::Applicable<CallableType&, Types::RemoveTupleType<EntityType, ArgumentsType>>
+        constexpr void Each(CallableType Callable) const
+        {
+            EachChunkPointers([&Callable](const std::size_t Count, const EntityType* Entities, auto*... Elements) constexpr
+            {
+                for (std::size_t Index = 0u; Index < Count; ++Index)
+                {
+                    if constexpr (Types::Applicable<CallableType&, ArgumentsType>)
+                    {
+                        std::invoke(Callable, Entities[Index], Elements[Index]...);
+                    }
+                    else
+                    {
+                        std::invoke(Callable, Elements[Index]...);
+                    }
+                }
+            });
+        }
+
+        template <typename CallableType>
+        constexpr void EachChunk(CallableType Callable) const
+        {
+            EachChunkPointers([&Callable](const std::size_t Count, const EntityType* Entities, auto*... Elements) constexpr
+            {
+                std::invoke(Callable, std::span { Entities, Count }, std::span { Elements, Count }...);
+            });
+        }
+
+        [[nodiscard]] constexpr std::size_t GetSize() const noexcept
+        {
+            return Query.GetSize();
+        }
+
+        [[nodiscard]] constexpr bool Empty() const noexcept
+        {
+            return !GetSize();
+        }
+
+        [[nodiscard]] constexpr std::size_t GetArchetypesCount() const noexcept
+        {
+            return Query.GetArchetypes().size();
+        }
+
+    private:
+        template <typename CallableType>
+        constexpr void EachChunkPointers(CallableType Callable) const
+        {
+            const auto Archetypes { Query.GetArchetypes() };
+
+            for (std::size_t Matched = 0u; Matched < Archetypes.size(); ++Matched)
+            {
+                const ArchetypeType& Current { *Archetypes[Matched] };
+
+                for (std::size_t Chunk = 0u; Chunk < Current.GetChunksCount(); ++Chunk)
+                {
+                    [&]<typename... StorableParameters>(std::tuple<StorableParameters...>*) constexpr
+                    {
+                        std::invoke(
+                            Callable,
+                            Current.GetSizeOf(Chunk),
+                            static_cast<const EntityType*>(Current.GetEntities(Chunk)),
+                            GetColumn<StorableParameters>(Current, Matched, Chunk)...
+                        );
+                    }(static_cast<StorableTypes*>(nullptr));
+                }
+            }
+        }
+
+        template <typename ElementType>
+        [[nodiscard]] constexpr ElementType* GetColumn(const ArchetypeType& Current, const std::size_t Matched, const std::size_t Chunk) const noexcept
+        {
+            return std::launder(reinterpret_cast<ElementType*>(
+                Current.GetColumn(Query.GetColumn(Matched, Types::TypeIndexInTuple<ElementType, IncludesTuple>), Chunk)
+            ));
+        }
+
+        const QueryType& Query;
+    };
+}
+
+#endif // ENGINE_SOURCES_ECS_CONTAINERS_ARCHETYPE_GROUP_FILE_ARCHETYPE_GROUP_H
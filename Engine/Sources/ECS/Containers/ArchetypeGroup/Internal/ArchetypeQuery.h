@@ -0,0 +1,93 @@
+#ifndef ENGINE_SOURCES_ECS_CONTAINERS_ARCHETYPE_GROUP_INTERNAL_FILE_ARCHETYPE_QUERY_H
+#define ENGINE_SOURCES_ECS_CONTAINERS_ARCHETYPE_GROUP_INTERNAL_FILE_ARCHETYPE_QUERY_H
+
+#include <ECS/Containers/Archetype/Archetype.h>
+#include <Types/Types.h>
+#include <Types/Capabilities/Capabilities.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <span>
+#include <vector>
+
+namespace egg::ECS::Containers::Internal
+{
+    template <Types::InstanceOf<Archetype> ArchetypeParameter>
+    class ArchetypeQuery final
+    {
+        using QueryAllocatorTraits = std::allocator_traits<typename ArchetypeParameter::AllocatorType>;
+
+        template <typename Type>
+        using VectorFor = std::vector<Type, typename QueryAllocatorTraits::template rebind_alloc<Type>>;
+
+    public:
+        using ArchetypeType = ArchetypeParameter;
+        using AllocatorType = typename ArchetypeType::AllocatorType;
+
+
+        constexpr ArchetypeQuery(
+            const std::span<const Types::IDType> Includes,
+            const std::span<const Types::IDType> Excludes,
+            const AllocatorType& Allocator
+        )
+            : Includes { Includes.begin(), Includes.end(), Allocator },
+              Excludes { Excludes.begin(), Excludes.end(), Allocator },
+              Archetypes { Allocator },
+              Columns { Allocator }
+        {
+        }
+
+        constexpr bool TryAdd(ArchetypeType& Candidate)
+        {
+            const auto ContainedIn { [&Candidate](const Types::IDType ID) constexpr
+            {
+                return Candidate.Contains(ID);
+            } };
+
+            if (!std::ranges::all_of(Includes, ContainedIn) || std::ranges::any_of(Excludes, ContainedIn))
+            {
+                return false;
+            }
+
+            Archetypes.push_back(&Candidate);
+
+            for (const Types::IDType ID : Includes)
+            {
+                Columns.push_back(Candidate.GetColumnIndex(ID));
+            }
+
+            return true;
+        }
+
+        [[nodiscard]] constexpr std::span<ArchetypeType* const> GetArchetypes() const noexcept
+        {
+            return Archetypes;
+        }
+
+        [[nodiscard]] constexpr std::size_t GetColumn(const std::size_t Matched, const std::size_t Include) const noexcept
+        {
+            return Columns[Matched * Includes.size() + Include];
+        }
+
+        [[nodiscard]] constexpr std::size_t GetSize() const noexcept
+        {
+            std::size_t Size {};
+
+            for (const ArchetypeType* Current : Archetypes)
+            {
+                Size += Current->GetSize();
+            }
+
+            return Size;
+        }
+
+    private:
+        VectorFor<Types::IDType> Includes;
+        VectorFor<Types::IDType> Excludes;
+        VectorFor<ArchetypeType*> Archetypes;
+        VectorFor<std::size_t> Columns;
+    };
+}
+
+#endif // ENGINE_SOURCES_ECS_CONTAINERS_ARCHETYPE_GROUP_INTERNAL_FILE_ARCHETYPE_QUERY_H
@@ -9,10 +9,14 @@
 #include <ECS/Containers/Lifecycle/Lifecycle.h>
 #include <ECS/Containers/PoolGroup/PoolGroup.h>
 #include <ECS/Containers/Traits/PoolTraits.h>
+#include <Jobs/Executor.h>
+#include <Memory/Constants.h>
 #include <Types/Capabilities/Capabilities.h>
 #include <Types/Deduction/Deduction.h>
 
+#include <algorithm>
 #include <concepts>
+#include <cstddef>
 #include <functional>
 
 namespace egg::ECS::Containers
@@ -46,6 +50,15 @@ namespace egg::ECS::Containers
             AllocatorParameter
         >;
 
+        template <typename ElementType>
+        static constexpr bool Gettable {
+            Types::ContainedIn<
+                ElementType,
+                Types::ConstnessAs<ElementType, OwnParameters>...,
+                Types::ConstnessAs<ElementType, ViewParameters>...
+            >
+        };
+
     public:
         using PoolsType = PoolGroup<
             OwnType<PoolFor<OwnParameters>...>,
@@ -127,26 +140,34 @@ namespace egg::ECS::Containers
         {
             for (const auto Arguments : *this)
             {
-                if constexpr (Types::Applicable<CallableType, std::iter_reference_t<Iterator>>)
-                {
-                    std::apply(Callable, Arguments);
-                }
-                else
+                Invoke(Callable, Arguments);
+            }
+        }
+
+        template <typename CallableType, Jobs::Executor ExecutorType> requires
+            Types::Applicable<const CallableType&, std::iter_reference_t<Iterator>> ||
+            Types::Applicable<const CallableType&, Types::RemoveTupleType<EntityType, std::iter_reference_t<Iterator>>>
+        void ParallelEach(const CallableType Callable, ExecutorType& Executor) const
+        {
+            const std::size_t Size { GetSize() };
+
+            Executor.ParallelFor(
+                Size,
+                Jobs::GetChunkSize(Size, Executor.GetConcurrency(), ChunkAlignment),
+                [this, Size, &Callable](const std::size_t First, const std::size_t Last)
                 {
-                    std::apply([&Callable]<typename... ElementTypes>(EntityType, ElementTypes&&... Elements) constexpr
+                    const Iterator ChunkEnd { EntitiesBegin() + (Size - First), Pools.GetPools() };
+
+                    for (Iterator Current { EntitiesBegin() + (Size - Last), Pools.GetPools() }; Current != ChunkEnd; ++Current)
                     {
-                        std::invoke(Callable, std::forward<ElementTypes>(Elements)...);
-                    }, Arguments);
+                        Invoke(Callable, *Current);
+                    }
                 }
-            }
+            );
         }
 
         template <typename... ElementTypes> requires
-            (Types::ContainedIn<
-                ElementTypes,
-                Types::ConstnessAs<ElementTypes, OwnParameters>...,
-                Types::ConstnessAs<ElementTypes, ViewParameters>...
-            > && ...) &&
+            (Gettable<ElementTypes> && ...) &&
             Types::AllUnique<std::remove_const_t<ElementTypes>...> &&
             (!OptimizableElement<ElementTypes, EntityType> || ...)
         [[nodiscard]] constexpr decltype(auto) Get(const EntityType Entity) const
@@ -183,17 +204,21 @@ namespace egg::ECS::Containers
                   typename CompareType,
                   typename SortType = decltype(std::ranges::sort),
                   typename ProjectionType = std::identity> requires
-            (Types::ContainedIn<
-                ElementTypes,
-                Types::ConstnessAs<ElementTypes, OwnParameters>...,
-                Types::ConstnessAs<ElementTypes, ViewParameters>...
-            > && ...) &&
+            (Gettable<ElementTypes> && ...) &&
             Types::AllUnique<std::remove_const_t<ElementTypes>...>
         constexpr void Sort(CompareType Compare, SortType Sort = SortType {}, ProjectionType Projection = ProjectionType {}) const
         {
             Pools.template Sort<ElementTypes...>(std::move(Compare), std::move(Sort), std::move(Projection));
         }
 
+        template <typename... ElementTypes, typename CompareType, typename ProjectionType = std::identity> requires
+            (Gettable<ElementTypes> && ...) &&
+            Types::AllUnique<std::remove_const_t<ElementTypes>...>
+        constexpr void SortIncremental(CompareType Compare, ProjectionType Projection = ProjectionType {}) const
+        {
+            Pools.template SortIncremental<ElementTypes...>(std::move(Compare), std::move(Projection));
+        }
+
         template <typename IteratorType, std::sentinel_for<IteratorType> SentinelType>
         constexpr Iterator SortAs(IteratorType First, SentinelType Last) const
         {
@@ -206,6 +231,26 @@ namespace egg::ECS::Containers
         }
 
     private:
+        static constexpr std::size_t ChunkAlignment {
+            std::max({ Memory::CacheLineAlignedCount<EntityType>, Memory::CacheLineAlignedCount<OwnParameters>... })
+        };
+
+        template <typename CallableType, typename ArgumentsType>
+        static constexpr void Invoke(CallableType& Callable, ArgumentsType&& Arguments)
+        {
+            if constexpr (Types::Applicable<CallableType&, ArgumentsType>)
+            {
+                std::apply(Callable, std::forward<ArgumentsType>(Arguments));
+            }
+            else
+            {
+                std::apply([&Callable]<typename... ElementTypes>(EntityType, ElementTypes&&... Elements) constexpr
+                {
+                    std::invoke(Callable, std::forward<ElementTypes>(Elements)...);
+                }, std::forward<ArgumentsType>(Arguments));
+            }
+        }
+
         PoolsType& Pools;
     };
 
@@ -325,6 +370,35 @@ namespace egg::ECS::Containers
             }
         }
 
+        template <typename CallableType, Jobs::Executor ExecutorType> requires
+            Types::Applicable<const CallableType&, std::iter_reference_t<Iterator>> ||
+            Types::Applicable<const CallableType&, Types::RemoveTupleType<EntityType, std::iter_reference_t<Iterator>>>
+        void ParallelEach(const CallableType Callable, ExecutorType& Executor) const
+        {
+            const std::size_t Size { GetSize() };
+
+            Executor.ParallelFor(
+                Size,
+                Jobs::GetChunkSize(Size, Executor.GetConcurrency(), Memory::CacheLineAlignedCount<ElementType>),
+                [this, Size, &Callable](const std::size_t First, const std::size_t Last)
+                {
+                    const Iterator ChunkEnd { ToIterator(EntitiesBegin() + (Size - First)) };
+
+                    for (Iterator Current { ToIterator(EntitiesBegin() + (Size - Last)) }; Current != ChunkEnd; ++Current)
+                    {
+                        if constexpr (Types::Applicable<const CallableType&, std::iter_reference_t<Iterator>>)
+                        {
+                            std::apply(Callable, *Current);
+                        }
+                        else
+                        {
+                            std::invoke(Callable, std::get<1u>(*Current));
+                        }
+                    }
+                }
+            );
+        }
+
         template <typename Type = ElementType> requires std::same_as<Type, Types::ConstnessAs<Type, ElementType>>
         [[nodiscard]] constexpr Type& Get(const EntityType Entity) const
         {
@@ -368,6 +442,15 @@ namespace egg::ECS::Containers
             Pool.Sort(std::move(Compare), std::move(Sort), GetProjection<Type...>(std::move(Projection)));
         }
 
+        template <typename... Type, typename CompareType, typename ProjectionType = std::identity> requires
+            (sizeof...(Type) <= 1u) &&
+            (std::same_as<Type, Types::ConstnessAs<Type, ElementType>> && ...)
+        constexpr void SortIncremental(CompareType Compare, ProjectionType Projection = ProjectionType {}) const
+            requires (sizeof...(OwnParameters) == 1u)
+        {
+            Pool.SortIncremental(std::move(Compare), GetProjection<Type...>(std::move(Projection)));
+        }
+
         template <typename IteratorType, std::sentinel_for<IteratorType> SentinelType>
         constexpr Iterator SortAs(IteratorType First, SentinelType Last) const
             requires (sizeof...(OwnParameters) == 1u)
@@ -401,7 +484,7 @@ namespace egg::ECS::Containers
 
         [[nodiscard]] constexpr Iterator ToIterator(const EntitiesIterator Other) const noexcept
         {
-            return Iterator { Other, GetPool().ElementsEnd() - (Other.GetIndex() + 1u) };
+            return Iterator { Other, GetPool().ElementsEnd() - (Other.GetIndex() + 1u), GetPool().End() };
         }
 
         [[nodiscard]] constexpr Types::ConstnessAs<ElementType, PoolsType>& GetPool() const noexcept
@@ -473,6 +556,27 @@ namespace egg::ECS::Containers
             }
         }
 
+        template <std::invocable<std::iter_reference_t<Iterator>> CallableType, Jobs::Executor ExecutorType>
+            requires std::invocable<const CallableType&, std::iter_reference_t<Iterator>>
+        void ParallelEach(const CallableType Callable, ExecutorType& Executor) const
+        {
+            const std::size_t Size { GetSize() };
+
+            Executor.ParallelFor(
+                Size,
+                Jobs::GetChunkSize(Size, Executor.GetConcurrency(), Memory::CacheLineAlignedCount<EntityType>),
+                [this, Size, &Callable](const std::size_t First, const std::size_t Last)
+                {
+                    const Iterator ChunkEnd { Begin() + (Size - First) };
+
+                    for (Iterator Current { Begin() + (Size - Last) }; Current != ChunkEnd; ++Current)
+                    {
+                        std::invoke(Callable, *Current);
+                    }
+                }
+            );
+        }
+
         [[nodiscard]] constexpr Iterator Find(const EntityType Entity) const noexcept
         {
             return GetPool().Find(Entity);
@@ -505,6 +609,13 @@ namespace egg::ECS::Containers
             Pool.Sort(std::move(Compare), std::move(Sort), std::move(Projection));
         }
 
+        template <typename CompareType, typename ProjectionType = std::identity>
+        constexpr void SortIncremental(CompareType Compare, ProjectionType Projection = ProjectionType {}) const
+            requires (sizeof...(OwnParameters) == 1u)
+        {
+            Pool.SortIncremental(std::move(Compare), std::move(Projection));
+        }
+
         template <typename IteratorType, std::sentinel_for<IteratorType> SentinelType>
         constexpr Iterator SortAs(IteratorType First, SentinelType Last) const
             requires (sizeof...(OwnParameters) == 1u)
@@ -0,0 +1,272 @@
+#ifndef ENGINE_SOURCES_ECS_CONTAINERS_HIERARCHY_FILE_HIERARCHY_H
+#define ENGINE_SOURCES_ECS_CONTAINERS_HIERARCHY_FILE_HIERARCHY_H
+
+#include <Containers/IterableAdaptor.h>
+#include <Containers/Algorithms/RadixSort.h>
+#include <ECS/Entity.h>
+#include <ECS/Containers/Storage/Storage.h>
+#include <ECS/Traits/EntityTraits.h>
+#include <Types/Capabilities/Capabilities.h>
+
+#include <concepts>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace egg::ECS::Containers
+{
+    template <ValidEntity EntityParameter>
+    struct Relationship
+    {
+        EntityParameter Parent { EntityTraits<EntityParameter>::Tombstone };
+        EntityParameter FirstChild { EntityTraits<EntityParameter>::Tombstone };
+        EntityParameter PreviousSibling { EntityTraits<EntityParameter>::Tombstone };
+        EntityParameter NextSibling { EntityTraits<EntityParameter>::Tombstone };
+        std::size_t Descendants {};
+    };
+
+
+    //Nodes added through the Storage interface are roots placed ahead of every arranged subtree, so they keep the hierarchy arranged
+    template <ValidEntity EntityParameter,
+              Types::ValidAllocator<Relationship<EntityParameter>> AllocatorParameter = std::allocator<Relationship<EntityParameter>>>
+    class Hierarchy final : public Storage<Relationship<EntityParameter>, EntityParameter, AllocatorParameter>
+    {
+        using TraitsType = EntityTraits<EntityParameter>;
+
+    public:
+        using BaseType = Storage<Relationship<EntityParameter>, EntityParameter, AllocatorParameter>;
+        using AllocatorType = AllocatorParameter;
+
+        using ElementType = typename BaseType::ElementType;
+        using EntityType = typename BaseType::EntityType;
+
+        using SubtreeIterable = egg::Containers::IterableAdaptor<typename BaseType::EntitiesConstIterator>;
+
+
+        constexpr Hierarchy() : Hierarchy { AllocatorType {} }
+        {
+        }
+
+        constexpr explicit Hierarchy(const AllocatorType& Allocator) noexcept(std::is_nothrow_constructible_v<BaseType, const AllocatorType&>)
+            : BaseType { Allocator }, Arranged { true }
+        {
+        }
+
+        Hierarchy(const Hierarchy&) = delete;
+
+        constexpr Hierarchy(Hierarchy&& Other) noexcept(std::is_nothrow_move_constructible_v<BaseType>) = default;
+
+        constexpr Hierarchy(Hierarchy&& Other, const AllocatorType& Allocator) : BaseType { std::move(Other), Allocator },
+                                                                                 Arranged { Other.Arranged }
+        {
+        }
+
+        constexpr ~Hierarchy() noexcept override = default;
+
+        Hierarchy& operator=(const Hierarchy&) = delete;
+
+        constexpr Hierarchy& operator=(Hierarchy&& Other) noexcept(std::is_nothrow_move_assignable_v<BaseType>) = default;
+
+        constexpr ElementType& Attach(const EntityType Entity, const EntityType Parent)
+        {
+            EGG_ASSERT(Entity != Parent, "Entity cannot be its own parent");
+            EGG_ASSERT(!IsAncestor(Entity, Parent), "Attaching would create a cycle");
+
+            if (Parent != TraitsType::Tombstone && !BaseType::Contains(Parent))
+            {
+                BaseType::Emplace(Parent);
+            }
+
+            ElementType& Node { BaseType::Contains(Entity) ? BaseType::Get(Entity) : BaseType::Emplace(Entity) };
+            Unlink(Node);
+
+            if (Parent != TraitsType::Tombstone)
+            {
+                ElementType& ParentNode { BaseType::Get(Parent) };
+                Node.Parent = Parent;
+                Node.NextSibling = std::exchange(ParentNode.FirstChild, Entity);
+
+                if (Node.NextSibling != TraitsType::Tombstone)
+                {
+                    BaseType::Get(Node.NextSibling).PreviousSibling = Entity;
+                }
+            }
+
+            Arranged = false;
+            return Node;
+        }
+
+        constexpr void Detach(const EntityType Entity)
+        {
+            Unlink(BaseType::Get(Entity));
+            Arranged = false;
+        }
+
+        [[nodiscard]] constexpr bool IsAncestor(const EntityType Ancestor, EntityType Entity) const noexcept
+        {
+            while (Entity != TraitsType::Tombstone && BaseType::Contains(Entity))
+            {
+                Entity = BaseType::Get(Entity).Parent;
+
+                if (Entity == Ancestor)
+                {
+                    return true;
+                }
+            }
+
+            return false;
+        }
+
+        [[nodiscard]] constexpr bool IsArranged() const noexcept
+        {
+            return Arranged;
+        }
+
+        void Arrange()
+        {
+            if (Arranged) return;
+
+            const std::size_t Size { BaseType::GetSize() };
+            std::vector<std::size_t> Ranks(Size);
+            std::size_t Rank {};
+            bool Ordered { true };
+
+            const auto Visit { [this, &Ranks, &Rank, &Ordered, Size](const EntityType Entity)
+            {
+                const std::size_t Index { BaseType::GetIndex(Entity) };
+                Ordered = Ordered && Index == Size - Rank - 1u;
+                Ranks[Index] = Rank++;
+            } };
+
+            for (const EntityType Root : static_cast<const BaseType&>(*this))
+            {
+                if (BaseType::Get(Root).Parent != TraitsType::Tombstone) continue;
+
+                Visit(Root);
+
+                for (EntityType Current { Root }; Current != TraitsType::Tombstone;)
+                {
+                    if (const EntityType Child { BaseType::Get(Current).FirstChild }; Child != TraitsType::Tombstone)
+                    {
+                        Visit(Current = Child);
+                        continue;
+                    }
+
+                    for (;;)
+                    {
+                        ElementType& Node { BaseType::Get(Current) };
+                        Node.Descendants = Rank - Ranks[BaseType::GetIndex(Current)] - 1u;
+
+                        if (Current == Root)
+                        {
+                            Current = TraitsType::Tombstone;
+                            break;
+                        }
+
+                        if (Node.NextSibling != TraitsType::Tombstone)
+                        {
+                            Visit(Current = Node.NextSibling);
+                            break;
+                        }
+
+                        Current = Node.Parent;
+                    }
+                }
+            }
+
+            if (!Ordered)
+            {
+                BaseType::Sort(std::ranges::less {}, egg::Containers::RadixSort, [this, &Ranks](const EntityType Entity)
+                {
+                    return Ranks[BaseType::GetIndex(Entity)];
+                });
+            }
+
+            Arranged = true;
+        }
+
+        template <typename PoolType>
+        void Arrange(PoolType& Pool)
+        {
+            Arrange();
+            Pool.SortAs(BaseType::ConstBegin(), BaseType::ConstEnd());
+        }
+
+        [[nodiscard]] constexpr SubtreeIterable GetSubtree(const EntityType Entity) const noexcept
+        {
+            EGG_ASSERT(Arranged, "Hierarchy must be arranged to get a subtree");
+            const auto First { BaseType::Find(Entity) };
+            return SubtreeIterable { First, First + static_cast<std::ptrdiff_t>(BaseType::Get(Entity).Descendants + 1u) };
+        }
+
+        template <typename PoolType, typename CallableType> requires
+            std::invocable<CallableType&, typename PoolType::ElementType&, const typename PoolType::ElementType*>
+        void Propagate(PoolType& Pool, CallableType Callable)
+        {
+            if (!Arranged)
+            {
+                Arrange(Pool);
+            }
+
+            for (auto&& [Entity, Node] : std::as_const(*this).Each())
+            {
+                if (!Pool.Contains(Entity)) continue;
+
+                const bool Inherits { Node.Parent != TraitsType::Tombstone && Pool.Contains(Node.Parent) };
+                std::invoke(Callable, Pool.Get(Entity), Inherits ? std::addressof(std::as_const(Pool.Get(Node.Parent))) : nullptr);
+            }
+        }
+
+    protected:
+        constexpr void Pop(typename BaseType::EntitiesIterator First, typename BaseType::EntitiesIterator Last) override
+        {
+            for (auto Current { First }; Current != Last; ++Current)
+            {
+                ElementType& Node { BaseType::Get(*Current) };
+                Unlink(Node);
+
+                for (EntityType Child { Node.FirstChild }; Child != TraitsType::Tombstone;)
+                {
+                    ElementType& ChildNode { BaseType::Get(Child) };
+                    Child = ChildNode.NextSibling;
+                    ChildNode.Parent = ChildNode.PreviousSibling = ChildNode.NextSibling = TraitsType::Tombstone;
+                }
+
+                Node.FirstChild = TraitsType::Tombstone;
+            }
+
+            Arranged = false;
+            BaseType::Pop(First, Last);
+        }
+
+    private:
+        constexpr void Unlink(ElementType& Node)
+        {
+            if (Node.Parent == TraitsType::Tombstone) return;
+
+            if (Node.PreviousSibling != TraitsType::Tombstone)
+            {
+                BaseType::Get(Node.PreviousSibling).NextSibling = Node.NextSibling;
+            }
+            else
+            {
+                BaseType::Get(Node.Parent).FirstChild = Node.NextSibling;
+            }
+
+            if (Node.NextSibling != TraitsType::Tombstone)
+            {
+                BaseType::Get(Node.NextSibling).PreviousSibling = Node.PreviousSibling;
+            }
+
+            Node.Parent = Node.PreviousSibling = Node.NextSibling = TraitsType::Tombstone;
+        }
+
+        bool Arranged;
+    };
+}
+
+#endif // ENGINE_SOURCES_ECS_CONTAINERS_HIERARCHY_FILE_HIERARCHY_H
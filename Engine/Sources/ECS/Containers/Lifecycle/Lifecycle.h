@@ -107,6 +107,7 @@ namespace egg::ECS::Containers
             {
                 for (std::size_t Position = 0u, Last = ContainerType::GetSize(); Position < Last; ++Position)
                 {
+                    if (ContainerType::IsTombstoneAt(Position)) continue;
                     Destruction.Publish(Owner, ContainerType::operator[](Position));
                 }
             }
@@ -234,6 +235,7 @@ namespace egg::ECS::Containers
         template <typename... Args>
         constexpr ElementType& Emplace(const EntityType Entity, Args&&... Arguments)
         {
+            SyncTick();
             ElementType& Constructed { ContainerType::Emplace(Entity, std::forward<Args>(Arguments)...) };
             Construction.Publish(Owner, Entity);
             return Constructed;
@@ -242,6 +244,7 @@ namespace egg::ECS::Containers
         template <typename IteratorType, std::sentinel_for<IteratorType> SentinelType, typename... Args>
         constexpr Iterator Insert(IteratorType First, SentinelType Last, Args&&... Arguments)
         {
+            SyncTick();
             std::size_t From { ContainerType::GetSize() };
             const Iterator Constructed { ContainerType::Insert(First, Last, std::forward<Args>(Arguments)...) };
 
@@ -256,20 +259,63 @@ namespace egg::ECS::Containers
             return Constructed;
         }
 
+        template <typename IteratorType, std::sized_sentinel_for<IteratorType> SentinelType, typename CallableType>
+        Iterator InsertForOverwrite(IteratorType First, SentinelType Last, CallableType Fill)
+        {
+            SyncTick();
+            std::size_t From { ContainerType::GetSize() };
+            const Iterator Constructed { ContainerType::InsertForOverwrite(First, Last, std::move(Fill)) };
+
+            if (!Construction.Empty())
+            {
+                for (const std::size_t To { ContainerType::GetSize() }; From < To; ++From)
+                {
+                    Construction.Publish(Owner, ContainerType::operator[](From));
+                }
+            }
+
+            return Constructed;
+        }
+
+        template <typename IteratorType, std::sized_sentinel_for<IteratorType> SentinelType, typename... Args>
+        Iterator Adopt(IteratorType First, SentinelType Last, Args&&... Arguments)
+        {
+            SyncTick();
+            const Iterator Constructed { ContainerType::Adopt(First, Last, std::forward<Args>(Arguments)...) };
+
+            if (!Construction.Empty())
+            {
+                for (std::size_t Position = 0u, To = ContainerType::GetSize(); Position < To; ++Position)
+                {
+                    Construction.Publish(Owner, ContainerType::operator[](Position));
+                }
+            }
+
+            return Constructed;
+        }
+
         template <typename... CallableTypes>
         constexpr ElementType& Patch(const EntityType Entity, CallableTypes&&... Callables)
         {
+            SyncTick();
             ElementType& Updated { ContainerType::Patch(Entity, std::forward<CallableTypes>(Callables)...) };
             Update.Publish(Owner, Entity);
             return Updated;
         }
 
+        constexpr void MarkChanged(const EntityType Entity) requires ContainerType::TracksChanges
+        {
+            SyncTick();
+            ContainerType::MarkChanged(Entity);
+        }
+
         constexpr void Clear() override
         {
             if (!Destruction.Empty())
             {
                 for (std::size_t Position = 0u, Last = ContainerType::GetSize(); Position < Last; ++Position)
                 {
+                    if (ContainerType::IsTombstoneAt(Position)) continue;
                     Destruction.Publish(Owner, ContainerType::operator[](Position));
                 }
             }
@@ -280,6 +326,7 @@ namespace egg::ECS::Containers
     protected:
         constexpr SparseSetIterator TryEmplace(const EntityType Entity) override
         {
+            SyncTick();
             const SparseSetIterator Constructed { ContainerType::TryEmplace(Entity) };
 
             if constexpr (std::default_initializable<typename ContainerType::ElementType>)
@@ -304,6 +351,14 @@ namespace egg::ECS::Containers
         }
 
     private:
+        constexpr void SyncTick() noexcept
+        {
+            if constexpr (ContainerType::TracksChanges)
+            {
+                ContainerType::SetCurrentTick(Owner.GetChangeTick());
+            }
+        }
+
         OwnerType& Owner;
         SignalType Construction;
         SignalType Update;
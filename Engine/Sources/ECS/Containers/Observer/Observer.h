@@ -0,0 +1,192 @@
+#ifndef ENGINE_SOURCES_ECS_CONTAINERS_OBSERVER_FILE_OBSERVER_H
+#define ENGINE_SOURCES_ECS_CONTAINERS_OBSERVER_FILE_OBSERVER_H
+
+#include <ECS/Ownership.h>
+#include <ECS/Registry.h>
+#include <ECS/Containers/Container.h>
+#include <ECS/Containers/Traits/PoolTraits.h>
+#include <Types/Capabilities/Capabilities.h>
+
+#include <concepts>
+#include <cstddef>
+#include <functional>
+#include <type_traits>
+#include <utility>
+
+namespace egg::ECS::Containers
+{
+    template <Types::InstanceOf<Registry> RegistryParameter>
+    class Observer final
+    {
+        using ContainerType = typename PoolTraits<
+            typename RegistryParameter::EntityType,
+            typename RegistryParameter::AllocatorType
+        >::SparseSetType;
+
+        using ReleaseType = void (*)(RegistryParameter&, Observer&);
+
+    public:
+        using RegistryType = RegistryParameter;
+        using AllocatorType = typename RegistryType::AllocatorType;
+        using EntityType = typename RegistryType::EntityType;
+
+        using Iterator = typename ContainerType::ConstIterator;
+        using ReverseIterator = typename ContainerType::ConstReverseIterator;
+
+
+        template <Types::Decayed ElementType, Types::Decayed... RequireTypes, Types::Decayed... ExcludeTypes> requires
+            Types::AllUnique<ElementType, RequireTypes..., ExcludeTypes...>
+        Observer(RegistryType& Registry,
+                 ChangedType<ElementType>,
+                 ViewType<RequireTypes...> = ViewType {},
+                 ExcludeType<ExcludeTypes...> = ExcludeType {})
+            : Owner { &Registry },
+              Release { &Disconnect<ElementType, RequireTypes..., ExcludeTypes...> },
+              Container { Registry.GetAllocator() }
+        {
+            using CollectorType = ViewType<RequireTypes...>;
+            using FilterType = ExcludeType<ExcludeTypes...>;
+
+            auto& Pool { Registry.template GetPoolFor<ElementType>() };
+            Pool.OnConstruct().template Connect<&Observer::Collect<CollectorType, FilterType>>(*this);
+            Pool.OnDestroy().template Connect<&Observer::Discard>(*this);
+
+            if constexpr (!OptimizableElement<ElementType, EntityType>)
+            {
+                Pool.OnUpdate().template Connect<&Observer::Collect<CollectorType, FilterType>>(*this);
+            }
+
+            (Registry.template GetPoolFor<RequireTypes>().OnDestroy().template Connect<&Observer::Discard>(*this), ...);
+            (Registry.template GetPoolFor<ExcludeTypes>().OnConstruct().template Connect<&Observer::Discard>(*this), ...);
+        }
+
+        Observer(const Observer&) = delete;
+
+        Observer(Observer&&) = delete;
+
+        ~Observer() noexcept
+        {
+            Release(*Owner, *this);
+        }
+
+        Observer& operator=(const Observer&) = delete;
+
+        Observer& operator=(Observer&&) = delete;
+
+        [[nodiscard]] Iterator Begin() const noexcept
+        {
+            return Container.Begin();
+        }
+
+        [[nodiscard]] Iterator End() const noexcept
+        {
+            return Container.End();
+        }
+
+        [[nodiscard]] ReverseIterator ReverseBegin() const noexcept
+        {
+            return Container.ReverseBegin();
+        }
+
+        [[nodiscard]] ReverseIterator ReverseEnd() const noexcept
+        {
+            return Container.ReverseEnd();
+        }
+
+        [[nodiscard]] bool Contains(const EntityType Entity) const noexcept
+        {
+            return Container.Contains(Entity);
+        }
+
+        [[nodiscard]] std::size_t GetSize() const noexcept
+        {
+            return Container.GetSize();
+        }
+
+        [[nodiscard]] bool Empty() const noexcept
+        {
+            return Container.Empty();
+        }
+
+        [[nodiscard]] std::size_t GetCapacity() const noexcept
+        {
+            return Container.GetCapacity();
+        }
+
+        [[nodiscard]] const EntityType* GetEntityData() const noexcept
+        {
+            return Container.GetEntityData();
+        }
+
+        template <std::invocable<EntityType> CallableType>
+        void Each(CallableType Callable) const
+        {
+            for (const EntityType Entity : Container)
+            {
+                std::invoke(Callable, Entity);
+            }
+        }
+
+        template <std::invocable<EntityType> CallableType>
+        void Consume(CallableType Callable)
+        {
+            Each(std::move(Callable));
+            Clear();
+        }
+
+        void Clear()
+        {
+            Container.Clear();
+        }
+
+    private:
+        template <typename... RequireTypes, typename... ExcludeTypes>
+        [[nodiscard]] static bool Matches(const RegistryType& Registry,
+                                          const EntityType Entity,
+                                          ViewType<RequireTypes...>,
+                                          ExcludeType<ExcludeTypes...>)
+        {
+            if constexpr (sizeof...(RequireTypes) != 0u)
+            {
+                if (!Registry.template Contains<RequireTypes...>(Entity)) return false;
+            }
+
+            return !(Registry.template Contains<ExcludeTypes>(Entity) || ...);
+        }
+
+        template <typename CollectorType, typename FilterType>
+        void Collect(RegistryType& Registry, const EntityType Entity)
+        {
+            if (!Container.Contains(Entity) && Matches(Registry, Entity, CollectorType {}, FilterType {}))
+            {
+                Container.Push(Entity);
+            }
+        }
+
+        void Discard(RegistryType&, const EntityType Entity)
+        {
+            Container.Remove(Entity);
+        }
+
+        template <typename... ElementTypes>
+        static void Disconnect(RegistryType& Registry, Observer& Target)
+        {
+            ((Registry.template GetPoolFor<ElementTypes>().OnConstruct().Disconnect(Target),
+                Registry.template GetPoolFor<ElementTypes>().OnDestroy().Disconnect(Target)), ...);
+
+            ([&Registry, &Target]
+            {
+                if constexpr (!OptimizableElement<ElementTypes, EntityType>)
+                {
+                    Registry.template GetPoolFor<ElementTypes>().OnUpdate().Disconnect(Target);
+                }
+            }(), ...);
+        }
+
+        RegistryType* Owner;
+        ReleaseType Release;
+        ContainerType Container;
+    };
+}
+
+#endif // ENGINE_SOURCES_ECS_CONTAINERS_OBSERVER_FILE_OBSERVER_H
@@ -9,7 +9,11 @@
 #include <Types/Capabilities/Capabilities.h>
 
 #include <array>
+#include <climits>
+#include <cstddef>
+#include <cstdint>
 #include <ranges>
+#include <span>
 #include <tuple>
 #include <type_traits>
 
@@ -58,6 +62,8 @@ namespace egg::ECS::Containers::Internal
         template <typename... ElementTypes>
         using StorableTupleOf = Types::FilterTuple<StorablePredicate, std::tuple<ElementTypes...>>;
 
+        static constexpr std::size_t BlockSize { sizeof(std::uint64_t) * CHAR_BIT };
+
 
         template <auto PushOnConstruct, auto PushOnDestroy, auto Remove, typename GroupType>
         constexpr PoolGroupViewer(const PoolsType& Pools,
@@ -90,6 +96,26 @@ namespace egg::ECS::Containers::Internal
                 }, Filters);
         }
 
+        [[nodiscard]] constexpr std::uint64_t GroupableMany(const std::span<const EntityType> Entities) const noexcept
+        {
+            EGG_ASSERT(Entities.size() <= BlockSize, "Too many entities for a single block");
+
+            std::uint64_t Matching { Entities.empty() ? std::uint64_t {} : ~std::uint64_t {} >> (BlockSize - Entities.size()) };
+            std::uint64_t Contained {};
+
+            std::apply([Entities, &Matching, &Contained](auto&... GroupPools) constexpr noexcept
+            {
+                ((Matching && (GroupPools.ContainsMany(Entities, std::span { &Contained, 1u }), Matching &= Contained)), ...);
+            }, Pools);
+
+            std::apply([Entities, &Matching, &Contained](auto&... GroupFilters) constexpr noexcept
+            {
+                ((Matching && (GroupFilters.ContainsMany(Entities, std::span { &Contained, 1u }), Matching &= ~Contained)), ...);
+            }, Filters);
+
+            return Matching;
+        }
+
         [[nodiscard]] constexpr bool GroupableWithoutLastFilter(const EntityType Entity) const noexcept
         {
             return PoolsContain(Entity) &&
@@ -151,11 +177,11 @@ namespace egg::ECS::Containers::Internal
         {
             if constexpr (!sizeof...(ElementTypes))
             {
-                return GetElements<typename OwnParameters::ElementType..., typename ViewParameters::ElementType...>();
+                return GetElements<typename OwnParameters::ElementType..., typename ViewParameters::ElementType...>(Entity);
             }
             else if constexpr (Types::TupleSize<StorableTupleOf<ElementTypes...>> == 1u)
             {
-                return GetElement<Types::CommonTypeOfTuple<StorableTupleOf<ElementTypes...>>>();
+                return GetElement<Types::CommonTypeOfTuple<StorableTupleOf<ElementTypes...>>>(Entity);
             }
             else
             {
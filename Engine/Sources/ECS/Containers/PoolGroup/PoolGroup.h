@@ -6,11 +6,16 @@
 #include <ECS/Ownership.h>
 #include <ECS/Containers/Lifecycle/Lifecycle.h>
 #include <ECS/Containers/PoolGroup/PoolGroupInterface.h>
+#include <ECS/Traits/InPlaceDeleteTraits.h>
 #include <Types/Capabilities/Capabilities.h>
 
 #include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
 #include <iterator>
 #include <ranges>
+#include <span>
 #include <tuple>
 #include <type_traits>
 
@@ -27,6 +32,7 @@ namespace egg::ECS::Containers
     > requires
         Types::NoneOf<std::is_const, OwnParameters..., ViewParameters..., ExcludeParameters...> &&
         (Types::InstanceOf<typename OwnParameters::ContainerType, Storage> && ...) &&
+        (!InPlaceDeleteTraits<typename OwnParameters::ElementType>::value && ...) &&
         (Types::InstanceOf<typename ViewParameters::ContainerType, Storage> && ...) &&
         (Types::InstanceOf<typename ExcludeParameters::ContainerType, Storage> && ...) &&
         Types::AllUnique<typename OwnParameters::ElementType...,
@@ -69,9 +75,16 @@ namespace egg::ECS::Containers
               },
               Size {}
         {
-            for (EntityType Entity : std::views::reverse(Viewer.GetSmallestPool()))
+            const CommonType& Smallest { Viewer.GetSmallestPool() };
+
+            for (std::size_t First = 0u; First < Smallest.GetSize(); First += ViewerType::BlockSize)
             {
-                PushOnConstruct(Entity);
+                const std::span Entities { Smallest.GetEntityData() + First, std::min(ViewerType::BlockSize, Smallest.GetSize() - First) };
+
+                for (std::uint64_t Matching { Viewer.GroupableMany(Entities) }; Matching; Matching &= Matching - 1u)
+                {
+                    SwapElements(Size++, Entities[static_cast<std::size_t>(std::countr_zero(Matching))]);
+                }
             }
         }
 
@@ -176,6 +189,26 @@ namespace egg::ECS::Containers
             }
         }
 
+        template <typename... ElementTypes, typename CompareType, typename ProjectionType = std::identity> requires
+            (Types::ContainedIn<
+                std::remove_const_t<ElementTypes>,
+                typename OwnParameters::ElementType..., typename ViewParameters::ElementType...
+            > && ...) &&
+            Types::AllUnique<std::remove_const_t<ElementTypes>...>
+        constexpr void SortIncremental(CompareType Compare, ProjectionType Projection = ProjectionType {}) const
+        {
+            GetLeading().SortCountIncremental(
+                Size,
+                std::move(Compare),
+                Viewer.template GetProjection<ElementTypes...>(std::move(Projection))
+            );
+
+            if constexpr (sizeof...(OwnParameters) > 1u)
+            {
+                SortCountAsLeading<OwnParameters...>(Size);
+            }
+        }
+
         template <typename IteratorType, std::sentinel_for<IteratorType> SentinelType>
         constexpr Iterator SortAs(IteratorType First, SentinelType Last) const
         {
@@ -278,9 +311,21 @@ namespace egg::ECS::Containers
               },
               Container { Allocator }
         {
-            for (EntityType Entity : Viewer.GetSmallestPool())
+            const CommonType& Smallest { Viewer.GetSmallestPool() };
+
+            for (std::size_t Last = Smallest.GetSize(); Last;)
             {
-                PushOnConstruct(Entity);
+                const std::size_t First { Last - std::min(ViewerType::BlockSize, Last) };
+                const std::span Entities { Smallest.GetEntityData() + First, Last - First };
+
+                for (std::uint64_t Matching { Viewer.GroupableMany(Entities) }; Matching;)
+                {
+                    const auto Position { static_cast<std::size_t>(std::bit_width(Matching) - 1u) };
+                    Container.Push(Entities[Position]);
+                    Matching ^= std::uint64_t { 1u } << Position;
+                }
+
+                Last = First;
             }
         }
 
@@ -364,13 +409,21 @@ namespace egg::ECS::Containers
                   typename ProjectionType = std::identity> requires
             (Types::ContainedIn<std::remove_const_t<ElementTypes>, typename ViewParameters::ElementType...> && ...) &&
             Types::AllUnique<std::remove_const_t<ElementTypes>...>
-        constexpr void Sort(CompareType Compare, SortType Sort = SortType {}, ProjectionType Projection = ProjectionType {}) const
+        constexpr void Sort(CompareType Compare, SortType Sort = SortType {}, ProjectionType Projection = ProjectionType {})
         {
             Container.Sort(std::move(Compare), std::move(Sort), Viewer.template GetProjection<ElementTypes...>(std::move(Projection)));
         }
 
+        template <typename... ElementTypes, typename CompareType, typename ProjectionType = std::identity> requires
+            (Types::ContainedIn<std::remove_const_t<ElementTypes>, typename ViewParameters::ElementType...> && ...) &&
+            Types::AllUnique<std::remove_const_t<ElementTypes>...>
+        constexpr void SortIncremental(CompareType Compare, ProjectionType Projection = ProjectionType {})
+        {
+            Container.SortIncremental(std::move(Compare), Viewer.template GetProjection<ElementTypes...>(std::move(Projection)));
+        }
+
         template <typename IteratorType, std::sentinel_for<IteratorType> SentinelType>
-        constexpr Iterator SortAs(IteratorType First, SentinelType Last) const
+        constexpr Iterator SortAs(IteratorType First, SentinelType Last)
         {
             return Container.SortAs(std::move(First), std::move(Last));
         }
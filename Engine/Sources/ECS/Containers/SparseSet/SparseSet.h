@@ -3,20 +3,44 @@
 
 #include "./Internal/SparseSetIterator.h"
 
+#include <Containers/Algorithms/ParallelSort.h>
 #include <Containers/PagedVector/PagedVector.h>
 #include <ECS/Entity.h>
 #include <ECS/Containers/Container.h>
 #include <ECS/Traits/EntityTraits.h>
+#include <Jobs/Executor.h>
+#include <Jobs/ExecutorReference.h>
+#include <Jobs/SequentialExecutor.h>
+#include <Memory/Constants.h>
 #include <Types/Capabilities/Capabilities.h>
 
 #include <algorithm>
+#include <bit>
+#include <climits>
+#include <cstdint>
 #include <functional>
 #include <iterator>
 #include <memory>
+#include <span>
+#include <string_view>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
+#if defined(__AVX2__)
+#define EGG_ECS_SPARSE_SET_AVX2
+#include <immintrin.h>
+#endif
+
 namespace egg::ECS::Containers
 {
+    enum class DeletionPolicy : std::uint8_t
+    {
+        SwapAndPop,
+        InPlace
+    };
+
+
     template <ValidEntity EntityParameter, Types::ValidAllocator<EntityParameter> AllocatorParameter = std::allocator<EntityParameter>>
     class SparseSet
     {
@@ -44,16 +68,31 @@ namespace egg::ECS::Containers
 
         constexpr explicit SparseSet(const AllocatorType& Allocator = {})
             noexcept(std::is_nothrow_constructible_v<SparseContainer, const AllocatorType&>)
-            : Sparse { Allocator }, Packed { Allocator }
+            : SparseSet { DeletionPolicy::SwapAndPop, Allocator }
+        {
+        }
+
+        constexpr explicit SparseSet(const DeletionPolicy Policy, const AllocatorType& Allocator = {})
+            noexcept(std::is_nothrow_constructible_v<SparseContainer, const AllocatorType&>)
+            : Sparse { Allocator }, Packed { Allocator }, Policy { Policy }, Head { FreeListEnd }
         {
+            EGG_ASSERT(Policy == DeletionPolicy::SwapAndPop || TraitsType::VersionMask, "In-place deletion requires versioned entities");
         }
 
         SparseSet(const SparseSet&) = delete;
 
-        constexpr SparseSet(SparseSet&&) noexcept(std::is_nothrow_move_constructible_v<SparseContainer>) = default;
+        constexpr SparseSet(SparseSet&& Other) noexcept(std::is_nothrow_move_constructible_v<SparseContainer>)
+            : Sparse { std::move(Other.Sparse) },
+              Packed { std::move(Other.Packed) },
+              Policy { Other.Policy },
+              Head { std::exchange(Other.Head, FreeListEnd) }
+        {
+        }
 
         constexpr SparseSet(SparseSet&& Other, const AllocatorType& Allocator) : Sparse { std::move(Other.Sparse), Allocator },
-                                                                                 Packed { std::move(Other.Packed), Allocator }
+                                                                                 Packed { std::move(Other.Packed), Allocator },
+                                                                                 Policy { Other.Policy },
+                                                                                 Head { std::exchange(Other.Head, FreeListEnd) }
         {
             EGG_ASSERT(ContainerAllocatorTraits::is_always_equal::value || GetAllocator() == Other.GetAllocator(),
                        "Cannot move sparse set because it has an incompatible allocator");
@@ -69,6 +108,8 @@ namespace egg::ECS::Containers
                        "Cannot move sparse set because it has an incompatible allocator");
             Sparse = std::move(Other.Sparse);
             Packed = std::move(Other.Packed);
+            Policy = Other.Policy;
+            Head = std::exchange(Other.Head, FreeListEnd);
             return *this;
         }
 
@@ -78,6 +119,8 @@ namespace egg::ECS::Containers
             using std::swap;
             swap(Left.Sparse, Right.Sparse);
             swap(Left.Packed, Right.Packed);
+            swap(Left.Policy, Right.Policy);
+            swap(Left.Head, Right.Head);
         }
 
         constexpr Iterator Push(const EntityType Entity)
@@ -121,9 +164,39 @@ namespace egg::ECS::Containers
         {
             for (auto Entity : *this)
             {
+                if (IsFree(Entity)) continue;
                 GetReference(Entity) = TraitsType::Tombstone;
             }
             Packed.clear();
+            Head = FreeListEnd;
+        }
+
+        constexpr virtual void Compact()
+        {
+            if (!HasTombstones()) return;
+
+            std::size_t Last { GetSize() };
+
+            const auto TrimFree { [this, &Last]
+            {
+                while (Last && IsFree(Packed[Last - 1u])) --Last;
+            } };
+
+            TrimFree();
+
+            for (auto Free { std::exchange(Head, FreeListEnd) }; Free != FreeListEnd;)
+            {
+                const auto Position { static_cast<std::size_t>(Free) };
+                Free = TraitsType::ToEntity(Packed[Position]);
+
+                if (Position < Last)
+                {
+                    MoveElementAt(--Last, Position);
+                    TrimFree();
+                }
+            }
+
+            Packed.resize(Last);
         }
 
         constexpr bool Remove(const EntityType Entity)
@@ -195,6 +268,33 @@ namespace egg::ECS::Containers
             return Element && (TraitsType::ToVersionPart(Entity) ^ TraitsType::ToIntegral(*Element)) < TraitsType::EntityMask;
         }
 
+        constexpr void ContainsMany(const std::span<const EntityType> Entities, const std::span<std::uint64_t> Mask) const noexcept
+        {
+            constexpr std::size_t MaskBits { sizeof(std::uint64_t) * CHAR_BIT };
+            EGG_ASSERT(Mask.size() * MaskBits >= Entities.size(), "Mask is too small");
+
+            std::ranges::fill(Mask.first((Entities.size() + MaskBits - 1u) / MaskBits), std::uint64_t {});
+            std::size_t Position {};
+
+#ifdef EGG_ECS_SPARSE_SET_AVX2
+            if constexpr (sizeof(EntityType) == sizeof(std::uint32_t) && std::is_pointer_v<typename SparseContainer::Pointer>)
+            {
+                if !consteval
+                {
+                    for (; Position + ContainsLanes <= Entities.size(); Position += ContainsLanes)
+                    {
+                        Mask[Position / MaskBits] |= std::uint64_t { ContainsLanesMask(Entities.data() + Position) } << Position % MaskBits;
+                    }
+                }
+            }
+#endif
+
+            for (; Position < Entities.size(); ++Position)
+            {
+                Mask[Position / MaskBits] |= std::uint64_t { Contains(Entities[Position]) } << Position % MaskBits;
+            }
+        }
+
         [[nodiscard]] constexpr std::size_t GetIndex(const EntityType Entity) const noexcept
         {
             EGG_ASSERT(Contains(Entity), "Set does not contain entity");
@@ -220,6 +320,7 @@ namespace egg::ECS::Containers
         template <typename CompareType, typename SortType = decltype(std::ranges::sort), typename ProjectionType = std::identity>
         constexpr void Sort(CompareType Compare, SortType Sort = SortType {}, ProjectionType Projection = ProjectionType {})
         {
+            Compact();
             SortCount(GetSize(), std::move(Compare), std::move(Sort), std::move(Projection));
         }
 
@@ -228,19 +329,60 @@ namespace egg::ECS::Containers
                                  CompareType Compare, SortType Sort = SortType {}, ProjectionType Projection = ProjectionType {})
         {
             EGG_ASSERT(Count <= GetSize(), "Count of elements to sort exceeds the number of elements");
+            EGG_ASSERT(!HasTombstones(), "Cannot sort a set with tombstones");
 
             Sort(Packed.rend() - Count, Packed.rend(), std::move(Compare), std::move(Projection));
 
-            for (std::size_t Position = 0u; Position < Count; ++Position)
+            constexpr Jobs::SequentialExecutor Sequential {};
+            ApplyPermutation(Count, Jobs::ExecutorReference { Sequential });
+        }
+
+        template <typename CompareType, Jobs::Executor ExecutorType, typename ProjectionType = std::identity>
+        void ParallelSort(CompareType Compare, ExecutorType& Executor, ProjectionType Projection = ProjectionType {})
+        {
+            Compact();
+            ParallelSortCount(GetSize(), std::move(Compare), Executor, std::move(Projection));
+        }
+
+        template <typename CompareType, Jobs::Executor ExecutorType, typename ProjectionType = std::identity>
+        void ParallelSortCount(const std::size_t Count, CompareType Compare, ExecutorType& Executor, ProjectionType Projection = ProjectionType {})
+        {
+            EGG_ASSERT(Count <= GetSize(), "Count of elements to sort exceeds the number of elements");
+            EGG_ASSERT(!HasTombstones(), "Cannot sort a set with tombstones");
+
+            egg::Containers::ParallelSort { Executor }(Packed.rend() - Count, Packed.rend(), std::move(Compare), std::move(Projection));
+            ApplyPermutation(Count, Jobs::ExecutorReference { Executor });
+        }
+
+        template <typename CompareType, typename ProjectionType = std::identity>
+        constexpr void SortIncremental(CompareType Compare, ProjectionType Projection = ProjectionType {})
+        {
+            Compact();
+            SortCountIncremental(GetSize(), std::move(Compare), std::move(Projection));
+        }
+
+        template <typename CompareType, typename ProjectionType = std::identity>
+        constexpr void SortCountIncremental(const std::size_t Count, CompareType Compare, ProjectionType Projection = ProjectionType {})
+        {
+            EGG_ASSERT(Count <= GetSize(), "Count of elements to sort exceeds the number of elements");
+            EGG_ASSERT(!HasTombstones(), "Cannot sort a set with tombstones");
+
+            const auto Precedes { [this, &Compare, &Projection](const std::size_t Position)
             {
-                std::size_t Current { Position };
-                std::size_t Next { GetIndex(Packed[Current]) };
+                return std::invoke(Compare, std::invoke(Projection, Packed[Position]), std::invoke(Projection, Packed[Position + 1u]));
+            } };
 
-                while (Current != Next)
+            for (std::size_t Position = Count > 1u ? Count - 1u : 0u, Budget = Count; Position--;)
+            {
+                for (std::size_t Current = Position; Current + 1u < Count && Precedes(Current); ++Current)
                 {
-                    const auto Index { GetIndex(Packed[Next]) };
-                    UpdateToPacked(Current, Next, Index);
-                    Current = std::exchange(Next, Index);
+                    if (!Budget--)
+                    {
+                        SortCount(Count, std::move(Compare), std::ranges::sort, std::move(Projection));
+                        return;
+                    }
+
+                    SwapElementsAt(Current, Current + 1u);
                 }
             }
         }
@@ -248,6 +390,7 @@ namespace egg::ECS::Containers
         template <typename IteratorType, std::sentinel_for<IteratorType> SentinelType>
         constexpr Iterator SortAs(IteratorType First, SentinelType Last)
         {
+            Compact();
             Iterator It { Begin() };
 
             for (const Iterator CurrentLast { End() };
@@ -272,6 +415,7 @@ namespace egg::ECS::Containers
         constexpr Iterator SortCountAs(const std::size_t Count, IteratorType First, SentinelType Last)
         {
             EGG_ASSERT(Count <= GetSize(), "Count of elements to sort exceeds the number of elements");
+            EGG_ASSERT(!HasTombstones(), "Cannot sort a set with tombstones");
 
             Iterator It { End() - Count };
 
@@ -303,6 +447,22 @@ namespace egg::ECS::Containers
             return Packed.empty();
         }
 
+        [[nodiscard]] constexpr DeletionPolicy GetPolicy() const noexcept
+        {
+            return Policy;
+        }
+
+        [[nodiscard]] constexpr bool HasTombstones() const noexcept
+        {
+            return Head != FreeListEnd;
+        }
+
+        [[nodiscard]] constexpr bool IsTombstoneAt(const std::size_t Position) const noexcept
+        {
+            EGG_ASSERT(Position < GetSize(), "Index out of bounds");
+            return IsFree(Packed[Position]);
+        }
+
         [[nodiscard]] constexpr std::size_t GetExtent() const noexcept
         {
             return Sparse.GetExtent();
@@ -324,6 +484,21 @@ namespace egg::ECS::Containers
             return Packed.capacity();
         }
 
+        [[nodiscard]] constexpr std::size_t GetSparsePagesCount() const noexcept
+        {
+            return Sparse.GetPagesCount();
+        }
+
+        [[nodiscard]] constexpr virtual std::size_t GetMemoryUsage() const noexcept
+        {
+            return (Sparse.GetExtent() + Packed.capacity()) * sizeof(EntityType);
+        }
+
+        [[nodiscard]] constexpr virtual std::string_view GetElementName() const noexcept
+        {
+            return {};
+        }
+
         [[nodiscard]] constexpr Iterator Begin() noexcept
         {
             return { Packed, GetSize() };
@@ -390,24 +565,80 @@ namespace egg::ECS::Containers
         }
 
     protected:
-        constexpr virtual void UpdateToPacked(
-            const std::size_t CurrentIndex,
-            [[maybe_unused]] const std::size_t LeftIndex,
-            [[maybe_unused]] const std::size_t RightIndex)
-        {
-            GetReference(Packed[CurrentIndex]) = TraitsType::Combine(
-                static_cast<typename TraitsType::EntityType>(CurrentIndex),
-                TraitsType::ToIntegral(Packed[CurrentIndex])
+        template <typename IteratorType, std::sentinel_for<IteratorType> SentinelType>
+        constexpr void Append(IteratorType First, const SentinelType Last)
+        {
+            if constexpr (std::sized_sentinel_for<SentinelType, IteratorType>)
+            {
+                Packed.reserve(GetSize() + static_cast<std::size_t>(std::ranges::distance(First, Last)));
+            }
+
+            for (; First != Last; ++First)
+            {
+                const EntityType Entity { *First };
+                EGG_ASSERT(Entity != TraitsType::Tombstone, "The entity cannot be a tombstone");
+                auto& Element { Assure(Entity) };
+                EGG_ASSERT(Element == TraitsType::Tombstone, "Slot not available");
+                Packed.push_back(Entity);
+                Element = TraitsType::Combine(static_cast<typename TraitsType::EntityType>(GetSize() - 1u), TraitsType::ToIntegral(Entity));
+            }
+        }
+
+        constexpr void Truncate(const std::size_t Size) noexcept
+        {
+            EGG_ASSERT(Size <= GetSize(), "Cannot truncate the sparse set beyond its size");
+
+            for (std::size_t Position = Size; Position < GetSize(); ++Position)
+            {
+                EGG_ASSERT(!IsTombstoneAt(Position), "Cannot truncate across tombstones");
+                GetReference(Packed[Position]) = TraitsType::Tombstone;
+            }
+
+            Packed.resize(Size);
+        }
+
+        constexpr virtual void ApplyPermutation(const std::size_t Count, const Jobs::ExecutorReference Executor)
+        {
+            Executor.ParallelFor(
+                Count,
+                Jobs::GetChunkSize(Count, Executor.GetConcurrency(), Memory::CacheLineAlignedCount<EntityType>),
+                [this](const std::size_t First, const std::size_t Last)
+                {
+                    for (std::size_t Position = First; Position < Last; ++Position)
+                    {
+                        GetReference(Packed[Position]) = TraitsType::Combine(
+                            static_cast<typename TraitsType::EntityType>(Position),
+                            TraitsType::ToIntegral(Packed[Position])
+                        );
+                    }
+                }
             );
         }
 
+        constexpr virtual void MoveElementAt(const std::size_t From, const std::size_t To)
+        {
+            const EntityType Entity { Packed[From] };
+            GetReference(Entity) = TraitsType::Combine(static_cast<typename TraitsType::EntityType>(To), TraitsType::ToIntegral(Entity));
+            Packed[To] = Entity;
+        }
+
         constexpr virtual Iterator TryEmplace(const EntityType Entity)
         {
             EGG_ASSERT(Entity != TraitsType::Tombstone, "The entity cannot be a tombstone");
             auto& Element { Assure(Entity) };
             EGG_ASSERT(Element == TraitsType::Tombstone, "Slot not available");
-            auto Position { GetSize() };
-            Packed.push_back(Entity);
+            std::size_t Position { GetSize() };
+
+            if (HasTombstones())
+            {
+                Position = static_cast<std::size_t>(Head);
+                Head = TraitsType::ToEntity(std::exchange(Packed[Position], Entity));
+            }
+            else
+            {
+                Packed.push_back(Entity);
+            }
+
             Element = TraitsType::Combine(static_cast<typename TraitsType::EntityType>(Position), TraitsType::ToIntegral(Entity));
             return End() - (Position + 1u);
         }
@@ -426,6 +657,16 @@ namespace egg::ECS::Containers
             auto& Index { GetReference(*It) };
             const auto EntityIndex { TraitsType::ToEntity(Index) };
 
+            if (Policy == DeletionPolicy::InPlace)
+            {
+                Packed[static_cast<std::size_t>(EntityIndex)] = TraitsType::Combine(
+                    std::exchange(Head, EntityIndex),
+                    TraitsType::ToIntegral(TraitsType::Tombstone)
+                );
+                Index = TraitsType::Tombstone;
+                return;
+            }
+
             GetReference(Packed.back()) = TraitsType::Combine(EntityIndex, TraitsType::ToIntegral(Packed.back()));
             Packed[static_cast<std::size_t>(EntityIndex)] = Packed.back();
 
@@ -434,6 +675,64 @@ namespace egg::ECS::Containers
         }
 
     private:
+        static constexpr auto FreeListEnd { TraitsType::EntityMask };
+
+#ifdef EGG_ECS_SPARSE_SET_AVX2
+        static constexpr std::size_t ContainsLanes { 8u };
+
+        [[nodiscard]] std::uint32_t ContainsLanesMask(const EntityType* const Entities) const noexcept
+        {
+            constexpr auto PageShift { static_cast<int>(std::countr_zero(static_cast<std::size_t>(TraitsType::PageSize))) };
+            constexpr auto VersionPartMask { static_cast<std::uint32_t>(TraitsType::ToVersionPart(TraitsType::Tombstone)) };
+            const std::span Pages { Sparse.GetPages() };
+
+            const __m256i Values { _mm256_loadu_si256(reinterpret_cast<const __m256i*>(Entities)) };
+            const __m256i Identifiers { _mm256_and_si256(Values, _mm256_set1_epi32(static_cast<int>(TraitsType::EntityMask))) };
+            const __m256i PageIndices { _mm256_srli_epi32(Identifiers, PageShift) };
+            const __m256i Offsets { _mm256_slli_epi32(_mm256_and_si256(Identifiers, _mm256_set1_epi32(static_cast<int>(TraitsType::PageSize - 1u))), 2) };
+            const __m256i InRange { _mm256_cmpgt_epi32(_mm256_set1_epi32(static_cast<int>(Pages.size())), PageIndices) };
+
+            const auto GatherHalf { [&Pages](const __m128i HalfPages, const __m128i HalfOffsets, const __m128i HalfInRange) noexcept
+            {
+                const __m256i PageMask { _mm256_cvtepi32_epi64(HalfInRange) };
+                const __m256i Bases { _mm256_mask_i32gather_epi64(
+                    _mm256_setzero_si256(), reinterpret_cast<const long long*>(Pages.data()), HalfPages, PageMask, 8
+                ) };
+                const __m256i Mapped { _mm256_andnot_si256(_mm256_cmpeq_epi64(Bases, _mm256_setzero_si256()), PageMask) };
+                const __m256i Addresses { _mm256_add_epi64(Bases, _mm256_cvtepu32_epi64(HalfOffsets)) };
+                const __m128i ElementMask { _mm256_castsi256_si128(_mm256_permutevar8x32_epi32(Mapped, _mm256_setr_epi32(0, 2, 4, 6, 1, 3, 5, 7))) };
+
+                return std::pair {
+                    _mm256_mask_i64gather_epi32(_mm_setzero_si128(), static_cast<const int*>(nullptr), Addresses, ElementMask, 1),
+                    ElementMask
+                };
+            } };
+
+            const auto [LowElements, LowMapped] { GatherHalf(
+                _mm256_castsi256_si128(PageIndices), _mm256_castsi256_si128(Offsets), _mm256_castsi256_si128(InRange)
+            ) };
+            const auto [HighElements, HighMapped] { GatherHalf(
+                _mm256_extracti128_si256(PageIndices, 1), _mm256_extracti128_si256(Offsets, 1), _mm256_extracti128_si256(InRange, 1)
+            ) };
+
+            const __m256i Elements { _mm256_set_m128i(HighElements, LowElements) };
+            const __m256i Mapped { _mm256_set_m128i(HighMapped, LowMapped) };
+
+            const __m256i Difference { _mm256_xor_si256(_mm256_and_si256(Values, _mm256_set1_epi32(static_cast<int>(VersionPartMask))), Elements) };
+            const __m256i Matching { _mm256_cmpeq_epi32(
+                _mm256_min_epu32(Difference, _mm256_set1_epi32(static_cast<int>(TraitsType::EntityMask - 1u))),
+                Difference
+            ) };
+
+            return static_cast<std::uint32_t>(_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_and_si256(Matching, Mapped))));
+        }
+#endif
+
+        [[nodiscard]] constexpr bool IsFree(const EntityType Entity) const noexcept
+        {
+            return Policy == DeletionPolicy::InPlace && TraitsType::ToVersionPart(Entity) == TraitsType::ToVersionPart(TraitsType::Tombstone);
+        }
+
         [[nodiscard]] constexpr ConstPointer GetPointer(const EntityType Entity) const
         {
             return Sparse.GetPointer(TraitsType::ToEntity(Entity));
@@ -461,6 +760,8 @@ namespace egg::ECS::Containers
 
         SparseContainer Sparse;
         PackedContainer Packed;
+        DeletionPolicy Policy;
+        typename TraitsType::EntityType Head;
     };
 }
 
@@ -0,0 +1,231 @@
+#ifndef ENGINE_SOURCES_ECS_CONTAINERS_STORAGE_INTERNAL_FILE_CHANGE_TICKS_H
+#define ENGINE_SOURCES_ECS_CONTAINERS_STORAGE_INTERNAL_FILE_CHANGE_TICKS_H
+
+#include <ECS/Traits/ChangeTrackingTraits.h>
+#include <Jobs/Executor.h>
+#include <Memory/Constants.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace egg::ECS::Containers::Internal
+{
+    template <typename AllocatorParameter, bool Enabled>
+    class ChangeTicks
+    {
+    public:
+        static constexpr bool IsEnabled { false };
+
+
+        constexpr explicit ChangeTicks(const AllocatorParameter&) noexcept
+        {
+        }
+
+        constexpr ChangeTicks(ChangeTicks&&, const AllocatorParameter&) noexcept
+        {
+        }
+
+        constexpr void Stamp(std::size_t, std::size_t) noexcept
+        {
+        }
+
+        constexpr void Pop(std::size_t, std::size_t) noexcept
+        {
+        }
+
+        constexpr void Swap(std::size_t, std::size_t) noexcept
+        {
+        }
+
+        constexpr void Move(std::size_t, std::size_t) noexcept
+        {
+        }
+
+        template <typename CallableType, typename ExecutorType>
+        constexpr void Permute(std::size_t, CallableType&&, const ExecutorType&) noexcept
+        {
+        }
+
+        constexpr void Reserve(std::size_t)
+        {
+        }
+
+        constexpr void Shrink(std::size_t) noexcept
+        {
+        }
+
+        constexpr void Clear() noexcept
+        {
+        }
+
+        [[nodiscard]] constexpr std::size_t GetMemoryUsage() const noexcept
+        {
+            return 0u;
+        }
+    };
+
+
+    template <typename AllocatorParameter>
+    class ChangeTicks<AllocatorParameter, true>
+    {
+        using TicksType = std::vector<ChangeTick, typename std::allocator_traits<AllocatorParameter>::template rebind_alloc<ChangeTick>>;
+
+    public:
+        static constexpr bool IsEnabled { true };
+        static constexpr std::size_t BlockSize { Memory::CacheLineSize / sizeof(ChangeTick) };
+
+
+        constexpr explicit ChangeTicks(const AllocatorParameter& Allocator)
+            : Ticks { Allocator }, Blocks { Allocator }, Current {}
+        {
+        }
+
+        constexpr ChangeTicks(ChangeTicks&& Other, const AllocatorParameter& Allocator)
+            : Ticks { std::move(Other.Ticks), Allocator },
+              Blocks { std::move(Other.Blocks), Allocator },
+              Current { Other.Current }
+        {
+        }
+
+        constexpr void Stamp(const std::size_t From, const std::size_t To)
+        {
+            if (Ticks.size() < To)
+            {
+                Ticks.resize(To);
+                Blocks.resize((To + BlockSize - 1u) / BlockSize);
+            }
+
+            std::fill(Ticks.begin() + static_cast<std::ptrdiff_t>(From), Ticks.begin() + static_cast<std::ptrdiff_t>(To), Current);
+
+            for (std::size_t Position = From; Position < To; Position += BlockSize)
+            {
+                Raise(Position, Current);
+            }
+
+            if (From < To)
+            {
+                Raise(To - 1u, Current);
+            }
+        }
+
+        constexpr void Pop(const std::size_t Position, const std::size_t Last)
+        {
+            Raise(Position, Ticks[Position] = Ticks[Last]);
+            Ticks.resize(Last);
+        }
+
+        constexpr void Swap(const std::size_t Left, const std::size_t Right) noexcept
+        {
+            std::swap(Ticks[Left], Ticks[Right]);
+            Raise(Left, Ticks[Left]);
+            Raise(Right, Ticks[Right]);
+        }
+
+        constexpr void Move(const std::size_t From, const std::size_t To) noexcept
+        {
+            Raise(To, Ticks[To] = Ticks[From]);
+        }
+
+        template <typename CallableType, typename ExecutorType>
+        constexpr void Permute(const std::size_t Count, CallableType&& IndexOf, const ExecutorType& Executor)
+        {
+            TicksType Sorted(Count, ChangeTick {}, Ticks.get_allocator());
+            const std::size_t Grain { Jobs::GetChunkSize(Count, Executor.GetConcurrency(), BlockSize) };
+
+            Executor.ParallelFor(Count, Grain, [this, &Sorted, &IndexOf](const std::size_t From, const std::size_t To)
+            {
+                for (std::size_t Position = From; Position < To; ++Position)
+                {
+                    Sorted[Position] = Ticks[IndexOf(Position)];
+                }
+            });
+
+            Executor.ParallelFor(Count, Grain, [this, &Sorted](const std::size_t From, const std::size_t To)
+            {
+                std::copy(Sorted.begin() + static_cast<std::ptrdiff_t>(From), Sorted.begin() + static_cast<std::ptrdiff_t>(To),
+                          Ticks.begin() + static_cast<std::ptrdiff_t>(From));
+
+                for (std::size_t Block = From / BlockSize, Last = (To + BlockSize - 1u) / BlockSize; Block < Last; ++Block)
+                {
+                    const auto First { Ticks.begin() + static_cast<std::ptrdiff_t>(Block * BlockSize) };
+                    Blocks[Block] = *std::max_element(First, First + static_cast<std::ptrdiff_t>(std::min(BlockSize, Ticks.size() - Block * BlockSize)));
+                }
+            });
+        }
+
+        constexpr void Reserve(const std::size_t Capacity)
+        {
+            Ticks.reserve(Capacity);
+            Blocks.reserve((Capacity + BlockSize - 1u) / BlockSize);
+        }
+
+        constexpr void Shrink(const std::size_t Size)
+        {
+            Ticks.resize(std::min(Ticks.size(), Size));
+            Blocks.resize(std::min(Blocks.size(), (Size + BlockSize - 1u) / BlockSize));
+            Ticks.shrink_to_fit();
+            Blocks.shrink_to_fit();
+        }
+
+        constexpr void Clear() noexcept
+        {
+            Ticks.clear();
+            Blocks.clear();
+        }
+
+        template <typename CallableType>
+        constexpr void EachSince(const ChangeTick Since, const std::size_t Size, CallableType&& Callable) const
+        {
+            for (std::size_t Block = std::min(Blocks.size(), (Size + BlockSize - 1u) / BlockSize); Block-- > 0u;)
+            {
+                if (Blocks[Block] <= Since) continue;
+
+                const std::size_t First { Block * BlockSize };
+
+                for (std::size_t Position = std::min(First + BlockSize, Ticks.size()); Position-- > First;)
+                {
+                    if (Ticks[Position] > Since)
+                    {
+                        Callable(Position);
+                    }
+                }
+            }
+        }
+
+        [[nodiscard]] constexpr ChangeTick GetTick(const std::size_t Position) const noexcept
+        {
+            return Ticks[Position];
+        }
+
+        [[nodiscard]] constexpr ChangeTick GetCurrent() const noexcept
+        {
+            return Current;
+        }
+
+        constexpr void SetCurrent(const ChangeTick Tick) noexcept
+        {
+            Current = Tick;
+        }
+
+        [[nodiscard]] constexpr std::size_t GetMemoryUsage() const noexcept
+        {
+            return (Ticks.capacity() + Blocks.capacity()) * sizeof(ChangeTick);
+        }
+
+    private:
+        constexpr void Raise(const std::size_t Position, const ChangeTick Tick) noexcept
+        {
+            ChangeTick& Block { Blocks[Position / BlockSize] };
+            Block = std::max(Block, Tick);
+        }
+
+        TicksType Ticks;
+        TicksType Blocks;
+        ChangeTick Current;
+    };
+}
+
+#endif // ENGINE_SOURCES_ECS_CONTAINERS_STORAGE_INTERNAL_FILE_CHANGE_TICKS_H
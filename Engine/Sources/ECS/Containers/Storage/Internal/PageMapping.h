@@ -0,0 +1,80 @@
+#ifndef ENGINE_SOURCES_ECS_CONTAINERS_STORAGE_INTERNAL_FILE_PAGE_MAPPING_H
+#define ENGINE_SOURCES_ECS_CONTAINERS_STORAGE_INTERNAL_FILE_PAGE_MAPPING_H
+
+#include <cstddef>
+#include <memory>
+#include <utility>
+
+namespace egg::ECS::Containers::Internal
+{
+    template <bool Enabled>
+    class PageMapping
+    {
+    public:
+        static constexpr bool IsEnabled { false };
+
+
+        [[nodiscard]] constexpr std::size_t GetPagesCount() const noexcept
+        {
+            return 0u;
+        }
+
+        constexpr void Shrink(std::size_t) noexcept
+        {
+        }
+    };
+
+
+    template <>
+    class PageMapping<true>
+    {
+    public:
+        static constexpr bool IsEnabled { true };
+
+
+        PageMapping() noexcept : PagesCount {}
+        {
+        }
+
+        PageMapping(PageMapping&& Other) noexcept : Owner { std::move(Other.Owner) },
+                                                    PagesCount { std::exchange(Other.PagesCount, 0u) }
+        {
+        }
+
+        PageMapping& operator=(PageMapping&& Other) noexcept
+        {
+            Owner = std::move(Other.Owner);
+            PagesCount = std::exchange(Other.PagesCount, 0u);
+            return *this;
+        }
+
+        void Adopt(std::shared_ptr<void> Mapping, const std::size_t Count) noexcept
+        {
+            Owner = std::move(Mapping);
+            PagesCount = Count;
+        }
+
+        [[nodiscard]] std::size_t GetPagesCount() const noexcept
+        {
+            return PagesCount;
+        }
+
+        void Shrink(const std::size_t Count) noexcept
+        {
+            if (Count >= PagesCount) return;
+
+            PagesCount = Count;
+
+            if (!PagesCount)
+            {
+                Owner.reset();
+            }
+        }
+
+    private:
+        std::shared_ptr<void> Owner;
+        std::size_t PagesCount;
+    };
+}
+
+#endif // ENGINE_SOURCES_ECS_CONTAINERS_STORAGE_INTERNAL_FILE_PAGE_MAPPING_H
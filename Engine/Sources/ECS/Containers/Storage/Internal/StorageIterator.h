@@ -2,15 +2,20 @@
 #define ENGINE_SOURCES_ECS_CONTAINERS_STORAGE_INTERNAL_FILE_STORAGE_ITERATOR_H
 
 #include <Containers/PointerImitator.h>
+#include <ECS/Traits/EntityTraits.h>
 
 #include <iterator>
 #include <tuple>
+#include <type_traits>
+#include <variant>
 
 namespace egg::ECS::Containers::Internal
 {
-    template <typename EntityIteratorParameter, typename ElementIteratorParameter>
+    template <typename EntityIteratorParameter, typename ElementIteratorParameter, bool SkipsTombstones = false>
     class StorageIterator final
     {
+        using LastType = std::conditional_t<SkipsTombstones, EntityIteratorParameter, std::monostate>;
+
     public:
         using EntityIteratorType = EntityIteratorParameter;
         using ElementIteratorType = ElementIteratorParameter;
@@ -23,18 +28,23 @@ namespace egg::ECS::Containers::Internal
         using iterator_concept = std::forward_iterator_tag;
 
 
-        constexpr StorageIterator() : EntityIterator {}, ElementIterator {}
+        constexpr StorageIterator() : EntityIterator {}, ElementIterator {}, Last {}
         {
         }
 
-        constexpr explicit StorageIterator(EntityIteratorType EntityIterator, ElementIteratorType ElementIterator)
-            : EntityIterator { EntityIterator }, ElementIterator { ElementIterator }
+        constexpr explicit StorageIterator(EntityIteratorType EntityIterator, ElementIteratorType ElementIterator, EntityIteratorType Last)
+            : EntityIterator { EntityIterator }, ElementIterator { ElementIterator }, Last {}
         {
+            if constexpr (SkipsTombstones)
+            {
+                this->Last = Last;
+                SkipTombstones();
+            }
         }
 
         template <std::convertible_to<ElementIteratorType> OtherIterator> requires (!std::same_as<OtherIterator, ElementIteratorType>)
-        constexpr explicit StorageIterator(const StorageIterator<EntityIteratorType, OtherIterator>& Other)
-            : EntityIterator { Other.EntityIterator }, ElementIterator { Other.ElementIterator }
+        constexpr explicit StorageIterator(const StorageIterator<EntityIteratorType, OtherIterator, SkipsTombstones>& Other)
+            : EntityIterator { Other.EntityIterator }, ElementIterator { Other.ElementIterator }, Last { Other.Last }
         {
         }
 
@@ -42,6 +52,7 @@ namespace egg::ECS::Containers::Internal
         {
             ++EntityIterator;
             ++ElementIterator;
+            SkipTombstones();
             return *this;
         }
 
@@ -63,20 +74,36 @@ namespace egg::ECS::Containers::Internal
         }
 
         template <std::convertible_to<ElementIteratorType> OtherIterator>
-        [[nodiscard]] constexpr bool operator==(const StorageIterator<EntityIteratorType, OtherIterator>& Other) const noexcept
+        [[nodiscard]] constexpr bool operator==(const StorageIterator<EntityIteratorType, OtherIterator, SkipsTombstones>& Other) const noexcept
         {
             return EntityIterator == Other.EntityIterator;
         }
 
         template <std::convertible_to<ElementIteratorType> OtherIterator>
-        [[nodiscard]] constexpr bool operator!=(const StorageIterator<EntityIteratorType, OtherIterator>& Other) const noexcept
+        [[nodiscard]] constexpr bool operator!=(const StorageIterator<EntityIteratorType, OtherIterator, SkipsTombstones>& Other) const noexcept
         {
             return !(*this == Other);
         }
 
     private:
+        constexpr void SkipTombstones() noexcept
+        {
+            if constexpr (SkipsTombstones)
+            {
+                using TraitsType = EntityTraits<std::iter_value_t<EntityIteratorType>>;
+                constexpr auto TombstoneVersion { TraitsType::ToVersionPart(TraitsType::Tombstone) };
+
+                while (EntityIterator != Last && TraitsType::ToVersionPart(*EntityIterator) == TombstoneVersion)
+                {
+                    ++EntityIterator;
+                    ++ElementIterator;
+                }
+            }
+        }
+
         EntityIteratorType EntityIterator;
         ElementIteratorType ElementIterator;
+        [[no_unique_address]] LastType Last;
     };
 }
 
@@ -1,6 +1,8 @@
 #ifndef ENGINE_SOURCES_ECS_CONTAINERS_STORAGE_FILE_STORAGE_H
 #define ENGINE_SOURCES_ECS_CONTAINERS_STORAGE_FILE_STORAGE_H
 
+#include "./Internal/ChangeTicks.h"
+#include "./Internal/PageMapping.h"
 #include "./Internal/StorageIterator.h"
 
 #include <Containers/IterableAdaptor.h>
@@ -8,13 +10,26 @@
 #include <ECS/Entity.h>
 #include <ECS/Containers/Container.h>
 #include <ECS/Containers/SparseSet/SparseSet.h>
+#include <ECS/Traits/ChangeTrackingTraits.h>
+#include <ECS/Traits/InPlaceDeleteTraits.h>
 #include <ECS/Traits/PageSizeTraits.h>
+#include <Jobs/Executor.h>
+#include <Jobs/ExecutorReference.h>
+#include <Memory/Constants.h>
 #include <Types/Capabilities/Capabilities.h>
+#include <Types/TypeInfo/TypeInfo.h>
 
+#include <algorithm>
+#include <cstring>
+#include <functional>
 #include <iterator>
+#include <memory>
+#include <span>
 #include <stdexcept>
+#include <string_view>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 namespace egg::ECS::Containers
 {
@@ -28,6 +43,8 @@ namespace egg::ECS::Containers
     {
         using ContainerAllocatorTraits = AllocatorTraits<AllocatorParameter>;
         using ContainerType = PagedVector<Type, AllocatorParameter>;
+        using ChangeTicksType = Internal::ChangeTicks<AllocatorParameter, ChangeTrackingTraits<Type>::value>;
+        using PageMappingType = Internal::PageMapping<std::is_trivially_copyable_v<Type>>;
 
     public:
         using BaseType = SparseSet<EntityParameter, typename ContainerAllocatorTraits::template rebind_alloc<EntityParameter>>;
@@ -52,10 +69,10 @@ namespace egg::ECS::Containers
         using EntitiesReverseIterator = typename BaseType::ReverseIterator;
         using EntitiesConstReverseIterator = typename BaseType::ConstReverseIterator;
 
-        using EachIterator = Internal::StorageIterator<EntitiesIterator, Iterator>;
-        using EachConstIterator = Internal::StorageIterator<EntitiesConstIterator, ConstIterator>;
-        using EachReverseIterator = Internal::StorageIterator<EntitiesReverseIterator, ReverseIterator>;
-        using EachConstReverseIterator = Internal::StorageIterator<EntitiesConstReverseIterator, ConstReverseIterator>;
+        using EachIterator = Internal::StorageIterator<EntitiesIterator, Iterator, InPlaceDeleteTraits<Type>::value>;
+        using EachConstIterator = Internal::StorageIterator<EntitiesConstIterator, ConstIterator, InPlaceDeleteTraits<Type>::value>;
+        using EachReverseIterator = Internal::StorageIterator<EntitiesReverseIterator, ReverseIterator, InPlaceDeleteTraits<Type>::value>;
+        using EachConstReverseIterator = Internal::StorageIterator<EntitiesConstReverseIterator, ConstReverseIterator, InPlaceDeleteTraits<Type>::value>;
 
         using ElementsIterable = egg::Containers::IterableAdaptor<Iterator>;
         using ElementsConstIterable = egg::Containers::IterableAdaptor<ConstIterator>;
@@ -67,6 +84,11 @@ namespace egg::ECS::Containers
         using EachReverseIterable = egg::Containers::IterableAdaptor<EachReverseIterator>;
         using EachConstReverseIterable = egg::Containers::IterableAdaptor<EachConstReverseIterator>;
 
+        static constexpr bool TracksChanges { ChangeTicksType::IsEnabled };
+        static constexpr bool DeletesInPlace { InPlaceDeleteTraits<Type>::value };
+
+        static_assert(!DeletesInPlace || std::is_nothrow_move_constructible_v<Type>, "In-place deletion requires a nothrow movable type");
+
 
         constexpr Storage() : Storage { AllocatorType {} }
         {
@@ -76,7 +98,10 @@ namespace egg::ECS::Containers
             noexcept(
                 std::is_nothrow_constructible_v<BaseType, const AllocatorType&> &&
                 std::is_nothrow_constructible_v<ContainerType, const AllocatorType&>)
-            : BaseType { Allocator }, Payload { Allocator }
+            : BaseType { DeletesInPlace ? DeletionPolicy::InPlace : DeletionPolicy::SwapAndPop, Allocator },
+              Payload { Allocator },
+              Changes { Allocator },
+              Mapping {}
         {
         }
 
@@ -86,7 +111,9 @@ namespace egg::ECS::Containers
             noexcept(std::is_nothrow_move_constructible_v<BaseType> && std::is_nothrow_move_constructible_v<ContainerType>) = default;
 
         constexpr Storage(Storage&& Other, const AllocatorType& Allocator) : BaseType { std::move(Other), Allocator },
-                                                                             Payload { std::move(Other.Payload), Allocator }
+                                                                             Payload { std::move(Other.Payload), Allocator },
+                                                                             Changes { std::move(Other.Changes), Allocator },
+                                                                             Mapping { std::move(Other.Mapping) }
         {
             EGG_ASSERT(ContainerAllocatorTraits::is_always_equal::value || GetElementAllocator() == Other.GetElementAllocator(),
                        "Cannot move storage because it has an incompatible allocator");
@@ -107,6 +134,8 @@ namespace egg::ECS::Containers
             ShrinkToSize(0u);
             BaseType::operator=(std::move(Other));
             Payload = std::move(Other.Payload);
+            Changes = std::move(Other.Changes);
+            Mapping = std::move(Other.Mapping);
             return *this;
         }
 
@@ -116,6 +145,8 @@ namespace egg::ECS::Containers
             using std::swap;
             swap(static_cast<BaseType&>(Left), static_cast<BaseType&>(Right));
             swap(Left.Payload, Right.Payload);
+            swap(Left.Changes, Right.Changes);
+            swap(Left.Mapping, Right.Mapping);
         }
 
         template <typename... Args>
@@ -148,6 +179,22 @@ namespace egg::ECS::Containers
             requires (std::same_as<std::iter_value_t<ContainerIteratorType>, ElementType>)
         constexpr Iterator Insert(EntityIteratorType First, SentinelType Last, ContainerIteratorType From)
         {
+            if constexpr (
+                std::is_trivially_copyable_v<ElementType> &&
+                std::contiguous_iterator<ContainerIteratorType> &&
+                std::sized_sentinel_for<SentinelType, EntityIteratorType>)
+            {
+                if (!std::is_constant_evaluated())
+                {
+                    InsertTrivial(First, Last, [Source = std::to_address(From)](const std::span<ElementType> Run) mutable noexcept
+                    {
+                        std::memcpy(Run.data(), Source, Run.size_bytes());
+                        Source += Run.size();
+                    });
+                    return ElementsBegin();
+                }
+            }
+
             for (; First != Last; ++First, ++From)
             {
                 EmplaceElement(*First, *From);
@@ -156,11 +203,48 @@ namespace egg::ECS::Containers
             return ElementsBegin();
         }
 
+        template <typename EntityIteratorType, std::sized_sentinel_for<EntityIteratorType> SentinelType,
+                  std::invocable<std::span<ElementType>> CallableType>
+            requires std::is_trivially_copyable_v<ElementType>
+        Iterator InsertForOverwrite(EntityIteratorType First, SentinelType Last, CallableType Fill)
+        {
+            InsertTrivial(First, Last, std::move(Fill));
+            return ElementsBegin();
+        }
+
+        template <typename EntityIteratorType, std::sized_sentinel_for<EntityIteratorType> SentinelType>
+            requires std::is_trivially_copyable_v<ElementType>
+        Iterator Adopt(EntityIteratorType First, SentinelType Last, const std::span<ElementType> Pages, std::shared_ptr<void> Owner)
+        {
+            EGG_ASSERT(BaseType::Empty(), "Cannot adopt pages into a non-empty storage");
+            EGG_ASSERT(static_cast<std::size_t>(std::ranges::distance(First, Last)) <= Pages.size(), "Adopted pages are too small");
+
+            ShrinkToSize(0u);
+            Payload.Adopt(Pages);
+            Mapping.Adopt(std::move(Owner), Payload.GetPagesCount());
+
+            try
+            {
+                BaseType::Append(First, Last);
+                Changes.Stamp(0u, BaseType::GetSize());
+            }
+            catch (...)
+            {
+                BaseType::Clear();
+                ShrinkToSize(0u);
+                throw;
+            }
+
+            return ElementsBegin();
+        }
+
         template <typename... CallableTypes>
         constexpr ElementType& Patch(const EntityType Entity, CallableTypes&&... Callables)
         {
-            auto& Element { Payload.GetReference(BaseType::GetIndex(Entity)) };
+            const std::size_t Index { BaseType::GetIndex(Entity) };
+            auto& Element { Payload.GetReference(Index) };
             (std::invoke(std::forward<CallableTypes>(Callables), Element), ...);
+            Changes.Stamp(Index, Index + 1u);
             return Element;
         }
 
@@ -170,9 +254,18 @@ namespace egg::ECS::Containers
 
             for (auto First = BaseType::Begin(), Last = BaseType::End(); First != Last; ++First)
             {
-                BaseType::Erase(First);
+                if (BaseType::IsTombstoneAt(First.GetIndex())) continue;
                 ContainerAllocatorTraits::destroy(Allocator, std::addressof(Payload.GetReference(First.GetIndex())));
             }
+
+            BaseType::Clear();
+            Changes.Clear();
+        }
+
+        constexpr void Compact() override
+        {
+            BaseType::Compact();
+            Changes.Shrink(BaseType::GetSize());
         }
 
         constexpr void SwapElementsAt(const std::size_t Left, const std::size_t Right) override
@@ -186,6 +279,7 @@ namespace egg::ECS::Containers
             if (!Capacity) return;
             BaseType::Reserve(Capacity);
             Payload.Assure(Capacity - 1u);
+            Changes.Reserve(Capacity);
         }
 
         constexpr void ShrinkToFit() override
@@ -286,12 +380,12 @@ namespace egg::ECS::Containers
 
         [[nodiscard]] constexpr EachIterator EachBegin() noexcept
         {
-            return EachIterator { BaseType::Begin(), ElementsBegin() };
+            return EachIterator { BaseType::Begin(), ElementsBegin(), BaseType::End() };
         }
 
         [[nodiscard]] constexpr EachConstIterator EachBegin() const noexcept
         {
-            return EachConstIterator { BaseType::Begin(), ElementsBegin() };
+            return EachConstIterator { BaseType::Begin(), ElementsBegin(), BaseType::End() };
         }
 
         [[nodiscard]] constexpr EachConstIterator EachConstBegin() const noexcept
@@ -301,12 +395,12 @@ namespace egg::ECS::Containers
 
         [[nodiscard]] constexpr EachIterator EachEnd() noexcept
         {
-            return EachIterator { BaseType::End(), ElementsEnd() };
+            return EachIterator { BaseType::End(), ElementsEnd(), BaseType::End() };
         }
 
         [[nodiscard]] constexpr EachConstIterator EachEnd() const noexcept
         {
-            return EachConstIterator { BaseType::End(), ElementsEnd() };
+            return EachConstIterator { BaseType::End(), ElementsEnd(), BaseType::End() };
         }
 
         [[nodiscard]] constexpr EachConstIterator EachConstEnd() const noexcept
@@ -316,12 +410,12 @@ namespace egg::ECS::Containers
 
         [[nodiscard]] constexpr EachReverseIterator EachReverseBegin() noexcept
         {
-            return EachReverseIterator { BaseType::ReverseBegin(), ElementsReverseBegin() };
+            return EachReverseIterator { BaseType::ReverseBegin(), ElementsReverseBegin(), BaseType::ReverseEnd() };
         }
 
         [[nodiscard]] constexpr EachConstReverseIterator EachReverseBegin() const noexcept
         {
-            return EachConstReverseIterator { BaseType::ReverseBegin(), ElementsReverseBegin() };
+            return EachConstReverseIterator { BaseType::ReverseBegin(), ElementsReverseBegin(), BaseType::ReverseEnd() };
         }
 
         [[nodiscard]] constexpr EachConstReverseIterator EachConstReverseBegin() const noexcept
@@ -331,12 +425,12 @@ namespace egg::ECS::Containers
 
         [[nodiscard]] constexpr EachReverseIterator EachReverseEnd() noexcept
         {
-            return EachReverseIterator { BaseType::ReverseEnd(), ElementsReverseEnd() };
+            return EachReverseIterator { BaseType::ReverseEnd(), ElementsReverseEnd(), BaseType::ReverseEnd() };
         }
 
         [[nodiscard]] constexpr EachConstReverseIterator EachReverseEnd() const noexcept
         {
-            return EachConstReverseIterator { BaseType::ReverseEnd(), ElementsReverseEnd() };
+            return EachConstReverseIterator { BaseType::ReverseEnd(), ElementsReverseEnd(), BaseType::ReverseEnd() };
         }
 
         [[nodiscard]] constexpr EachConstReverseIterator EachConstReverseEnd() const noexcept
@@ -384,11 +478,98 @@ namespace egg::ECS::Containers
             return Payload.GetReference(BaseType::GetIndex(Entity));
         }
 
+        [[nodiscard]] constexpr ChangeTick GetChangedTick(const EntityType Entity) const noexcept requires TracksChanges
+        {
+            return Changes.GetTick(BaseType::GetIndex(Entity));
+        }
+
+        constexpr void MarkChanged(const EntityType Entity) requires TracksChanges
+        {
+            const std::size_t Index { BaseType::GetIndex(Entity) };
+            Changes.Stamp(Index, Index + 1u);
+        }
+
+        [[nodiscard]] constexpr ChangeTick GetCurrentTick() const noexcept requires TracksChanges
+        {
+            return Changes.GetCurrent();
+        }
+
+        constexpr void SetCurrentTick(const ChangeTick Tick) noexcept requires TracksChanges
+        {
+            Changes.SetCurrent(Tick);
+        }
+
+        template <std::invocable<EntityType, ElementType&> CallableType> requires TracksChanges
+        constexpr void EachChanged(const ChangeTick Since, CallableType Callable)
+        {
+            Changes.EachSince(Since, BaseType::GetSize(), [this, &Callable](const std::size_t Position)
+            {
+                if (BaseType::IsTombstoneAt(Position)) return;
+                std::invoke(Callable, BaseType::operator[](Position), Payload.GetReference(Position));
+            });
+        }
+
+        template <std::invocable<EntityType, const ElementType&> CallableType> requires TracksChanges
+        constexpr void EachChanged(const ChangeTick Since, CallableType Callable) const
+        {
+            Changes.EachSince(Since, BaseType::GetSize(), [this, &Callable](const std::size_t Position)
+            {
+                if (BaseType::IsTombstoneAt(Position)) return;
+                std::invoke(Callable, BaseType::operator[](Position), std::as_const(Payload.GetReference(Position)));
+            });
+        }
+
+        template <std::invocable<std::span<const ElementType>> CallableType>
+        constexpr void EachPage(CallableType Callable) const
+        {
+            constexpr std::size_t PageSize { PageSizeTraits<ElementType>::value };
+            const bool Sparse { BaseType::HasTombstones() };
+
+            for (std::size_t Position = 0u, Size = BaseType::GetSize(); Position < Size;)
+            {
+                std::size_t Last { std::min(Size, (Position / PageSize + 1u) * PageSize) };
+
+                if (Sparse)
+                {
+                    if (BaseType::IsTombstoneAt(Position))
+                    {
+                        ++Position;
+                        continue;
+                    }
+
+                    for (std::size_t Current = Position + 1u; Current < Last; ++Current)
+                    {
+                        if (BaseType::IsTombstoneAt(Current))
+                        {
+                            Last = Current;
+                            break;
+                        }
+                    }
+                }
+
+                std::invoke(Callable, std::span<const ElementType> {
+                    std::addressof(Payload.GetReference(Position)),
+                    Last - Position
+                });
+                Position = Last;
+            }
+        }
+
         [[nodiscard]] constexpr std::size_t GetCapacity() const noexcept override
         {
             return Payload.GetExtent();
         }
 
+        [[nodiscard]] constexpr std::size_t GetMemoryUsage() const noexcept override
+        {
+            return BaseType::GetMemoryUsage() + Payload.GetExtent() * sizeof(ElementType) + Changes.GetMemoryUsage();
+        }
+
+        [[nodiscard]] constexpr std::string_view GetElementName() const noexcept override
+        {
+            return Types::TypeInfo<Type>::GetName();
+        }
+
         [[nodiscard]] constexpr AllocatorType GetElementAllocator() const noexcept
         {
             return Payload.GetAllocator();
@@ -409,12 +590,25 @@ namespace egg::ECS::Containers
 
         constexpr void Pop(typename BaseType::Iterator First, typename BaseType::Iterator Last) override
         {
+            if constexpr (DeletesInPlace)
+            {
+                for (AllocatorType Allocator { GetElementAllocator() }; First != Last; ++First)
+                {
+                    ContainerAllocatorTraits::destroy(Allocator, std::addressof(Payload.GetReference(BaseType::GetIndex(*First))));
+                    BaseType::Erase(First);
+                }
+
+                return;
+            }
+
             for (AllocatorType Allocator { GetElementAllocator() }; First != Last; ++First)
             {
-                auto& Element { Payload.GetReference(BaseType::GetIndex(*First)) };
+                const std::size_t Index { BaseType::GetIndex(*First) };
+                auto& Element { Payload.GetReference(Index) };
                 auto& Other { Payload.GetReference(BaseType::GetSize() - 1u) };
                 Element = std::move(Other);
                 ContainerAllocatorTraits::destroy(Allocator, std::addressof(Other));
+                Changes.Pop(Index, BaseType::GetSize() - 1u);
                 BaseType::Erase(First);
             }
         }
@@ -427,22 +621,138 @@ namespace egg::ECS::Containers
 
             try
             {
+                Changes.Stamp(It.GetIndex(), It.GetIndex() + 1u);
                 std::uninitialized_construct_using_allocator(std::addressof(Payload.Assure(It.GetIndex())), GetElementAllocator(),
                                                              std::forward<Args>(Arguments)...);
             }
             catch (...)
             {
                 BaseType::Erase(It);
+                Changes.Shrink(BaseType::GetSize());
                 throw std::runtime_error("Failed to construct element");
             }
 
             return It;
         }
 
-        constexpr void UpdateToPacked(const std::size_t Index, const std::size_t LeftIndex, const std::size_t RightIndex) override
+        template <typename EntityIteratorType, typename SentinelType, typename CallableType>
+        void InsertTrivial(const EntityIteratorType First, const SentinelType Last, CallableType Fill)
+        {
+            constexpr std::size_t PageSize { PageSizeTraits<ElementType>::value };
+
+            const std::size_t From { BaseType::GetSize() };
+            const std::size_t To { From + static_cast<std::size_t>(std::ranges::distance(First, Last)) };
+
+            for (std::size_t Position = From; Position < To; Position = (Position / PageSize + 1u) * PageSize)
+            {
+                static_cast<void>(Payload.Assure(Position));
+            }
+
+            try
+            {
+                Changes.Stamp(From, To);
+                BaseType::Append(First, Last);
+            }
+            catch (...)
+            {
+                BaseType::Truncate(From);
+                Changes.Shrink(From);
+                throw;
+            }
+
+            try
+            {
+                for (std::size_t Position = From; Position < To;)
+                {
+                    const std::size_t Count { std::min(To - Position, PageSize - Position % PageSize) };
+                    std::invoke(Fill, std::span<ElementType> { std::addressof(Payload.GetReference(Position)), Count });
+                    Position += Count;
+                }
+            }
+            catch (...)
+            {
+                BaseType::Truncate(From);
+                Changes.Shrink(From);
+                throw;
+            }
+        }
+
+        constexpr void MoveElementAt(const std::size_t From, const std::size_t To) override
         {
-            BaseType::UpdateToPacked(Index, LeftIndex, RightIndex);
-            SwapPayloadAt(LeftIndex, RightIndex);
+            AllocatorType Allocator { GetElementAllocator() };
+            auto& Source { Payload.GetReference(From) };
+
+            BaseType::MoveElementAt(From, To);
+            ContainerAllocatorTraits::construct(Allocator, std::addressof(Payload.GetReference(To)), std::move(Source));
+            ContainerAllocatorTraits::destroy(Allocator, std::addressof(Source));
+            Changes.Move(From, To);
+        }
+
+        constexpr void ApplyPermutation(const std::size_t Count, const Jobs::ExecutorReference Executor) override
+        {
+            static_assert(std::move_constructible<Type> && std::is_move_assignable_v<Type>, "Non-movable type");
+
+            const auto IndexOf { [this](const std::size_t Position) { return BaseType::GetIndex(BaseType::operator[](Position)); } };
+
+            if constexpr (std::is_nothrow_move_constructible_v<Type> && std::is_nothrow_move_assignable_v<Type>)
+            {
+                const std::size_t Grain { Jobs::GetChunkSize(Count, Executor.GetConcurrency(), Memory::CacheLineAlignedCount<Type>) };
+                AllocatorType Allocator { GetElementAllocator() };
+                Type* const Sorted { ContainerAllocatorTraits::allocate(Allocator, Count) };
+
+                try
+                {
+                    Changes.Permute(Count, IndexOf, Executor);
+                }
+                catch (...)
+                {
+                    ContainerAllocatorTraits::deallocate(Allocator, Sorted, Count);
+                    throw;
+                }
+
+                Executor.ParallelFor(Count, Grain, [this, Sorted, &Allocator, &IndexOf](const std::size_t First, const std::size_t Last)
+                {
+                    AllocatorType ChunkAllocator { Allocator };
+
+                    for (std::size_t Position = First; Position < Last; ++Position)
+                    {
+                        ContainerAllocatorTraits::construct(ChunkAllocator, Sorted + Position, std::move(Payload.GetReference(IndexOf(Position))));
+                    }
+                });
+
+                BaseType::ApplyPermutation(Count, Executor);
+
+                Executor.ParallelFor(Count, Grain, [this, Sorted, &Allocator](const std::size_t First, const std::size_t Last)
+                {
+                    AllocatorType ChunkAllocator { Allocator };
+
+                    for (std::size_t Position = First; Position < Last; ++Position)
+                    {
+                        Payload.GetReference(Position) = std::move(Sorted[Position]);
+                        ContainerAllocatorTraits::destroy(ChunkAllocator, Sorted + Position);
+                    }
+                });
+
+                ContainerAllocatorTraits::deallocate(Allocator, Sorted, Count);
+            }
+            else
+            {
+                std::vector<Type, AllocatorParameter> Sorted { GetElementAllocator() };
+                Sorted.reserve(Count);
+
+                for (std::size_t Position = 0u; Position < Count; ++Position)
+                {
+                    Sorted.push_back(std::move(Payload.GetReference(IndexOf(Position))));
+                }
+
+                Changes.Permute(Count, IndexOf, Executor);
+                BaseType::ApplyPermutation(Count, Executor);
+
+                for (std::size_t Position = 0u; Position < Count; ++Position)
+                {
+                    Payload.GetReference(Position) = std::move(Sorted[Position]);
+                }
+            }
         }
 
         constexpr void SwapPayloadAt(const std::size_t Left, const std::size_t Right)
@@ -450,14 +760,41 @@ namespace egg::ECS::Containers
             static_assert(std::move_constructible<Type> && std::is_move_assignable_v<Type>, "Non-movable type");
             using std::swap;
             swap(Payload.GetReference(Left), Payload.GetReference(Right));
+            Changes.Swap(Left, Right);
         }
 
         constexpr void ShrinkToSize(const std::size_t Size)
         {
-            Payload.Shrink(Size, BaseType::GetSize());
+            std::size_t Available { BaseType::GetSize() };
+
+            if (BaseType::HasTombstones())
+            {
+                AllocatorType Allocator { GetElementAllocator() };
+
+                for (std::size_t Position = Size; Position < BaseType::GetSize(); ++Position)
+                {
+                    if (BaseType::IsTombstoneAt(Position)) continue;
+                    ContainerAllocatorTraits::destroy(Allocator, std::addressof(Payload.GetReference(Position)));
+                }
+
+                Available = Size;
+            }
+
+            if (const std::size_t Pages { (Size + PageSizeTraits<ElementType>::value - 1u) / PageSizeTraits<ElementType>::value };
+                Pages < Mapping.GetPagesCount())
+            {
+                Payload.Detach(Pages, Mapping.GetPagesCount());
+                Mapping.Shrink(Pages);
+                Available = Size;
+            }
+
+            Payload.Shrink(Size, Available);
+            Changes.Shrink(Size);
         }
 
         ContainerType Payload;
+        [[no_unique_address]] ChangeTicksType Changes;
+        [[no_unique_address]] PageMappingType Mapping;
     };
 
 
@@ -498,6 +835,11 @@ namespace egg::ECS::Containers
         Storage& operator=(const Storage&) = delete;
 
         constexpr Storage& operator=(Storage&& Other) noexcept(std::is_nothrow_move_assignable_v<BaseType>) = default;
+
+        [[nodiscard]] constexpr std::string_view GetElementName() const noexcept override
+        {
+            return Types::TypeInfo<Type>::GetName();
+        }
     };
 }
 
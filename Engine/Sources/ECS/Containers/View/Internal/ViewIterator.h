@@ -0,0 +1,110 @@
+#ifndef ENGINE_SOURCES_ECS_CONTAINERS_VIEW_INTERNAL_FILE_VIEW_ITERATOR_H
+#define ENGINE_SOURCES_ECS_CONTAINERS_VIEW_INTERNAL_FILE_VIEW_ITERATOR_H
+
+#include <Containers/PointerImitator.h>
+#include <ECS/Containers/SparseSet/SparseSet.h>
+#include <Types/Capabilities/Capabilities.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <span>
+
+namespace egg::ECS::Containers::Internal
+{
+    template <Types::InstanceOf<SparseSet> SparseSetParameter>
+    class ViewIterator final
+    {
+        using BaseIterator = typename SparseSetParameter::Iterator;
+        using PoolsType = std::span<const SparseSetParameter* const>;
+
+    public:
+        using value_type = typename SparseSetParameter::EntityType;
+        using pointer = egg::Containers::PointerImitator<value_type>;
+        using reference = value_type;
+        using difference_type = std::ptrdiff_t;
+        using iterator_category = std::input_iterator_tag;
+        using iterator_concept = std::forward_iterator_tag;
+
+
+        constexpr ViewIterator() noexcept : Iterator {}, Last {}, Gets {}, Excludes {}
+        {
+        }
+
+        constexpr ViewIterator(const BaseIterator From, const BaseIterator To, const PoolsType Gets, const PoolsType Excludes) noexcept
+            : Iterator { From },
+              Last { To },
+              Gets { Gets },
+              Excludes { Excludes }
+        {
+            SkipRejected();
+        }
+
+        constexpr ViewIterator& operator++() noexcept
+        {
+            ++Iterator;
+            SkipRejected();
+            return *this;
+        }
+
+        constexpr ViewIterator operator++(int) noexcept
+        {
+            ViewIterator Original { *this };
+            ++*this;
+            return Original;
+        }
+
+        [[nodiscard]] constexpr reference operator*() const noexcept
+        {
+            return *Iterator;
+        }
+
+        [[nodiscard]] constexpr pointer operator->() const noexcept
+        {
+            return pointer { operator*() };
+        }
+
+        [[nodiscard]] constexpr BaseIterator Base() const noexcept
+        {
+            return Iterator;
+        }
+
+        [[nodiscard]] constexpr bool operator==(const ViewIterator& Other) const noexcept
+        {
+            return Iterator == Other.Iterator;
+        }
+
+        [[nodiscard]] constexpr bool operator!=(const ViewIterator& Other) const noexcept
+        {
+            return !(*this == Other);
+        }
+
+        [[nodiscard]] static constexpr bool Accepts(const value_type Entity, const PoolsType Gets, const PoolsType Excludes) noexcept
+        {
+            return std::ranges::all_of(Gets, [Entity](const SparseSetParameter* Pool) constexpr
+                {
+                    return Pool->Contains(Entity);
+                }) &&
+                std::ranges::none_of(Excludes, [Entity](const SparseSetParameter* Pool) constexpr
+                {
+                    return Pool->Contains(Entity);
+                });
+        }
+
+    private:
+        constexpr void SkipRejected() noexcept
+        {
+            while (Iterator != Last && !Accepts(*Iterator, Gets, Excludes))
+            {
+                ++Iterator;
+            }
+        }
+
+        BaseIterator Iterator;
+        BaseIterator Last;
+        PoolsType Gets;
+        PoolsType Excludes;
+    };
+}
+
+#endif // ENGINE_SOURCES_ECS_CONTAINERS_VIEW_INTERNAL_FILE_VIEW_ITERATOR_H
@@ -0,0 +1,111 @@
+#ifndef ENGINE_SOURCES_ECS_CONTAINERS_VIEW_FILE_RUNTIME_VIEW_H
+#define ENGINE_SOURCES_ECS_CONTAINERS_VIEW_FILE_RUNTIME_VIEW_H
+
+#include "./Internal/ViewIterator.h"
+
+#include <ECS/Containers/SparseSet/SparseSet.h>
+#include <Types/Capabilities/Capabilities.h>
+
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <vector>
+
+namespace egg::ECS::Containers
+{
+    template <Types::InstanceOf<SparseSet> SparseSetParameter>
+    class RuntimeView final
+    {
+        using ViewAllocatorTraits = std::allocator_traits<typename SparseSetParameter::AllocatorType>;
+
+        using PoolsType = std::vector<
+            const SparseSetParameter*,
+            typename ViewAllocatorTraits::template rebind_alloc<const SparseSetParameter*>
+        >;
+
+    public:
+        using AllocatorType = typename SparseSetParameter::AllocatorType;
+        using EntityType = typename SparseSetParameter::EntityType;
+
+        using Iterator = Internal::ViewIterator<SparseSetParameter>;
+
+
+        constexpr explicit RuntimeView(const AllocatorType& Allocator = {})
+            : Gets { Allocator },
+              Excludes { Allocator }
+        {
+        }
+
+        constexpr RuntimeView& Iterate(const SparseSetParameter& Pool)
+        {
+            Gets.push_back(&Pool);
+            return *this;
+        }
+
+        constexpr RuntimeView& Exclude(const SparseSetParameter& Pool)
+        {
+            Excludes.push_back(&Pool);
+            return *this;
+        }
+
+        [[nodiscard]] constexpr Iterator Begin() const noexcept
+        {
+            if (Gets.empty())
+            {
+                return Iterator {};
+            }
+
+            const SparseSetParameter& Leading { GetLeading() };
+            return Iterator { Leading.Begin(), Leading.End(), Gets, Excludes };
+        }
+
+        [[nodiscard]] constexpr Iterator End() const noexcept
+        {
+            if (Gets.empty())
+            {
+                return Iterator {};
+            }
+
+            const SparseSetParameter& Leading { GetLeading() };
+            return Iterator { Leading.End(), Leading.End(), Gets, Excludes };
+        }
+
+        template <std::invocable<EntityType> CallableType>
+        constexpr void Each(CallableType Callable) const
+        {
+            for (const EntityType Entity : *this)
+            {
+                std::invoke(Callable, Entity);
+            }
+        }
+
+        [[nodiscard]] constexpr bool Contains(const EntityType Entity) const noexcept
+        {
+            return !Gets.empty() && Iterator::Accepts(Entity, Gets, Excludes);
+        }
+
+        [[nodiscard]] constexpr std::size_t GetSizeHint() const noexcept
+        {
+            return Gets.empty() ? 0u : GetLeading().GetSize();
+        }
+
+        constexpr void Clear() noexcept
+        {
+            Gets.clear();
+            Excludes.clear();
+        }
+
+    private:
+        [[nodiscard]] constexpr const SparseSetParameter& GetLeading() const noexcept
+        {
+            return **std::ranges::min_element(Gets, {}, &SparseSetParameter::GetSize);
+        }
+
+        PoolsType Gets;
+        PoolsType Excludes;
+    };
+}
+
+#endif // ENGINE_SOURCES_ECS_CONTAINERS_VIEW_FILE_RUNTIME_VIEW_H
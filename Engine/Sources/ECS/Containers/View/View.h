@@ -0,0 +1,253 @@
+#ifndef ENGINE_SOURCES_ECS_CONTAINERS_VIEW_FILE_VIEW_H
+#define ENGINE_SOURCES_ECS_CONTAINERS_VIEW_FILE_VIEW_H
+
+#include "./Internal/ViewIterator.h"
+
+#include <ECS/Entity.h>
+#include <ECS/Ownership.h>
+#include <ECS/Containers/Lifecycle/Lifecycle.h>
+#include <ECS/Containers/Traits/PoolTraits.h>
+#include <ECS/Traits/ChangeTrackingTraits.h>
+#include <Types/Capabilities/Capabilities.h>
+#include <Types/Constness.h>
+#include <Types/Deduction/Deduction.h>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace egg::ECS::Containers
+{
+    template <
+        Types::InstanceOf<ViewType>, Types::InstanceOf<ExcludeType>,
+        ValidEntity EntityParameter, Types::ValidAllocator<EntityParameter> = std::allocator<EntityParameter>>
+    class View;
+
+
+    template <typename... GetParameters, typename... ExcludeParameters,
+              ValidEntity EntityParameter, Types::ValidAllocator<EntityParameter> AllocatorParameter> requires
+        Types::AllTupleUnique<Types::InstantiateTuple<
+            std::remove_const_t,
+            std::tuple<GetParameters..., ExcludeParameters...>
+        >> && (sizeof...(GetParameters) != 0u)
+    class View<ViewType<GetParameters...>, ExcludeType<ExcludeParameters...>, EntityParameter, AllocatorParameter>
+    {
+        using TraitsType = PoolTraits<EntityParameter, AllocatorParameter>;
+
+        using SparseSetType = typename TraitsType::SparseSetType;
+
+        template <typename ElementType>
+        using PoolFor = Types::ConstnessAs<ElementType, typename TraitsType::template LifecycleStorageFor<ElementType>>;
+
+        using ArgumentsType = typename TraitsType::template StorableTuple<GetParameters...>;
+
+    public:
+        using AllocatorType = AllocatorParameter;
+        using EntityType = EntityParameter;
+
+        using Iterator = Internal::ViewIterator<SparseSetType>;
+
+
+        constexpr explicit View(PoolFor<GetParameters>&... GetPools, const PoolFor<ExcludeParameters>&... ExcludePools) noexcept
+            : Pools { &GetPools... },
+              Gets { &GetPools... },
+              Excludes { &ExcludePools... }
+        {
+        }
+
+        [[nodiscard]] constexpr Iterator Begin() const noexcept
+        {
+            const SparseSetType& Leading { GetLeading() };
+            return Iterator { Leading.Begin(), Leading.End(), Gets, Excludes };
+        }
+
+        [[nodiscard]] constexpr Iterator End() const noexcept
+        {
+            const SparseSetType& Leading { GetLeading() };
+            return Iterator { Leading.End(), Leading.End(), Gets, Excludes };
+        }
+
+        template <typename CallableType> requires
+            Types::Applicable<CallableType&, ArgumentsType> ||
+            Types::Applicable<CallableType&, Types::RemoveTupleType<EntityType, ArgumentsType>>
+        constexpr void Each(CallableType Callable) const
+        {
+            [this, &Callable]<std::size_t... Indices>(std::index_sequence<Indices...>) constexpr
+            {
+                const std::size_t Leading { GetLeadingIndex() };
+                ((Indices == Leading ? EachFrom<Indices>(Callable) : void()), ...);
+            }(std::index_sequence_for<GetParameters...> {});
+        }
+
+        template <typename ElementType, typename CallableType> requires
+            Types::ContainedIn<ElementType, GetParameters...> &&
+            PoolFor<ElementType>::TracksChanges && (
+                Types::Applicable<CallableType&, ArgumentsType> ||
+                Types::Applicable<CallableType&, Types::RemoveTupleType<EntityType, ArgumentsType>>)
+        constexpr void Each(ChangedType<ElementType>, const ChangeTick Since, CallableType Callable) const
+        {
+            constexpr std::size_t Leading { Types::TypeIndexIn<ElementType, GetParameters...> };
+
+            std::get<Leading>(Pools)->EachChanged(Since, [this, &Callable](const EntityType Entity, ElementType& Element)
+            {
+                if (AcceptsFrom<Leading>(Entity))
+                {
+                    InvokeFrom<Leading>(Callable, Entity, std::addressof(Element));
+                }
+            });
+        }
+
+        template <typename... ElementTypes> requires
+            (Types::ContainedIn<ElementTypes, GetParameters...> && ...) &&
+            (!OptimizableElement<ElementTypes, EntityType> && ...) &&
+            (sizeof...(ElementTypes) != 0u)
+        [[nodiscard]] constexpr decltype(auto) Get(const EntityType Entity) const
+        {
+            if constexpr (sizeof...(ElementTypes) == 1u)
+            {
+                return (GetPool<ElementTypes>().Get(Entity), ...);
+            }
+            else
+            {
+                return std::forward_as_tuple(GetPool<ElementTypes>().Get(Entity)...);
+            }
+        }
+
+        [[nodiscard]] constexpr bool Contains(const EntityType Entity) const noexcept
+        {
+            return Iterator::Accepts(Entity, Gets, Excludes);
+        }
+
+        [[nodiscard]] constexpr std::size_t GetSizeHint() const noexcept
+        {
+            return GetLeading().GetSize();
+        }
+
+    private:
+        template <typename ElementType>
+        [[nodiscard]] constexpr PoolFor<ElementType>& GetPool() const noexcept
+        {
+            return *std::get<Types::TypeIndexIn<ElementType, GetParameters...>>(Pools);
+        }
+
+        [[nodiscard]] constexpr std::size_t GetLeadingIndex() const noexcept
+        {
+            std::size_t Leading {};
+
+            for (std::size_t Index = 1u; Index < Gets.size(); ++Index)
+            {
+                if (Gets[Index]->GetSize() < Gets[Leading]->GetSize())
+                {
+                    Leading = Index;
+                }
+            }
+
+            return Leading;
+        }
+
+        [[nodiscard]] constexpr const SparseSetType& GetLeading() const noexcept
+        {
+            return *Gets[GetLeadingIndex()];
+        }
+
+        template <std::size_t Leading>
+        [[nodiscard]] constexpr bool AcceptsFrom(const EntityType Entity) const noexcept
+        {
+            return [this, Entity]<std::size_t... Indices>(std::index_sequence<Indices...>) constexpr
+            {
+                return ((Indices == Leading || Gets[Indices]->Contains(Entity)) && ...);
+            }(std::index_sequence_for<GetParameters...> {}) &&
+                std::ranges::none_of(Excludes, [Entity](const SparseSetType* Pool) constexpr
+                {
+                    return Pool->Contains(Entity);
+                });
+        }
+
+        template <std::size_t Leading, std::size_t Index, typename LeadingElementType>
+        [[nodiscard]] constexpr auto GetElementAsTuple(const EntityType Entity, LeadingElementType* LeadingElement) const
+        {
+            using ElementType = std::tuple_element_t<Index, std::tuple<GetParameters...>>;
+
+            if constexpr (OptimizableElement<ElementType, EntityType>)
+            {
+                return std::tuple {};
+            }
+            else if constexpr (Index == Leading)
+            {
+                return std::forward_as_tuple(*LeadingElement);
+            }
+            else
+            {
+                return std::forward_as_tuple(std::get<Index>(Pools)->Get(Entity));
+            }
+        }
+
+        template <std::size_t Leading, typename CallableType, typename LeadingElementType>
+        constexpr void InvokeFrom(CallableType& Callable, const EntityType Entity, LeadingElementType* LeadingElement) const
+        {
+            [&]<std::size_t... Indices>(std::index_sequence<Indices...>) constexpr
+            {
+                Invoke(Callable, std::tuple_cat(
+                    std::make_tuple(Entity),
+                    GetElementAsTuple<Leading, Indices>(Entity, LeadingElement)...
+                ));
+            }(std::index_sequence_for<GetParameters...> {});
+        }
+
+        template <std::size_t Leading, typename CallableType>
+        constexpr void EachFrom(CallableType& Callable) const
+        {
+            using LeadingType = std::tuple_element_t<Leading, std::tuple<GetParameters...>>;
+
+            const auto& Pool { *std::get<Leading>(Pools) };
+
+            if constexpr (OptimizableElement<LeadingType, EntityType>)
+            {
+                for (const EntityType Entity : static_cast<const SparseSetType&>(Pool))
+                {
+                    if (AcceptsFrom<Leading>(Entity))
+                    {
+                        InvokeFrom<Leading>(Callable, Entity, static_cast<LeadingType*>(nullptr));
+                    }
+                }
+            }
+            else
+            {
+                for (auto&& [Entity, Element] : std::get<Leading>(Pools)->Each())
+                {
+                    if (AcceptsFrom<Leading>(Entity))
+                    {
+                        InvokeFrom<Leading>(Callable, Entity, std::addressof(Element));
+                    }
+                }
+            }
+        }
+
+        template <typename CallableType, typename ArgumentsParameter>
+        static constexpr void Invoke(CallableType& Callable, ArgumentsParameter&& Arguments)
+        {
+            if constexpr (Types::Applicable<CallableType&, ArgumentsParameter>)
+            {
+                std::apply(Callable, std::forward<ArgumentsParameter>(Arguments));
+            }
+            else
+            {
+                std::apply([&Callable]<typename... ElementTypes>(EntityType, ElementTypes&&... Elements) constexpr
+                {
+                    std::invoke(Callable, std::forward<ElementTypes>(Elements)...);
+                }, std::forward<ArgumentsParameter>(Arguments));
+            }
+        }
+
+        std::tuple<PoolFor<GetParameters>*...> Pools;
+        std::array<const SparseSetType*, sizeof...(GetParameters)> Gets;
+        std::array<const SparseSetType*, sizeof...(ExcludeParameters)> Excludes;
+    };
+}
+
+#endif // ENGINE_SOURCES_ECS_CONTAINERS_VIEW_FILE_VIEW_H
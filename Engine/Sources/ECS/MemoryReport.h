@@ -0,0 +1,22 @@
+#ifndef ENGINE_SOURCES_ECS_FILE_MEMORY_REPORT_H
+#define ENGINE_SOURCES_ECS_FILE_MEMORY_REPORT_H
+
+#include <Types/Types.h>
+
+#include <cstddef>
+#include <string_view>
+
+namespace egg::ECS
+{
+    struct PoolMemoryReport
+    {
+        Types::IDType ID;
+        std::string_view Name;
+        std::size_t Size;
+        std::size_t Capacity;
+        std::size_t SparsePages;
+        std::size_t Bytes;
+    };
+}
+
+#endif // ENGINE_SOURCES_ECS_FILE_MEMORY_REPORT_H
@@ -21,6 +21,12 @@ namespace egg::ECS
     };
 
 
+    template <typename>
+    struct ChangedType final
+    {
+    };
+
+
     template <typename... Type>
     inline constexpr OwnType<Type...> Own {};
 
@@ -29,6 +35,9 @@ namespace egg::ECS
 
     template <typename... Type>
     inline constexpr ExcludeType<Type...> Exclude {};
+
+    template <typename Type>
+    inline constexpr ChangedType<Type> Changed {};
 }
 
 #endif // ENGINE_SOURCES_ECS_FILE_OWNERSHIP_H
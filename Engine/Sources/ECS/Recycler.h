@@ -5,6 +5,8 @@
 #include <ECS/Containers/SparseSet/SparseSet.h>
 #include <Types/Capabilities/Capabilities.h>
 
+#include <algorithm>
+#include <iterator>
 #include <memory>
 
 namespace egg::ECS
@@ -63,6 +65,26 @@ namespace egg::ECS
             return Created;
         }
 
+        template <std::forward_iterator IteratorType, std::sentinel_for<IteratorType> SentinelType>
+            requires std::output_iterator<IteratorType, EntityType>
+        constexpr void Create(IteratorType First, const SentinelType Last)
+        {
+            const std::size_t Count { static_cast<std::size_t>(std::ranges::distance(First, Last)) };
+            const std::size_t RecycledCount { std::min(Count, Entities.GetSize() - ValidCount) };
+
+            for (const std::size_t RecycledEnd { ValidCount + RecycledCount }; ValidCount != RecycledEnd; ++First)
+            {
+                *First = Entities[ValidCount++];
+            }
+
+            Entities.Reserve(Entities.GetSize() + Count - RecycledCount);
+
+            for (; First != Last; ++First, ++ValidCount)
+            {
+                *First = CreateNew();
+            }
+        }
+
         [[nodiscard]] constexpr bool Valid(const EntityType Entity) const noexcept
         {
             return Entities.Contains(Entity) && Entities.GetIndex(Entity) < ValidCount;
@@ -81,6 +103,15 @@ namespace egg::ECS
             return SetNextVersion(Entity);
         }
 
+        template <std::input_iterator IteratorType, std::sentinel_for<IteratorType> SentinelType>
+        constexpr void Recycle(IteratorType First, const SentinelType Last)
+        {
+            for (; First != Last; ++First)
+            {
+                Recycle(*First);
+            }
+        }
+
         constexpr void Recycle()
         {
             for (std::size_t Position = ValidCount; Position--;)
@@ -91,6 +122,41 @@ namespace egg::ECS
             ValidCount = 0u;
         }
 
+        template <std::input_iterator IteratorType, std::sentinel_for<IteratorType> SentinelType>
+        constexpr void Restore(IteratorType First, const SentinelType Last, const std::size_t Valid)
+        {
+            Entities.Clear();
+            ValidCount = 0u;
+
+            if constexpr (std::sized_sentinel_for<SentinelType, IteratorType>)
+            {
+                Entities.Reserve(static_cast<std::size_t>(std::ranges::distance(First, Last)));
+            }
+
+            for (; First != Last; ++First)
+            {
+                Entities.Push(*First);
+            }
+
+            EGG_ASSERT(Valid <= Entities.GetSize(), "Valid count exceeds the number of entities");
+            ValidCount = Valid;
+        }
+
+        [[nodiscard]] constexpr const EntityType* GetData() const noexcept
+        {
+            return Entities.GetEntityData();
+        }
+
+        [[nodiscard]] constexpr std::size_t GetSize() const noexcept
+        {
+            return Entities.GetSize();
+        }
+
+        [[nodiscard]] constexpr std::size_t GetValidCount() const noexcept
+        {
+            return ValidCount;
+        }
+
         [[nodiscard]] constexpr AllocatorType GetAllocator() const noexcept
         {
             return Entities.GetAllocator();
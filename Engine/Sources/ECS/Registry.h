@@ -1,20 +1,29 @@
 #ifndef ENGINE_SOURCES_ECS_FILE_REGISTRY_H
 #define ENGINE_SOURCES_ECS_FILE_REGISTRY_H
 
-#include <Containers/DenseMap/DenseMap.h>
+#include <Config/Config.h>
+#include <Containers/DenseMap/LookupMap.h>
 #include <ECS/Entity.h>
+#include <ECS/MemoryReport.h>
 #include <ECS/Recycler.h>
+#include <ECS/Containers/Group/Group.h>
 #include <ECS/Containers/PoolGroup/PoolGroup.h>
 #include <ECS/Containers/PoolGroup/PoolGroupInterface.h>
 #include <ECS/Containers/SparseSet/SparseSet.h>
+#include <ECS/Containers/View/RuntimeView.h>
+#include <ECS/Containers/View/View.h>
 #include <ECS/Containers/Traits/PoolTraits.h>
+#include <ECS/Traits/ChangeTrackingTraits.h>
 #include <Types/Types.h>
 #include <Types/Capabilities/Capabilities.h>
 #include <Types/TypeInfo/TypeInfo.h>
 
 #include <algorithm>
+#include <iterator>
 #include <memory>
+#include <span>
 #include <utility>
+#include <vector>
 
 namespace egg::ECS
 {
@@ -24,7 +33,7 @@ namespace egg::ECS
         using RegistryAllocatorTraits = std::allocator_traits<AllocatorParameter>;
 
         template <typename KeyType, typename MappedType>
-        using DenseMapFor = egg::Containers::DenseMap<
+        using LookupMapFor = egg::Containers::LookupMap<
             KeyType, MappedType, std::identity, std::equal_to<>,
             typename RegistryAllocatorTraits::template rebind_alloc<std::pair<const KeyType, MappedType>>
         >;
@@ -35,8 +44,8 @@ namespace egg::ECS
 
         using RecyclerType = Recycler<EntityParameter, AllocatorParameter>;
 
-        using PoolContainerType = DenseMapFor<Types::IDType, std::shared_ptr<PoolBaseType>>;
-        using GroupContainerType = DenseMapFor<Types::IDType, std::shared_ptr<Containers::PoolGroupInterface>>;
+        using PoolContainerType = LookupMapFor<Types::IDType, std::shared_ptr<PoolBaseType>>;
+        using GroupContainerType = LookupMapFor<Types::IDType, std::shared_ptr<Containers::PoolGroupInterface>>;
 
         using EntityTraitsType = EntityTraits<EntityParameter>;
 
@@ -49,6 +58,8 @@ namespace egg::ECS
         template <typename ElementType>
         using PoolFor = typename PoolTraitsType::template LifecycleStorageFor<ElementType>;
 
+        using RuntimeViewType = Containers::RuntimeView<PoolBaseType>;
+
 
         constexpr Registry() : Registry { AllocatorType {} }
         {
@@ -57,7 +68,8 @@ namespace egg::ECS
         constexpr explicit Registry(const AllocatorType& Allocator)
             : Entities { Allocator },
               Pools { Allocator },
-              Groups { Allocator }
+              Groups { Allocator },
+              Tick { 1u }
         {
         }
 
@@ -85,6 +97,7 @@ namespace egg::ECS
             swap(Left.Entities, Right.Entities);
             swap(Left.Pools, Right.Pools);
             swap(Left.Groups, Right.Groups);
+            swap(Left.Tick, Right.Tick);
         }
 
         template <Types::Decayed ElementType>
@@ -113,6 +126,24 @@ namespace egg::ECS
             return nullptr;
         }
 
+        [[nodiscard]] constexpr PoolBaseType* GetPool(const Types::IDType ID) noexcept
+        {
+            const auto It { Pools.Find(ID) };
+            return It != Pools.End() ? It->second.get() : nullptr;
+        }
+
+        [[nodiscard]] constexpr const PoolBaseType* GetPool(const Types::IDType ID) const noexcept
+        {
+            const auto It { Pools.Find(ID) };
+            return It != Pools.End() ? It->second.get() : nullptr;
+        }
+
+        template <Types::Decayed ElementType>
+        [[nodiscard]] static constexpr Types::IDType GetPoolID()
+        {
+            return GetHashFor<ElementType>();
+        }
+
         template <Types::Decayed ElementType>
         constexpr bool ResetPoolFor()
         {
@@ -134,6 +165,13 @@ namespace egg::ECS
             return Entities.Create();
         }
 
+        template <std::forward_iterator IteratorType, std::sentinel_for<IteratorType> SentinelType>
+            requires std::output_iterator<IteratorType, EntityType>
+        constexpr void Create(IteratorType First, const SentinelType Last)
+        {
+            Entities.Create(std::move(First), Last);
+        }
+
         constexpr VersionType Destroy(const EntityType Entity)
         {
             for (auto&& PoolPointer : Pools | std::views::values)
@@ -144,6 +182,20 @@ namespace egg::ECS
             return Entities.Recycle(Entity);
         }
 
+        template <std::forward_iterator IteratorType, std::sentinel_for<IteratorType> SentinelType>
+        constexpr void Destroy(const IteratorType First, const SentinelType Last)
+        {
+            for (auto&& PoolPointer : Pools | std::views::values)
+            {
+                if (!PoolPointer->Empty())
+                {
+                    PoolPointer->Remove(First, Last);
+                }
+            }
+
+            Entities.Recycle(First, Last);
+        }
+
         constexpr void Clear()
         {
             for (auto&& PoolPointer : Pools | std::views::values)
@@ -154,6 +206,61 @@ namespace egg::ECS
             Entities.Recycle();
         }
 
+        template <Types::Decayed ElementType, typename... Args>
+        constexpr decltype(auto) Emplace(const EntityType Entity, Args&&... Arguments)
+        {
+            if constexpr (Containers::OptimizableElement<ElementType, EntityType>)
+            {
+                GetPoolFor<ElementType>().Push(Entity);
+            }
+            else
+            {
+                return GetPoolFor<ElementType>().Emplace(Entity, std::forward<Args>(Arguments)...);
+            }
+        }
+
+        template <Types::Decayed ElementType>
+        constexpr void Erase(const EntityType Entity)
+        {
+            GetPoolFor<ElementType>().Erase(Entity);
+        }
+
+        template <Types::Decayed ElementType, typename... CallableTypes>
+            requires (!Containers::OptimizableElement<ElementType, EntityParameter>)
+        constexpr ElementType& Patch(const EntityType Entity, CallableTypes&&... Callables)
+        {
+            return GetPoolFor<ElementType>().Patch(Entity, std::forward<CallableTypes>(Callables)...);
+        }
+
+        template <Types::Decayed ElementType> requires PoolFor<ElementType>::TracksChanges
+        constexpr void MarkChanged(const EntityType Entity)
+        {
+            GetPoolFor<ElementType>().MarkChanged(Entity);
+        }
+
+        template <Types::Decayed ElementType> requires (!Containers::OptimizableElement<ElementType, EntityParameter>)
+        [[nodiscard]] constexpr ElementType& Get(const EntityType Entity)
+        {
+            return GetPoolFor<ElementType>().Get(Entity);
+        }
+
+        template <Types::Decayed ElementType> requires (!Containers::OptimizableElement<ElementType, EntityParameter>)
+        [[nodiscard]] constexpr const ElementType& Get(const EntityType Entity) const
+        {
+            EGG_ASSERT(GetPoolFor<ElementType>(), "Entity does not have the element");
+            return GetPoolFor<ElementType>()->Get(Entity);
+        }
+
+        template <Types::Decayed... ElementTypes>
+        [[nodiscard]] constexpr bool Contains(const EntityType Entity) const
+        {
+            return ([this, Entity]
+            {
+                const PoolFor<ElementTypes>* Pool { GetPoolFor<ElementTypes>() };
+                return Pool && Pool->Contains(Entity);
+            }() && ...);
+        }
+
         template <typename... OwnTypes, typename... ViewTypes, typename... ExcludeTypes>
         [[nodiscard]] constexpr
         Containers::Group<OwnType<OwnTypes...>, ViewType<ViewTypes...>, ExcludeType<ExcludeTypes...>, EntityType, AllocatorType>
@@ -213,14 +320,97 @@ namespace egg::ECS
             }
         }
 
+        template <typename... ViewTypes, typename... ExcludeTypes> requires (sizeof...(ViewTypes) != 0u)
+        [[nodiscard]] constexpr
+        Containers::View<ViewType<ViewTypes...>, ExcludeType<ExcludeTypes...>, EntityType, AllocatorType>
+        View(ExcludeType<ExcludeTypes...> = ExcludeType {})
+        {
+            using ResultType = Containers::View<ViewType<ViewTypes...>, ExcludeType<ExcludeTypes...>, EntityType, AllocatorType>;
+
+            return ResultType {
+                GetPoolFor<std::remove_const_t<ViewTypes>>()...,
+                GetPoolFor<std::remove_const_t<ExcludeTypes>>()...
+            };
+        }
+
+        [[nodiscard]] constexpr RuntimeViewType RuntimeView(
+            const std::span<const Types::IDType> GetIDs,
+            const std::span<const Types::IDType> ExcludeIDs = {}) const
+        {
+            RuntimeViewType Result { GetAllocator() };
+
+            for (const Types::IDType ID : GetIDs)
+            {
+                const PoolBaseType* Pool { GetPool(ID) };
+
+                if (!Pool)
+                {
+                    Result.Clear();
+                    return Result;
+                }
+
+                Result.Iterate(*Pool);
+            }
+
+            for (const Types::IDType ID : ExcludeIDs)
+            {
+                if (const PoolBaseType* Pool { GetPool(ID) })
+                {
+                    Result.Exclude(*Pool);
+                }
+            }
+
+            return Result;
+        }
+
+        [[nodiscard]] std::vector<PoolMemoryReport> MemoryReport() const
+        {
+            std::vector<PoolMemoryReport> Result;
+            Result.reserve(Pools.GetSize());
+
+            for (auto&& [ID, PoolPointer] : Pools)
+            {
+                Result.push_back({
+                    ID,
+                    PoolPointer->GetElementName(),
+                    PoolPointer->GetSize(),
+                    PoolPointer->GetCapacity(),
+                    PoolPointer->GetSparsePagesCount(),
+                    PoolPointer->GetMemoryUsage()
+                });
+            }
+
+            return Result;
+        }
+
+        [[nodiscard]] constexpr RecyclerType& GetRecycler() noexcept
+        {
+            return Entities;
+        }
+
+        [[nodiscard]] constexpr const RecyclerType& GetRecycler() const noexcept
+        {
+            return Entities;
+        }
+
         [[nodiscard]] constexpr AllocatorType GetAllocator() const noexcept
         {
             return Entities.GetAllocator();
         }
 
+        [[nodiscard]] constexpr ChangeTick GetChangeTick() const noexcept
+        {
+            return Tick;
+        }
+
+        constexpr ChangeTick AdvanceChangeTick() noexcept
+        {
+            return ++Tick;
+        }
+
     private:
         template <typename Type>
-        [[nodiscard]] constexpr Types::IDType GetHashFor()
+        [[nodiscard]] static constexpr Types::IDType GetHashFor()
         {
             return Types::TypeInfo<Type>::template GetID<Registry>();
         }
@@ -228,6 +418,7 @@ namespace egg::ECS
         RecyclerType Entities;
         PoolContainerType Pools;
         GroupContainerType Groups;
+        ChangeTick Tick;
     };
 }
 
@@ -0,0 +1,161 @@
+#ifndef ENGINE_SOURCES_ECS_SNAPSHOT_FILE_ARCHIVE_H
+#define ENGINE_SOURCES_ECS_SNAPSHOT_FILE_ARCHIVE_H
+
+#include <Types/Capabilities/Capabilities.h>
+
+#include <cstddef>
+#include <cstring>
+#include <istream>
+#include <memory>
+#include <ostream>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+namespace egg::ECS
+{
+    template <typename Type>
+    concept OutputArchive = requires(Type& Archive, const std::span<const std::byte> Bytes)
+    {
+        Archive.Write(Bytes);
+    };
+
+    template <typename Type>
+    concept InputArchive = requires(Type& Archive, const std::span<std::byte> Bytes, const std::size_t Size)
+    {
+        Archive.Read(Bytes);
+        Archive.Skip(Size);
+    };
+
+
+    template <Types::ValidAllocator<std::byte> AllocatorParameter = std::allocator<std::byte>>
+    class MemoryOutputArchive final
+    {
+        using ContainerType = std::vector<std::byte, AllocatorParameter>;
+
+    public:
+        using AllocatorType = AllocatorParameter;
+
+
+        constexpr explicit MemoryOutputArchive(const AllocatorType& Allocator = {}) : Buffer { Allocator }
+        {
+        }
+
+        constexpr void Write(const std::span<const std::byte> Bytes)
+        {
+            Buffer.insert(Buffer.end(), Bytes.begin(), Bytes.end());
+        }
+
+        constexpr void Reserve(const std::size_t Capacity)
+        {
+            Buffer.reserve(Capacity);
+        }
+
+        constexpr void Clear() noexcept
+        {
+            Buffer.clear();
+        }
+
+        [[nodiscard]] constexpr std::span<const std::byte> GetData() const noexcept
+        {
+            return Buffer;
+        }
+
+    private:
+        ContainerType Buffer;
+    };
+
+
+    class MemoryInputArchive final
+    {
+    public:
+        constexpr explicit MemoryInputArchive(const std::span<const std::byte> Data) noexcept : Data { Data }, Offset {}
+        {
+        }
+
+        void Read(const std::span<std::byte> Bytes)
+        {
+            Assure(Bytes.size());
+            std::memcpy(Bytes.data(), Data.data() + Offset, Bytes.size());
+            Offset += Bytes.size();
+        }
+
+        void Skip(const std::size_t Size)
+        {
+            Assure(Size);
+            Offset += Size;
+        }
+
+        [[nodiscard]] constexpr std::size_t GetRemaining() const noexcept
+        {
+            return Data.size() - Offset;
+        }
+
+        [[nodiscard]] constexpr std::size_t GetOffset() const noexcept
+        {
+            return Offset;
+        }
+
+    private:
+        void Assure(const std::size_t Size) const
+        {
+            if (Size > GetRemaining())
+            {
+                throw std::out_of_range("Snapshot archive is truncated");
+            }
+        }
+
+        std::span<const std::byte> Data;
+        std::size_t Offset;
+    };
+
+
+    class StreamOutputArchive final
+    {
+    public:
+        explicit StreamOutputArchive(std::ostream& Stream) noexcept : Stream { Stream }
+        {
+        }
+
+        void Write(const std::span<const std::byte> Bytes)
+        {
+            if (!Stream.write(reinterpret_cast<const char*>(Bytes.data()), static_cast<std::streamsize>(Bytes.size())))
+            {
+                throw std::runtime_error("Failed to write snapshot archive");
+            }
+        }
+
+    private:
+        std::ostream& Stream;
+    };
+
+
+    class StreamInputArchive final
+    {
+    public:
+        explicit StreamInputArchive(std::istream& Stream) noexcept : Stream { Stream }
+        {
+        }
+
+        void Read(const std::span<std::byte> Bytes)
+        {
+            if (!Stream.read(reinterpret_cast<char*>(Bytes.data()), static_cast<std::streamsize>(Bytes.size())))
+            {
+                throw std::out_of_range("Snapshot archive is truncated");
+            }
+        }
+
+        void Skip(const std::size_t Size)
+        {
+            if (!Stream.ignore(static_cast<std::streamsize>(Size)) || Stream.gcount() != static_cast<std::streamsize>(Size))
+            {
+                throw std::out_of_range("Snapshot archive is truncated");
+            }
+        }
+
+    private:
+        std::istream& Stream;
+    };
+}
+
+#endif // ENGINE_SOURCES_ECS_SNAPSHOT_FILE_ARCHIVE_H
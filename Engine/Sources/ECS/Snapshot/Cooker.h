@@ -0,0 +1,129 @@
+#ifndef ENGINE_SOURCES_ECS_SNAPSHOT_FILE_COOKER_H
+#define ENGINE_SOURCES_ECS_SNAPSHOT_FILE_COOKER_H
+
+#include "./Internal/SnapshotBlock.h"
+
+#include <ECS/Registry.h>
+#include <ECS/Snapshot/Archive.h>
+#include <ECS/Snapshot/Snapshot.h>
+#include <ECS/Containers/Storage/Storage.h>
+#include <ECS/Traits/PageSizeTraits.h>
+#include <Memory/Constants.h>
+#include <Types/Capabilities/Capabilities.h>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+namespace egg::ECS
+{
+    template <Types::InstanceOf<Registry> RegistryParameter>
+    class Cooker final
+    {
+        template <typename ArchiveType>
+        class CountingArchive final
+        {
+        public:
+            CountingArchive(ArchiveType& Archive, const std::size_t BaseOffset) noexcept : Archive { Archive }, Offset { BaseOffset }
+            {
+            }
+
+            void Write(const std::span<const std::byte> Bytes)
+            {
+                Archive.Write(Bytes);
+                Offset += Bytes.size();
+            }
+
+            void Align(const std::size_t Alignment)
+            {
+                Pad((Alignment - Offset % Alignment) % Alignment);
+            }
+
+            void Pad(std::size_t Size)
+            {
+                static constexpr std::array<std::byte, 4096u> Zeros {};
+
+                while (Size)
+                {
+                    const std::size_t Count { std::min(Size, Zeros.size()) };
+                    Write(std::span { Zeros.data(), Count });
+                    Size -= Count;
+                }
+            }
+
+        private:
+            ArchiveType& Archive;
+            std::size_t Offset;
+        };
+
+    public:
+        using RegistryType = RegistryParameter;
+        using EntityType = typename RegistryType::EntityType;
+
+        static constexpr std::uint64_t Magic { 0x314B4F4F43474745u };
+
+        static constexpr std::size_t PageAlignment { Memory::PageSizeInBytes };
+
+
+        constexpr explicit Cooker(const RegistryType& Registry) noexcept : Source { &Registry }
+        {
+        }
+
+        //BaseOffset is the position of the archive's first byte in the final file, pages are aligned to the file and not to the archive
+        template <Types::Decayed... ElementTypes, OutputArchive ArchiveType> requires (Snapshotable<ElementTypes, EntityType> && ...)
+        void Cook(ArchiveType& Archive, const std::size_t BaseOffset = 0u) const
+        {
+            CountingArchive<ArchiveType> Counted { Archive, BaseOffset };
+
+            Internal::WriteValue(Counted, Magic);
+            Snapshot { *Source }.Entities(Counted);
+            Internal::WriteValue(Counted, static_cast<std::uint64_t>(sizeof...(ElementTypes)));
+            (CookPool<ElementTypes>(Counted), ...);
+        }
+
+    private:
+        template <typename ElementType, typename ArchiveType>
+        void CookPool(CountingArchive<ArchiveType>& Archive) const
+        {
+            constexpr bool Empty { Containers::OptimizableElement<ElementType, EntityType> };
+            constexpr std::size_t PageSize { Empty ? 0u : PageSizeTraits<ElementType>::value };
+
+            const auto* Pool { Source->template GetPoolFor<ElementType>() };
+            const std::size_t Count { Pool ? Internal::GetAliveCount(*Pool) : 0u };
+            const std::size_t PagesCount { PageSize ? (Count + PageSize - 1u) / PageSize : 0u };
+
+            Internal::WriteValue(Archive, Internal::SnapshotBlock {
+                RegistryType::template GetPoolID<ElementType>(),
+                Count,
+                Empty ? 0u : sizeof(ElementType)
+            });
+            Internal::WriteValue(Archive, static_cast<std::uint64_t>(PageSize));
+            Internal::WriteValue(Archive, static_cast<std::uint64_t>(PagesCount));
+
+            if (!Count)
+            {
+                return;
+            }
+
+            Internal::WriteAliveEntities(Archive, *Pool);
+
+            if constexpr (!Empty)
+            {
+                Archive.Align(PageAlignment);
+
+                Pool->EachPage([&Archive](const std::span<const ElementType> Page)
+                {
+                    Internal::WriteSpan(Archive, Page);
+                });
+
+                Archive.Pad((PagesCount * PageSize - Count) * sizeof(ElementType));
+            }
+        }
+
+        const RegistryType* Source;
+    };
+}
+
+#endif // ENGINE_SOURCES_ECS_SNAPSHOT_FILE_COOKER_H
@@ -0,0 +1,100 @@
+#ifndef ENGINE_SOURCES_ECS_SNAPSHOT_INTERNAL_FILE_SNAPSHOT_BLOCK_H
+#define ENGINE_SOURCES_ECS_SNAPSHOT_INTERNAL_FILE_SNAPSHOT_BLOCK_H
+
+#include <ECS/Snapshot/Archive.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <type_traits>
+
+namespace egg::ECS::Internal
+{
+    struct SnapshotBlock
+    {
+        std::uint64_t ID;
+        std::uint64_t Count;
+        std::uint64_t ElementSize;
+    };
+
+
+    template <OutputArchive ArchiveType, typename Type> requires std::is_trivially_copyable_v<Type>
+    void WriteSpan(ArchiveType& Archive, const std::span<const Type> Values)
+    {
+        Archive.Write(std::as_bytes(Values));
+    }
+
+    template <OutputArchive ArchiveType, typename Type> requires std::is_trivially_copyable_v<Type>
+    void WriteValue(ArchiveType& Archive, const Type& Value)
+    {
+        Archive.Write(std::as_bytes(std::span<const Type> { &Value, 1u }));
+    }
+
+    template <typename PoolType>
+    [[nodiscard]] std::size_t GetAliveCount(const PoolType& Pool) noexcept
+    {
+        if (!Pool.HasTombstones())
+        {
+            return Pool.GetSize();
+        }
+
+        std::size_t Count {};
+
+        for (std::size_t Position = 0u; Position < Pool.GetSize(); ++Position)
+        {
+            Count += !Pool.IsTombstoneAt(Position);
+        }
+
+        return Count;
+    }
+
+    template <OutputArchive ArchiveType, typename PoolType>
+    void WriteAliveEntities(ArchiveType& Archive, const PoolType& Pool)
+    {
+        using EntityType = typename PoolType::EntityType;
+
+        const EntityType* const Data { Pool.GetEntityData() };
+        const std::size_t Size { Pool.GetSize() };
+
+        if (!Pool.HasTombstones())
+        {
+            WriteSpan(Archive, std::span<const EntityType> { Data, Size });
+            return;
+        }
+
+        for (std::size_t First = 0u; First < Size;)
+        {
+            if (Pool.IsTombstoneAt(First))
+            {
+                ++First;
+                continue;
+            }
+
+            std::size_t Last { First + 1u };
+
+            while (Last < Size && !Pool.IsTombstoneAt(Last))
+            {
+                ++Last;
+            }
+
+            WriteSpan(Archive, std::span<const EntityType> { Data + First, Last - First });
+            First = Last;
+        }
+    }
+
+    template <InputArchive ArchiveType, typename Type> requires std::is_trivially_copyable_v<Type>
+    void ReadSpan(ArchiveType& Archive, const std::span<Type> Values)
+    {
+        Archive.Read(std::as_writable_bytes(Values));
+    }
+
+    template <typename Type, InputArchive ArchiveType> requires std::is_trivially_copyable_v<Type>
+    [[nodiscard]] Type ReadValue(ArchiveType& Archive)
+    {
+        Type Value;
+        Archive.Read(std::as_writable_bytes(std::span<Type> { &Value, 1u }));
+        return Value;
+    }
+}
+
+#endif // ENGINE_SOURCES_ECS_SNAPSHOT_INTERNAL_FILE_SNAPSHOT_BLOCK_H
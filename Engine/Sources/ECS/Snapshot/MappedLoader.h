@@ -0,0 +1,144 @@
+#ifndef ENGINE_SOURCES_ECS_SNAPSHOT_FILE_MAPPED_LOADER_H
+#define ENGINE_SOURCES_ECS_SNAPSHOT_FILE_MAPPED_LOADER_H
+
+#include "./Internal/SnapshotBlock.h"
+
+#include <Config/Config.h>
+#include <ECS/Registry.h>
+#include <ECS/Snapshot/Archive.h>
+#include <ECS/Snapshot/Cooker.h>
+#include <ECS/Snapshot/Snapshot.h>
+#include <ECS/Snapshot/SnapshotLoader.h>
+#include <ECS/Containers/Storage/Storage.h>
+#include <ECS/Traits/PageSizeTraits.h>
+#include <Memory/MappedFile/MappedFile.h>
+#include <Types/Capabilities/Capabilities.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+namespace egg::ECS
+{
+    template <Types::InstanceOf<Registry> RegistryParameter>
+    class MappedLoader final
+    {
+        using LoaderAllocatorTraits = std::allocator_traits<typename RegistryParameter::AllocatorType>;
+
+        template <typename Type>
+        using VectorFor = std::vector<Type, typename LoaderAllocatorTraits::template rebind_alloc<Type>>;
+
+        struct MappedBlock
+        {
+            Internal::SnapshotBlock Block;
+            std::uint64_t PageSize;
+            std::uint64_t PagesCount;
+        };
+
+    public:
+        using RegistryType = RegistryParameter;
+        using EntityType = typename RegistryType::EntityType;
+
+
+        constexpr explicit MappedLoader(RegistryType& Registry) noexcept : Target { &Registry }
+        {
+        }
+
+        //BaseOffset must match the one the snapshot was cooked with
+        template <Types::Decayed... ElementTypes> requires (Snapshotable<ElementTypes, EntityType> && ...)
+        void Load(const std::shared_ptr<Memory::MappedFile>& File, const std::size_t BaseOffset = 0u)
+        {
+            if (BaseOffset > File->GetData().size())
+            {
+                throw std::out_of_range("Cooked snapshot offset is past the end of the file");
+            }
+
+            MemoryInputArchive Archive { File->GetData().subspan(BaseOffset) };
+
+            if (Internal::ReadValue<std::uint64_t>(Archive) != Cooker<RegistryType>::Magic)
+            {
+                throw std::runtime_error("File is not a cooked snapshot");
+            }
+
+            SnapshotLoader { *Target }.Entities(Archive);
+
+            for (auto BlocksCount { Internal::ReadValue<std::uint64_t>(Archive) }; BlocksCount--;)
+            {
+                const auto Mapped { Internal::ReadValue<MappedBlock>(Archive) };
+
+                if (!(LoadPool<ElementTypes>(Archive, Mapped, File, BaseOffset) || ...))
+                {
+                    Archive.Skip(static_cast<std::size_t>(Mapped.Block.Count * sizeof(EntityType)));
+                    SkipPayload(Archive, Mapped, BaseOffset);
+                }
+            }
+        }
+
+    private:
+        template <typename ElementType>
+        bool LoadPool(MemoryInputArchive& Archive, const MappedBlock& Mapped, const std::shared_ptr<Memory::MappedFile>& File, const std::size_t BaseOffset)
+        {
+            constexpr bool Empty { Containers::OptimizableElement<ElementType, EntityType> };
+            constexpr std::size_t PageSize { Empty ? 0u : PageSizeTraits<ElementType>::value };
+
+            if (Mapped.Block.ID != RegistryType::template GetPoolID<ElementType>())
+            {
+                return false;
+            }
+
+            if (Mapped.Block.ElementSize != (Empty ? 0u : sizeof(ElementType)) || Mapped.PageSize != PageSize)
+            {
+                throw std::runtime_error("Cooked snapshot layout does not match the element type");
+            }
+
+            const std::size_t Count { static_cast<std::size_t>(Mapped.Block.Count) };
+
+            VectorFor<EntityType> Loaded(Count, Target->GetAllocator());
+            Internal::ReadSpan(Archive, std::span<EntityType> { Loaded });
+
+            auto& Pool { Target->template GetPoolFor<ElementType>() };
+
+            if constexpr (Empty)
+            {
+                for (const EntityType Entity : Loaded)
+                {
+                    Pool.Push(Entity);
+                }
+            }
+            else if (Count)
+            {
+                std::byte* Pages { File->GetData().data() + SkipPayload(Archive, Mapped, BaseOffset) };
+                EGG_ASSERT(reinterpret_cast<std::uintptr_t>(Pages) % alignof(ElementType) == 0u, "Cooked pages are misaligned");
+
+                Pool.Adopt(Loaded.begin(), Loaded.end(), std::span<ElementType> {
+                    reinterpret_cast<ElementType*>(Pages),
+                    static_cast<std::size_t>(Mapped.PagesCount) * PageSize
+                }, File);
+            }
+
+            return true;
+        }
+
+        static std::size_t SkipPayload(MemoryInputArchive& Archive, const MappedBlock& Mapped, const std::size_t BaseOffset)
+        {
+            if (!Mapped.PagesCount)
+            {
+                return BaseOffset + Archive.GetOffset();
+            }
+
+            constexpr std::size_t Alignment { Cooker<RegistryType>::PageAlignment };
+            Archive.Skip((Alignment - (BaseOffset + Archive.GetOffset()) % Alignment) % Alignment);
+
+            const std::size_t Offset { BaseOffset + Archive.GetOffset() };
+            Archive.Skip(static_cast<std::size_t>(Mapped.PagesCount * Mapped.PageSize * Mapped.Block.ElementSize));
+            return Offset;
+        }
+
+        RegistryType* Target;
+    };
+}
+
+#endif // ENGINE_SOURCES_ECS_SNAPSHOT_FILE_MAPPED_LOADER_H
@@ -0,0 +1,90 @@
+#ifndef ENGINE_SOURCES_ECS_SNAPSHOT_FILE_SNAPSHOT_H
+#define ENGINE_SOURCES_ECS_SNAPSHOT_FILE_SNAPSHOT_H
+
+#include "./Internal/SnapshotBlock.h"
+
+#include <ECS/Registry.h>
+#include <ECS/Snapshot/Archive.h>
+#include <ECS/Containers/Storage/Storage.h>
+#include <Types/Capabilities/Capabilities.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <type_traits>
+
+namespace egg::ECS
+{
+    template <typename ElementType, typename EntityType>
+    concept Snapshotable = Containers::OptimizableElement<ElementType, EntityType> || std::is_trivially_copyable_v<ElementType>;
+
+
+    template <Types::InstanceOf<Registry> RegistryParameter>
+    class Snapshot final
+    {
+    public:
+        using RegistryType = RegistryParameter;
+        using EntityType = typename RegistryType::EntityType;
+
+
+        constexpr explicit Snapshot(const RegistryType& Registry) noexcept : Source { &Registry }
+        {
+        }
+
+        template <OutputArchive ArchiveType>
+        const Snapshot& Entities(ArchiveType& Archive) const
+        {
+            const auto& Recycler { Source->GetRecycler() };
+
+            Internal::WriteValue(Archive, static_cast<std::uint64_t>(Recycler.GetSize()));
+            Internal::WriteValue(Archive, static_cast<std::uint64_t>(Recycler.GetValidCount()));
+            Internal::WriteSpan(Archive, std::span<const EntityType> { Recycler.GetData(), Recycler.GetSize() });
+
+            return *this;
+        }
+
+        template <Types::Decayed... ElementTypes, OutputArchive ArchiveType> requires (Snapshotable<ElementTypes, EntityType> && ...)
+        const Snapshot& Elements(ArchiveType& Archive) const
+        {
+            Internal::WriteValue(Archive, static_cast<std::uint64_t>(sizeof...(ElementTypes)));
+            (WritePool<ElementTypes>(Archive), ...);
+
+            return *this;
+        }
+
+    private:
+        template <typename ElementType, typename ArchiveType>
+        void WritePool(ArchiveType& Archive) const
+        {
+            constexpr bool Empty { Containers::OptimizableElement<ElementType, EntityType> };
+
+            const auto* Pool { Source->template GetPoolFor<ElementType>() };
+            const std::size_t Count { Pool ? Internal::GetAliveCount(*Pool) : 0u };
+
+            Internal::WriteValue(Archive, Internal::SnapshotBlock {
+                RegistryType::template GetPoolID<ElementType>(),
+                Count,
+                Empty ? 0u : sizeof(ElementType)
+            });
+
+            if (!Count)
+            {
+                return;
+            }
+
+            Internal::WriteAliveEntities(Archive, *Pool);
+
+            if constexpr (!Empty)
+            {
+                Pool->EachPage([&Archive](const std::span<const ElementType> Page)
+                {
+                    Internal::WriteSpan(Archive, Page);
+                });
+            }
+        }
+
+        const RegistryType* Source;
+    };
+}
+
+#endif // ENGINE_SOURCES_ECS_SNAPSHOT_FILE_SNAPSHOT_H
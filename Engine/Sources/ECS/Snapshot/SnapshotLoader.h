@@ -0,0 +1,130 @@
+#ifndef ENGINE_SOURCES_ECS_SNAPSHOT_FILE_SNAPSHOT_LOADER_H
+#define ENGINE_SOURCES_ECS_SNAPSHOT_FILE_SNAPSHOT_LOADER_H
+
+#include "./Internal/SnapshotBlock.h"
+
+#include <ECS/Registry.h>
+#include <ECS/Snapshot/Archive.h>
+#include <ECS/Snapshot/Snapshot.h>
+#include <ECS/Containers/Storage/Storage.h>
+#include <Types/Capabilities/Capabilities.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+namespace egg::ECS
+{
+    template <Types::InstanceOf<Registry> RegistryParameter>
+    class SnapshotLoader final
+    {
+        using LoaderAllocatorTraits = std::allocator_traits<typename RegistryParameter::AllocatorType>;
+
+        template <typename Type>
+        using VectorFor = std::vector<Type, typename LoaderAllocatorTraits::template rebind_alloc<Type>>;
+
+    public:
+        using RegistryType = RegistryParameter;
+        using EntityType = typename RegistryType::EntityType;
+
+
+        constexpr explicit SnapshotLoader(RegistryType& Registry) noexcept : Target { &Registry }
+        {
+        }
+
+        template <InputArchive ArchiveType>
+        SnapshotLoader& Entities(ArchiveType& Archive)
+        {
+            const auto Size { Internal::ReadValue<std::uint64_t>(Archive) };
+            const auto ValidCount { Internal::ReadValue<std::uint64_t>(Archive) };
+
+            VectorFor<EntityType> Loaded(static_cast<std::size_t>(Size), Target->GetAllocator());
+            Internal::ReadSpan(Archive, std::span<EntityType> { Loaded });
+
+            Target->Clear();
+            Target->GetRecycler().Restore(Loaded.begin(), Loaded.end(), static_cast<std::size_t>(ValidCount));
+
+            return *this;
+        }
+
+        template <Types::Decayed... ElementTypes, InputArchive ArchiveType> requires (Snapshotable<ElementTypes, EntityType> && ...)
+        SnapshotLoader& Elements(ArchiveType& Archive)
+        {
+            return Elements<ElementTypes...>(Archive, std::identity {});
+        }
+
+        template <Types::Decayed... ElementTypes, InputArchive ArchiveType, typename MapType> requires
+            (Snapshotable<ElementTypes, EntityType> && ...) &&
+            std::is_invocable_r_v<EntityType, MapType&, EntityType>
+        SnapshotLoader& Elements(ArchiveType& Archive, MapType Map)
+        {
+            for (auto BlocksCount { Internal::ReadValue<std::uint64_t>(Archive) }; BlocksCount--;)
+            {
+                const auto Block { Internal::ReadValue<Internal::SnapshotBlock>(Archive) };
+
+                if (!(ReadPool<ElementTypes>(Archive, Block, Map) || ...))
+                {
+                    Archive.Skip(static_cast<std::size_t>(Block.Count * (sizeof(EntityType) + Block.ElementSize)));
+                }
+            }
+
+            return *this;
+        }
+
+    private:
+        template <typename ElementType, typename ArchiveType, typename MapType>
+        bool ReadPool(ArchiveType& Archive, const Internal::SnapshotBlock& Block, MapType& Map)
+        {
+            constexpr bool Empty { Containers::OptimizableElement<ElementType, EntityType> };
+
+            if (Block.ID != RegistryType::template GetPoolID<ElementType>())
+            {
+                return false;
+            }
+
+            if (Block.ElementSize != (Empty ? 0u : sizeof(ElementType)))
+            {
+                throw std::runtime_error("Snapshot element size does not match the element type");
+            }
+
+            const std::size_t Count { static_cast<std::size_t>(Block.Count) };
+
+            VectorFor<EntityType> Loaded(Count, Target->GetAllocator());
+            Internal::ReadSpan(Archive, std::span<EntityType> { Loaded });
+
+            if constexpr (!std::same_as<MapType, std::identity>)
+            {
+                std::ranges::transform(Loaded, Loaded.begin(), std::ref(Map));
+            }
+
+            auto& Pool { Target->template GetPoolFor<ElementType>() };
+
+            if constexpr (Empty)
+            {
+                for (const EntityType Entity : Loaded)
+                {
+                    Pool.Push(Entity);
+                }
+            }
+            else
+            {
+                Pool.InsertForOverwrite(Loaded.begin(), Loaded.end(), [&Archive](const std::span<ElementType> Run)
+                {
+                    Internal::ReadSpan(Archive, Run);
+                });
+            }
+
+            return true;
+        }
+
+        RegistryType* Target;
+    };
+}
+
+#endif // ENGINE_SOURCES_ECS_SNAPSHOT_FILE_SNAPSHOT_LOADER_H
@@ -0,0 +1,257 @@
+#include "./Scheduler.h"
+
+#include <Config/Config.h>
+#include <Containers/DenseMap/DenseMap.h>
+#include <Events/ConnectionArgument.h>
+#include <Types/Types.h>
+
+#include <algorithm>
+#include <iterator>
+#include <limits>
+#include <thread>
+
+namespace egg::Systems
+{
+    namespace
+    {
+        constexpr std::size_t NoNode { std::numeric_limits<std::size_t>::max() };
+
+        struct ComponentState
+        {
+            std::size_t LastWriter { NoNode };
+            std::vector<std::size_t> Readers {};
+        };
+    }
+
+    Scheduler::Scheduler(Jobs::JobPool& Pool)
+        : Pool { Pool },
+          Job { Events::ConnectionArgument<&Scheduler::Run>, *this },
+          Submitted {},
+          Unfinished {},
+          FrameDeltaTime {},
+          Built { true }
+    {
+    }
+
+    Scheduler::~Scheduler()
+    {
+        Pool.Wait(Submitted);
+    }
+
+    void Scheduler::Add(System& Target)
+    {
+        Nodes.push_back(Node { &Target, {}, 0u, Target.GetAccess().MainThread || Target.GetAccess().Exclusive });
+        Built = false;
+    }
+
+    void Scheduler::Clear()
+    {
+        Nodes.clear();
+        Roots.clear();
+        Remaining.reset();
+        Built = true;
+    }
+
+    void Scheduler::Build()
+    {
+        Containers::DenseMap<Types::IDType, ComponentState> Components;
+        std::vector<std::size_t> Dependencies;
+        std::size_t LastExclusive { NoNode };
+
+        for (std::size_t Index = 0u; Index < Nodes.size(); ++Index)
+        {
+            Nodes[Index].Successors.clear();
+            Nodes[Index].PredecessorsCount = 0u;
+        }
+
+        for (std::size_t Index = 0u; Index < Nodes.size(); ++Index)
+        {
+            const SystemAccess& Access { Nodes[Index].Target->GetAccess() };
+            Dependencies.clear();
+
+            if (Access.Exclusive)
+            {
+                for (std::size_t Other = LastExclusive == NoNode ? 0u : LastExclusive; Other < Index; ++Other)
+                {
+                    Dependencies.push_back(Other);
+                }
+
+                LastExclusive = Index;
+                Components.Clear();
+            }
+            else
+            {
+                if (LastExclusive != NoNode)
+                {
+                    Dependencies.push_back(LastExclusive);
+                }
+
+                for (const Types::IDType Component : Access.Reads)
+                {
+                    ComponentState& State { Components.TryEmplace(Component).first->second };
+
+                    if (State.LastWriter != NoNode)
+                    {
+                        Dependencies.push_back(State.LastWriter);
+                    }
+
+                    State.Readers.push_back(Index);
+                }
+
+                for (const Types::IDType Component : Access.Writes)
+                {
+                    ComponentState& State { Components.TryEmplace(Component).first->second };
+                    const std::size_t Previous { Dependencies.size() };
+
+                    std::ranges::copy_if(State.Readers, std::back_inserter(Dependencies), [Index](const std::size_t Reader)
+                    {
+                        return Reader != Index;
+                    });
+
+                    if (Dependencies.size() == Previous && State.LastWriter != NoNode)
+                    {
+                        Dependencies.push_back(State.LastWriter);
+                    }
+
+                    State.Readers.clear();
+                    State.LastWriter = Index;
+                }
+            }
+
+            std::ranges::sort(Dependencies);
+            const auto [First, Last] { std::ranges::unique(Dependencies) };
+            Dependencies.erase(First, Last);
+
+            for (const std::size_t Dependency : Dependencies)
+            {
+                Nodes[Dependency].Successors.push_back(Index);
+            }
+
+            Nodes[Index].PredecessorsCount = Dependencies.size();
+        }
+
+        Roots.clear();
+
+        for (std::size_t Index = 0u; Index < Nodes.size(); ++Index)
+        {
+            if (!Nodes[Index].PredecessorsCount)
+            {
+                Roots.push_back(Index);
+            }
+        }
+
+        Remaining = std::make_unique<std::atomic<std::size_t>[]>(Nodes.size());
+        MainThreadReady.reserve(Nodes.size());
+        Built = true;
+    }
+
+    void Scheduler::Update(const float DeltaTime)
+    {
+        if (!Built)
+        {
+            Build();
+        }
+
+        if (Nodes.empty())
+        {
+            return;
+        }
+
+        for (std::size_t Index = 0u; Index < Nodes.size(); ++Index)
+        {
+            Remaining[Index].store(Nodes[Index].PredecessorsCount, std::memory_order_relaxed);
+        }
+
+        FrameDeltaTime = DeltaTime;
+        Unfinished.store(Nodes.size(), std::memory_order_release);
+
+        for (const std::size_t Root : Roots)
+        {
+            Dispatch(Root);
+        }
+
+        while (Unfinished.load(std::memory_order_acquire))
+        {
+            if (!TryRunOnMainThread() && !Pool.RunPendingJob())
+            {
+                std::this_thread::yield();
+            }
+        }
+
+        Pool.Wait(Submitted);
+    }
+
+    std::span<const std::size_t> Scheduler::GetSuccessors(const std::size_t Index) const noexcept
+    {
+        EGG_ASSERT(Index < Nodes.size(), "Index is out of range");
+        return Nodes[Index].Successors;
+    }
+
+    std::size_t Scheduler::GetSize() const noexcept
+    {
+        return Nodes.size();
+    }
+
+    void Scheduler::Dispatch(const std::size_t Index)
+    {
+        if (Nodes[Index].MainThread)
+        {
+            std::lock_guard Lock { MainThreadMutex };
+            MainThreadReady.push_back(Index);
+        }
+        else
+        {
+            Pool.Submit(Job, Index, Index + 1u, Submitted);
+        }
+    }
+
+    void Scheduler::Run(const std::size_t Index)
+    {
+        for (std::size_t Current = Index; Current != NoNode;)
+        {
+            Nodes[Current].Target->Update(FrameDeltaTime);
+
+            std::size_t Continuation { NoNode };
+
+            for (const std::size_t Successor : Nodes[Current].Successors)
+            {
+                if (Remaining[Successor].fetch_sub(1u, std::memory_order_acq_rel) != 1u)
+                {
+                    continue;
+                }
+
+                if (Continuation == NoNode && Nodes[Successor].MainThread == Nodes[Current].MainThread)
+                {
+                    Continuation = Successor;
+                }
+                else
+                {
+                    Dispatch(Successor);
+                }
+            }
+
+            Unfinished.fetch_sub(1u, std::memory_order_release);
+            Current = Continuation;
+        }
+    }
+
+    bool Scheduler::TryRunOnMainThread()
+    {
+        std::size_t Index {};
+
+        {
+            std::lock_guard Lock { MainThreadMutex };
+
+            if (MainThreadReady.empty())
+            {
+                return false;
+            }
+
+            Index = MainThreadReady.back();
+            MainThreadReady.pop_back();
+        }
+
+        Run(Index);
+        return true;
+    }
+}
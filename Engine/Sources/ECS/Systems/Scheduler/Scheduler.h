@@ -0,0 +1,75 @@
+#ifndef ENGINE_SOURCES_ECS_SYSTEMS_SCHEDULER_FILE_SCHEDULER_H
+#define ENGINE_SOURCES_ECS_SYSTEMS_SCHEDULER_FILE_SCHEDULER_H
+
+#include <ECS/Systems/System.h>
+#include <Jobs/JobPool/JobPool.h>
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <vector>
+
+namespace egg::Systems
+{
+    class Scheduler final
+    {
+    public:
+        explicit Scheduler(Jobs::JobPool& Pool);
+
+        Scheduler(const Scheduler&) = delete;
+
+        Scheduler(Scheduler&&) = delete;
+
+        ~Scheduler();
+
+        Scheduler& operator=(const Scheduler&) = delete;
+
+        Scheduler& operator=(Scheduler&&) = delete;
+
+        void Add(System& Target);
+
+        void Clear();
+
+        void Build();
+
+        void Update(float DeltaTime);
+
+        [[nodiscard]] std::span<const std::size_t> GetSuccessors(std::size_t Index) const noexcept;
+
+        [[nodiscard]] std::size_t GetSize() const noexcept;
+
+    private:
+        struct Node
+        {
+            System* Target;
+            std::vector<std::size_t> Successors;
+            std::size_t PredecessorsCount;
+            bool MainThread;
+        };
+
+        void Dispatch(std::size_t Index);
+
+        void Run(std::size_t Index);
+
+        bool TryRunOnMainThread();
+
+        Jobs::JobPool& Pool;
+        Jobs::JobPool::JobType Job;
+        Jobs::JobPool::CounterType Submitted;
+
+        std::vector<Node> Nodes;
+        std::vector<std::size_t> Roots;
+        std::unique_ptr<std::atomic<std::size_t>[]> Remaining;
+        std::atomic<std::size_t> Unfinished;
+
+        std::mutex MainThreadMutex;
+        std::vector<std::size_t> MainThreadReady;
+
+        float FrameDeltaTime;
+        bool Built;
+    };
+}
+
+#endif // ENGINE_SOURCES_ECS_SYSTEMS_SCHEDULER_FILE_SCHEDULER_H
@@ -1,6 +1,11 @@
 #ifndef ENGINE_SOURCES_ECS_SYSTEMS_FILE_SYSTEM_H
 #define ENGINE_SOURCES_ECS_SYSTEMS_FILE_SYSTEM_H
 
+#include <ECS/Systems/SystemAccess.h>
+#include <Types/TypeInfo/TypeInfo.h>
+
+#include <type_traits>
+
 namespace egg::Systems
 {
     class System
@@ -13,6 +18,34 @@ namespace egg::Systems
         virtual void Update(float DeltaTime) = 0;
 
         virtual void Terminate() = 0;
+
+        [[nodiscard]] const SystemAccess& GetAccess() const noexcept
+        {
+            return Access;
+        }
+
+    protected:
+        template <typename... ComponentTypes>
+        void Reads()
+        {
+            (Access.Reads.push_back(Types::TypeInfo<std::remove_cvref_t<ComponentTypes>>::GetID()), ...);
+            Access.Exclusive = false;
+        }
+
+        template <typename... ComponentTypes>
+        void Writes()
+        {
+            (Access.Writes.push_back(Types::TypeInfo<std::remove_cvref_t<ComponentTypes>>::GetID()), ...);
+            Access.Exclusive = false;
+        }
+
+        void RunOnMainThread() noexcept
+        {
+            Access.MainThread = true;
+        }
+
+    private:
+        SystemAccess Access {};
     };
 }
 
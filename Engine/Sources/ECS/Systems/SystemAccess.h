@@ -0,0 +1,19 @@
+#ifndef ENGINE_SOURCES_ECS_SYSTEMS_FILE_SYSTEM_ACCESS_H
+#define ENGINE_SOURCES_ECS_SYSTEMS_FILE_SYSTEM_ACCESS_H
+
+#include <Types/Types.h>
+
+#include <vector>
+
+namespace egg::Systems
+{
+    struct SystemAccess
+    {
+        std::vector<Types::IDType> Reads {};
+        std::vector<Types::IDType> Writes {};
+        bool Exclusive { true };
+        bool MainThread { false };
+    };
+}
+
+#endif // ENGINE_SOURCES_ECS_SYSTEMS_FILE_SYSTEM_ACCESS_H
@@ -0,0 +1,24 @@
+#ifndef ENGINE_SOURCES_ECS_TRAITS_FILE_CHANGE_TRACKING_TRAITS_H
+#define ENGINE_SOURCES_ECS_TRAITS_FILE_CHANGE_TRACKING_TRAITS_H
+
+#include <concepts>
+#include <cstdint>
+#include <type_traits>
+
+namespace egg::ECS
+{
+    using ChangeTick = std::uint32_t;
+
+
+    template <typename Type>
+    struct ChangeTrackingTraits : std::false_type
+    {
+    };
+
+    template <typename Type> requires requires { Type::TrackChanges; } && std::same_as<std::remove_cv_t<decltype(Type::TrackChanges)>, bool>
+    struct ChangeTrackingTraits<Type> : std::bool_constant<Type::TrackChanges>
+    {
+    };
+}
+
+#endif // ENGINE_SOURCES_ECS_TRAITS_FILE_CHANGE_TRACKING_TRAITS_H
@@ -0,0 +1,20 @@
+#ifndef ENGINE_SOURCES_ECS_TRAITS_FILE_IN_PLACE_DELETE_TRAITS_H
+#define ENGINE_SOURCES_ECS_TRAITS_FILE_IN_PLACE_DELETE_TRAITS_H
+
+#include <concepts>
+#include <type_traits>
+
+namespace egg::ECS
+{
+    template <typename Type>
+    struct InPlaceDeleteTraits : std::false_type
+    {
+    };
+
+    template <typename Type> requires requires { Type::InPlaceDelete; } && std::same_as<std::remove_cv_t<decltype(Type::InPlaceDelete)>, bool>
+    struct InPlaceDeleteTraits<Type> : std::bool_constant<Type::InPlaceDelete>
+    {
+    };
+}
+
+#endif // ENGINE_SOURCES_ECS_TRAITS_FILE_IN_PLACE_DELETE_TRAITS_H
@@ -6,7 +6,7 @@
 
 namespace egg
 {
-    Engine::Engine() : Systems { new Systems::Renderer {} }
+    Engine::Engine() : Systems { new Systems::Renderer {} }, Scheduler { Pool }
     {
     }
 
@@ -32,7 +32,10 @@ namespace egg
         for (auto* System : Systems)
         {
             System->Initialize();
+            Scheduler.Add(*System);
         }
+
+        Scheduler.Build();
     }
 
     void Engine::InitWindow(const Events::WindowCreated& Event)
@@ -46,10 +49,7 @@ namespace egg
         {
             glfwPollEvents();
 
-            for (auto* System : Systems)
-            {
-                System->Update(0u);
-            }
+            Scheduler.Update(0u);
         }
     }
 
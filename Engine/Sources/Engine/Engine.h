@@ -2,8 +2,10 @@
 #define ENGINE_SOURCES_ENGINE_FILE_ENGINE_H
 
 #include <ECS/Systems/System.h>
+#include <ECS/Systems/Scheduler/Scheduler.h>
 #include <Events/Types/WindowCreated/WindowCreated.h>
 #include <GUI/Window/Window.h>
+#include <Jobs/JobPool/JobPool.h>
 
 #include <memory>
 #include <vector>
@@ -36,6 +38,9 @@ namespace egg
 
         std::vector<Systems::System*> Systems;
 
+        Jobs::JobPool Pool;
+        Systems::Scheduler Scheduler;
+
         std::shared_ptr<GUI::Window> Window {};
     };
 }
@@ -8,6 +8,7 @@
 #include <Types/Constness.h>
 
 
+#include <cstddef>
 #include <functional>
 #include <tuple>
 #include <utility>
@@ -17,9 +18,15 @@ namespace egg::Events
     template <typename>
     class Delegate;
 
+    template <typename, std::size_t>
+    class InlineDelegate;
+
     template <typename ReturnType, typename... Args>
     class Delegate<ReturnType(Args...)>
     {
+        template <typename, std::size_t>
+        friend class InlineDelegate;
+
     public:
         using ResultType = ReturnType;
         using Signature = ResultType(Args...);
@@ -0,0 +1,277 @@
+#ifndef ENGINE_SOURCES_EVENTS_FILE_INLINE_DELEGATE_H
+#define ENGINE_SOURCES_EVENTS_FILE_INLINE_DELEGATE_H
+
+#include <Config/Config.h>
+#include <Events/ConnectionArgument.h>
+#include <Events/Delegate/Delegate.h>
+#include <Events/Traits/FunctionPointerTraits.h>
+
+#include <atomic>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace egg::Events
+{
+    inline constexpr std::size_t InlineDelegateCapacity { 32u };
+
+    template <typename, std::size_t = InlineDelegateCapacity>
+    class InlineDelegate;
+
+    template <typename ReturnType, typename... Args, std::size_t Capacity>
+    class InlineDelegate<ReturnType(Args...), Capacity>
+    {
+        using DelegateType = Delegate<ReturnType(Args...)>;
+
+    public:
+        using ResultType = ReturnType;
+        using Signature = ResultType(Args...);
+        using WrappedSignature = ResultType(const void*, Args...);
+
+        static constexpr std::size_t StorageSize { Capacity };
+
+        template <typename FunctorType>
+        static constexpr bool Storable {
+            std::is_class_v<FunctorType> &&
+            std::is_trivially_copyable_v<FunctorType> &&
+            sizeof(FunctorType) <= StorageSize &&
+            alignof(FunctorType) <= alignof(std::max_align_t) &&
+            std::is_invocable_r_v<ResultType, FunctorType&, Args...> &&
+            !std::same_as<FunctorType, InlineDelegate> &&
+            !std::same_as<FunctorType, DelegateType>
+        };
+
+
+        constexpr InlineDelegate() noexcept = default;
+
+        template <auto Candidate>
+        explicit InlineDelegate(ConnectionArgumentType<Candidate>) noexcept
+        {
+            Connect<Candidate>();
+        }
+
+        template <auto Candidate, typename Type> requires ValidValueOrInstance<Type&, decltype(Candidate)>
+        InlineDelegate(ConnectionArgumentType<Candidate>, Type& ValueOrInstance) noexcept
+        {
+            Connect<Candidate>(ValueOrInstance);
+        }
+
+        template <auto Candidate, typename Type> requires ValidValueOrInstance<Type*, decltype(Candidate)>
+        InlineDelegate(ConnectionArgumentType<Candidate>, Type* ValueOrInstance) noexcept
+        {
+            Connect<Candidate>(ValueOrInstance);
+        }
+
+        explicit InlineDelegate(WrappedSignature* WrappedCallable) noexcept
+        {
+            Connect(WrappedCallable);
+        }
+
+        template <typename Type>
+        InlineDelegate(WrappedSignature* WrappedCallable, Type& Payload) noexcept
+        {
+            Connect(WrappedCallable, Payload);
+        }
+
+        template <typename FunctorType> requires Storable<std::decay_t<FunctorType>>
+        explicit InlineDelegate(FunctorType&& Functor) noexcept(std::is_nothrow_constructible_v<std::decay_t<FunctorType>, FunctorType&&>)
+        {
+            Connect(std::forward<FunctorType>(Functor));
+        }
+
+        template <auto Candidate>
+        void Connect() noexcept
+        {
+            Bind<&InvokeBound<Candidate>>(nullptr);
+        }
+
+        template <auto Candidate, typename Type> requires ValidValueOrInstance<Type&, decltype(Candidate)>
+        void Connect(Type& ValueOrInstance) noexcept
+        {
+            Bind<&InvokeBound<Candidate, Type&>>(&ValueOrInstance);
+        }
+
+        template <auto Candidate, typename Type> requires ValidValueOrInstance<Type*, decltype(Candidate)>
+        void Connect(Type* ValueOrInstance) noexcept
+        {
+            Bind<&InvokeBound<Candidate, Type*>>(ValueOrInstance);
+        }
+
+        void Connect(WrappedSignature* WrappedCallable) noexcept
+        {
+            EGG_ASSERT(WrappedCallable, "Uninitialized function pointer");
+            Bind<&InvokeWrapped>(nullptr, WrappedCallable);
+        }
+
+        template <typename Type>
+        void Connect(WrappedSignature* WrappedCallable, Type& Payload) noexcept
+        {
+            EGG_ASSERT(WrappedCallable, "Uninitialized function pointer");
+            Bind<&InvokeWrapped>(&Payload, WrappedCallable);
+        }
+
+        template <typename FunctorType> requires Storable<std::decay_t<FunctorType>>
+        void Connect(FunctorType&& Functor) noexcept(std::is_nothrow_constructible_v<std::decay_t<FunctorType>, FunctorType&&>)
+        {
+            using StoredType = std::decay_t<FunctorType>;
+
+            Reset();
+            std::construct_at(reinterpret_cast<StoredType*>(Storage), std::forward<FunctorType>(Functor));
+            Callable = &InvokeOwned<StoredType>;
+            Comparator = &CompareOwned<StoredType>;
+            Identifier = NextIdentifier();
+        }
+
+        void Reset() noexcept
+        {
+            Callable = nullptr;
+            Comparator = nullptr;
+            Identifier = 0u;
+        }
+
+        [[nodiscard]] WrappedSignature* GetFunction() const noexcept
+        {
+            return Callable;
+        }
+
+        [[nodiscard]] const void* GetInstance() const noexcept
+        {
+            return IsOwning() ? nullptr : GetBound().Instance;
+        }
+
+        [[nodiscard]] bool IsOwning() const noexcept
+        {
+            return Comparator;
+        }
+
+        ResultType operator()(Args... Arguments) const
+            noexcept(std::is_nothrow_invocable_r_v<ResultType, WrappedSignature, const void*, Args...>)
+        {
+            EGG_ASSERT(static_cast<bool>(*this), "Uninitialized delegate");
+            return Callable(Storage, std::forward<Args>(Arguments)...);
+        }
+
+        [[nodiscard]] explicit operator bool() const noexcept
+        {
+            return Callable;
+        }
+
+        //Owned functors match copies of the same connection, or equal values when the functor provides operator==
+        [[nodiscard]] bool operator==(const InlineDelegate& Other) const noexcept
+        {
+            if (Callable != Other.Callable)
+            {
+                return false;
+            }
+
+            if (!IsOwning())
+            {
+                return GetBound().Instance == Other.GetBound().Instance && GetBound().Function == Other.GetBound().Function;
+            }
+
+            return Identifier == Other.Identifier || Comparator(Storage, Other.Storage);
+        }
+
+        [[nodiscard]] bool operator!=(const InlineDelegate& Other) const noexcept
+        {
+            return !(*this == Other);
+        }
+
+    private:
+        struct Bound
+        {
+            const void* Instance;
+            WrappedSignature* Function;
+        };
+
+        using ComparatorType = bool(const void*, const void*) noexcept;
+
+        template <auto Function>
+        void Bind(const void* const Instance, WrappedSignature* const Wrapped = nullptr) noexcept
+        {
+            Reset();
+            std::construct_at(reinterpret_cast<Bound*>(Storage), Instance, Wrapped);
+            Callable = Function;
+        }
+
+        [[nodiscard]] const Bound& GetBound() const noexcept
+        {
+            return *std::launder(reinterpret_cast<const Bound*>(Storage));
+        }
+
+        template <auto Candidate, typename... Type>
+        static ResultType InvokeBound(const void* Target, Args... Arguments)
+        {
+            return DelegateType::template GetWrapped<Candidate, Type...>()(
+                std::launder(static_cast<const Bound*>(Target))->Instance,
+                std::forward<Args>(Arguments)...
+            );
+        }
+
+        static ResultType InvokeWrapped(const void* Target, Args... Arguments)
+        {
+            const Bound& Current { *std::launder(static_cast<const Bound*>(Target)) };
+            return Current.Function(Current.Instance, std::forward<Args>(Arguments)...);
+        }
+
+        template <typename FunctorType>
+        static ResultType InvokeOwned(const void* Target, Args... Arguments)
+        {
+            return std::invoke_r<ResultType>(
+                *std::launder(static_cast<FunctorType*>(const_cast<void*>(Target))),
+                std::forward<Args>(Arguments)...
+            );
+        }
+
+        [[nodiscard]] static std::uint64_t NextIdentifier() noexcept
+        {
+            static std::atomic<std::uint64_t> Counter {};
+            return Counter.fetch_add(1u, std::memory_order_relaxed) + 1u;
+        }
+
+        template <typename FunctorType>
+        static bool CompareOwned(const void* Left, const void* Right) noexcept
+        {
+            if constexpr (std::equality_comparable<FunctorType>)
+            {
+                return *std::launder(static_cast<const FunctorType*>(Left)) == *std::launder(static_cast<const FunctorType*>(Right));
+            }
+            else
+            {
+                return false;
+            }
+        }
+
+        alignas(std::max_align_t) std::byte Storage[StorageSize] {};
+        WrappedSignature* Callable {};
+        ComparatorType* Comparator {};
+        std::uint64_t Identifier {};
+    };
+
+
+    template <typename SlotType, typename FunctorType>
+    concept SlotStorable = requires { requires SlotType::template Storable<FunctorType>; };
+
+
+    template <auto Candidate>
+    InlineDelegate(ConnectionArgumentType<Candidate>) -> InlineDelegate<typename FunctionPointerTraits<decltype(Candidate)>::Type>;
+
+    template <auto Candidate, typename Type> requires ValidValueOrInstance<Type&, decltype(Candidate)>
+    InlineDelegate(ConnectionArgumentType<Candidate>, Type&) -> InlineDelegate<typename FunctionPointerTraits<decltype(Candidate), Type&>::Type>;
+
+    template <auto Candidate, typename Type> requires ValidValueOrInstance<Type*, decltype(Candidate)>
+    InlineDelegate(ConnectionArgumentType<Candidate>, Type*) -> InlineDelegate<typename FunctionPointerTraits<decltype(Candidate), Type*>::Type>;
+
+    template <typename ReturnType, typename... Args>
+    InlineDelegate(ReturnType (*)(const void*, Args...)) -> InlineDelegate<ReturnType(Args...)>;
+
+    template <typename ReturnType, typename... Args, typename Type>
+    InlineDelegate(ReturnType (*)(const void*, Args...), Type&) -> InlineDelegate<ReturnType(Args...)>;
+}
+
+#endif // ENGINE_SOURCES_EVENTS_FILE_INLINE_DELEGATE_H
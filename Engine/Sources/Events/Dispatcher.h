@@ -1,8 +1,9 @@
 #ifndef ENGINE_SOURCES_EVENTS_FILE_DISPATCHER_H
 #define ENGINE_SOURCES_EVENTS_FILE_DISPATCHER_H
 
+#include <Config/Config.h>
 #include <Containers/CompressedPair/CompressedPair.h>
-#include <Containers/DenseMap/DenseMap.h>
+#include <Containers/DenseMap/LookupMap.h>
 #include <Events/EventLoop/EventLoop.h>
 #include <Events/EventLoop/EventLoopInterface.h>
 #include <Memory/Utils.h>
@@ -23,7 +24,7 @@ namespace egg::Events
 
         using DispatcherAllocatorTraits = std::allocator_traits<AllocatorParameter>;
         using ContainerAllocator = typename DispatcherAllocatorTraits::template rebind_alloc<std::pair<const KeyType, MappedType>>;
-        using ContainerType = Containers::DenseMap<KeyType, MappedType, std::identity, std::equal_to<>, ContainerAllocator>;
+        using ContainerType = Containers::LookupMap<KeyType, MappedType, std::identity, std::equal_to<>, ContainerAllocator>;
 
         template <Types::Decayed Type>
         using EventLoopFor = EventLoop<Type, typename DispatcherAllocatorTraits::template rebind_alloc<Type>>;
@@ -36,6 +37,9 @@ namespace egg::Events
         template <Types::Decayed EventType>
         using SinkFor = typename EventLoopFor<EventType>::SinkType;
 
+        template <Types::Decayed EventType>
+        using BatchSinkFor = typename EventLoopFor<EventType>::BatchSinkType;
+
 
         constexpr Dispatcher() : Dispatcher { AllocatorType {} }
         {
@@ -80,6 +84,14 @@ namespace egg::Events
             return Assure<EventType>(Identifier).GetSink();
         }
 
+        template <Types::Decayed EventType>
+        [[nodiscard]] constexpr BatchSinkFor<EventType> GetBatchSink(
+            const Types::IDType Identifier = Types::TypeInfo<EventType>::template GetID<Dispatcher>()
+        )
+        {
+            return Assure<EventType>(Identifier).GetBatchSink();
+        }
+
         template <Types::Decayed EventType, typename... Args>
         constexpr void Enqueue(Args&&... Arguments)
         {
@@ -110,6 +122,40 @@ namespace egg::Events
             Assure<std::decay_t<EventType>>(Identifier).Enqueue(std::forward<EventType>(Event));
         }
 
+        template <Types::Decayed EventType, typename... Args>
+        void EnqueueConcurrent(Args&&... Arguments)
+        {
+            EnqueueConcurrentWith<EventType>(
+                Types::TypeInfo<EventType>::template GetID<Dispatcher>(),
+                std::forward<Args>(Arguments)...
+            );
+        }
+
+        template <typename EventType>
+        void EnqueueConcurrent(EventType&& Event)
+        {
+            EnqueueConcurrentWith(
+                Types::TypeInfo<std::decay_t<EventType>>::template GetID<Dispatcher>(),
+                std::forward<EventType>(Event)
+            );
+        }
+
+        template <Types::Decayed EventType, typename... Args>
+        void EnqueueConcurrentWith(const Types::IDType Identifier, Args&&... Arguments)
+        {
+            auto* Loop { Find<EventType>(Identifier) };
+            EGG_ASSERT(Loop, "Event loop must be assured on the consumer thread before enqueueing concurrently");
+            Loop->EnqueueConcurrent(std::forward<Args>(Arguments)...);
+        }
+
+        template <typename EventType>
+        void EnqueueConcurrentWith(const Types::IDType Identifier, EventType&& Event)
+        {
+            auto* Loop { Find<std::decay_t<EventType>>(Identifier) };
+            EGG_ASSERT(Loop, "Event loop must be assured on the consumer thread before enqueueing concurrently");
+            Loop->EnqueueConcurrent(std::forward<EventType>(Event));
+        }
+
         template <typename EventType>
         constexpr void Trigger(EventType&& Event = {}) const
         {
@@ -206,6 +252,12 @@ namespace egg::Events
             return static_cast<EventLoopFor<EventType>&>(*Pointer);
         }
 
+        template <Types::Decayed EventType>
+        [[nodiscard]] constexpr EventLoopFor<EventType>* Find(const Types::IDType Identifier)
+        {
+            return const_cast<EventLoopFor<EventType>*>(std::as_const(*this).template Find<EventType>(Identifier));
+        }
+
         template <Types::Decayed EventType>
         [[nodiscard]] constexpr const EventLoopFor<EventType>* Find(const Types::IDType Identifier) const
         {
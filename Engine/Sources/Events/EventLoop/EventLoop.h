@@ -1,14 +1,20 @@
 #ifndef ENGINE_SOURCES_EVENTS_FILE_EVENT_LOOP_H
 #define ENGINE_SOURCES_EVENTS_FILE_EVENT_LOOP_H
 
+#include "./Internal/ProducerQueue.h"
+
 #include <Events/EventLoop/EventLoopInterface.h>
 #include <Events/Signal/Signal.h>
 #include <Events/Signal/Sink.h>
 #include <Types/Capabilities/Capabilities.h>
 
+#include <atomic>
 #include <concepts>
-#include <iterator>
+#include <cstdint>
 #include <memory>
+#include <span>
+#include <thread>
+#include <utility>
 #include <vector>
 
 namespace egg::Events
@@ -19,43 +25,128 @@ namespace egg::Events
         using LoopAllocatorTraits = std::allocator_traits<AllocatorParameter>;
 
         using CallbackSignature = void(const Type&);
-        using SignalType = Signal<CallbackSignature, typename LoopAllocatorTraits::template rebind_alloc<Delegate<CallbackSignature>>>;
+        using SignalType = Events::Signal<CallbackSignature, typename LoopAllocatorTraits::template rebind_alloc<Delegate<CallbackSignature>>>;
+
+        using BatchCallbackSignature = void(std::span<const Type>);
+        using BatchSignalType = Events::Signal<BatchCallbackSignature, typename LoopAllocatorTraits::template rebind_alloc<Delegate<BatchCallbackSignature>>>;
 
         using ContainerType = std::vector<Type, AllocatorParameter>;
 
+        using ProducerType = Internal::ProducerQueue<Type, AllocatorParameter>;
+        using ProducerAllocator = typename LoopAllocatorTraits::template rebind_alloc<ProducerType>;
+        using ProducerAllocatorTraits = std::allocator_traits<ProducerAllocator>;
+
     public:
         using AllocatorType = AllocatorParameter;
 
         using SinkType = Sink<SignalType>;
+        using BatchSinkType = Sink<BatchSignalType>;
         using EventType = Type;
 
 
-        constexpr EventLoop()
+        EventLoop()
             noexcept(
                 std::is_nothrow_default_constructible_v<SignalType> &&
+                std::is_nothrow_default_constructible_v<BatchSignalType> &&
                 std::is_nothrow_default_constructible_v<ContainerType>)
-        = default;
+            : Producers {}, Identifier { Internal::NextProducersIdentifier() }
+        {
+        }
 
-        constexpr explicit EventLoop(const AllocatorType& Allocator)
-            noexcept(std::is_nothrow_constructible_v<SignalType, const AllocatorType&>)
-            : Signal { Allocator }, Events { Allocator }
+        explicit EventLoop(const AllocatorType& Allocator)
+            noexcept(
+                std::is_nothrow_constructible_v<SignalType, const AllocatorType&> &&
+                std::is_nothrow_constructible_v<BatchSignalType, const AllocatorType&>)
+            : Signal { Allocator },
+              BatchSignal { Allocator },
+              Events { Allocator },
+              Publishing { Allocator },
+              Producers {},
+              Identifier { Internal::NextProducersIdentifier() }
         {
         }
 
-        constexpr void Publish() override
+        EventLoop(const EventLoop&) = delete;
+
+        EventLoop(EventLoop&& Other)
+            noexcept(
+                std::is_nothrow_move_constructible_v<SignalType> &&
+                std::is_nothrow_move_constructible_v<BatchSignalType> &&
+                std::is_nothrow_move_constructible_v<ContainerType>)
+            : Signal { std::move(Other.Signal) },
+              BatchSignal { std::move(Other.BatchSignal) },
+              Events { std::move(Other.Events) },
+              Publishing { std::move(Other.Publishing) },
+              Producers { Other.Producers.exchange(nullptr, std::memory_order_acq_rel) },
+              Identifier { std::exchange(Other.Identifier, Internal::NextProducersIdentifier()) }
         {
-            const std::size_t EventCount { GetSize() };
+        }
 
-            for (std::size_t Position = 0u; Position < EventCount; ++Position)
+        ~EventLoop() noexcept override
+        {
+            ReleaseProducers();
+        }
+
+        EventLoop& operator=(const EventLoop&) = delete;
+
+        EventLoop& operator=(EventLoop&& Other)
+            noexcept(
+                std::is_nothrow_move_assignable_v<SignalType> &&
+                std::is_nothrow_move_assignable_v<BatchSignalType> &&
+                std::is_nothrow_move_assignable_v<ContainerType>)
+        {
+            if (this != &Other)
             {
-                Signal.Publish(Events[Position]);
+                ReleaseProducers();
+                Signal = std::move(Other.Signal);
+                BatchSignal = std::move(Other.BatchSignal);
+                Events = std::move(Other.Events);
+                Publishing = std::move(Other.Publishing);
+                Producers.store(Other.Producers.exchange(nullptr, std::memory_order_acq_rel), std::memory_order_release);
+                Identifier = std::exchange(Other.Identifier, Internal::NextProducersIdentifier());
             }
 
-            Events.erase(Events.cbegin(), std::next(Events.cbegin(), EventCount));
+            return *this;
+        }
+
+        //A listener publishing again returns early, whatever it enqueued is left for the next Publish
+        void Publish() override
+        {
+            if (!Publishing.empty())
+            {
+                return;
+            }
+
+            Collect();
+            Publishing.swap(Events);
+
+            try
+            {
+                if (!Publishing.empty())
+                {
+                    BatchSignal.Publish(std::span<const EventType> { Publishing });
+                }
+
+                if (!Signal.Empty())
+                {
+                    for (const EventType& Event : Publishing)
+                    {
+                        Signal.Publish(Event);
+                    }
+                }
+            }
+            catch (...)
+            {
+                Publishing.clear();
+                throw;
+            }
+
+            Publishing.clear();
         }
 
         constexpr void Trigger(EventType Event) const
         {
+            BatchSignal.Publish(std::span<const EventType> { &Event, 1u });
             Signal.Publish(Event);
         }
 
@@ -72,8 +163,19 @@ namespace egg::Events
             }
         }
 
-        constexpr void Clear() noexcept override
+        template <typename... Args>
+        void EnqueueConcurrent(Args&&... Arguments)
         {
+            AssureProducer().Push(std::forward<Args>(Arguments)...);
+        }
+
+        void Clear() noexcept override
+        {
+            for (ProducerType* Current { Producers.load(std::memory_order_acquire) }; Current; Current = Current->GetNext())
+            {
+                Current->Drain([](EventType&&) noexcept {});
+            }
+
             Events.clear();
         }
 
@@ -82,14 +184,102 @@ namespace egg::Events
             return SinkType { Signal };
         }
 
-        [[nodiscard]] constexpr std::size_t GetSize() const noexcept override
+        [[nodiscard]] constexpr BatchSinkType GetBatchSink() noexcept
         {
-            return Events.size();
+            return BatchSinkType { BatchSignal };
+        }
+
+        [[nodiscard]] std::size_t GetSize() const noexcept override
+        {
+            std::size_t EventCount { Events.size() };
+
+            for (const ProducerType* Current { Producers.load(std::memory_order_acquire) }; Current; Current = Current->GetNext())
+            {
+                EventCount += Current->GetSize();
+            }
+
+            return EventCount;
         }
 
     private:
+        [[nodiscard]] ProducerType& AssureProducer()
+        {
+            thread_local std::pair<std::uint64_t, ProducerType*> Cached {};
+
+            if (Cached.first == Identifier)
+            {
+                return *Cached.second;
+            }
+
+            const std::thread::id Owner { std::this_thread::get_id() };
+            ProducerType* Head { Producers.load(std::memory_order_acquire) };
+
+            for (ProducerType* Current { Head }; Current; Current = Current->GetNext())
+            {
+                if (Current->GetOwner() == Owner)
+                {
+                    Cached = { Identifier, Current };
+                    return *Current;
+                }
+            }
+
+            ProducerAllocator Allocator { Events.get_allocator() };
+            ProducerType* Queue { ProducerAllocatorTraits::allocate(Allocator, 1u) };
+
+            try
+            {
+                ProducerAllocatorTraits::construct(Allocator, Queue, Events.get_allocator(), Owner);
+            }
+            catch (...)
+            {
+                ProducerAllocatorTraits::deallocate(Allocator, Queue, 1u);
+                throw;
+            }
+
+            do
+            {
+                Queue->SetNext(Head);
+            }
+            while (!Producers.compare_exchange_weak(Head, Queue, std::memory_order_release, std::memory_order_acquire));
+
+            Cached = { Identifier, Queue };
+            return *Queue;
+        }
+
+        void Collect()
+        {
+            for (ProducerType* Current { Producers.load(std::memory_order_acquire) }; Current; Current = Current->GetNext())
+            {
+                if (const std::size_t Pending { Current->GetSize() })
+                {
+                    Events.reserve(Events.size() + Pending);
+                    Current->Drain([this](EventType&& Event)
+                    {
+                        Events.push_back(std::move(Event));
+                    });
+                }
+            }
+        }
+
+        void ReleaseProducers() noexcept
+        {
+            ProducerAllocator Allocator { Events.get_allocator() };
+
+            for (ProducerType* Current { Producers.exchange(nullptr, std::memory_order_acq_rel) }; Current;)
+            {
+                ProducerType* Next { Current->GetNext() };
+                ProducerAllocatorTraits::destroy(Allocator, Current);
+                ProducerAllocatorTraits::deallocate(Allocator, Current, 1u);
+                Current = Next;
+            }
+        }
+
         SignalType Signal;
+        BatchSignalType BatchSignal;
         ContainerType Events;
+        ContainerType Publishing;
+        std::atomic<ProducerType*> Producers;
+        std::uint64_t Identifier;
     };
 }
 
@@ -0,0 +1,211 @@
+#ifndef ENGINE_SOURCES_EVENTS_EVENT_LOOP_INTERNAL_FILE_PRODUCER_QUEUE_H
+#define ENGINE_SOURCES_EVENTS_EVENT_LOOP_INTERNAL_FILE_PRODUCER_QUEUE_H
+
+#include <Memory/Constants.h>
+#include <Types/Capabilities/Capabilities.h>
+
+#include <algorithm>
+#include <atomic>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+namespace egg::Events::Internal
+{
+    [[nodiscard]] inline std::uint64_t NextProducersIdentifier() noexcept
+    {
+        static std::atomic<std::uint64_t> Counter {};
+        return Counter.fetch_add(1u, std::memory_order_relaxed) + 1u;
+    }
+
+
+    template <Types::Decayed Type, Types::ValidAllocator<Type> AllocatorParameter>
+    class ProducerQueue final
+    {
+        static constexpr std::size_t SegmentCapacity { std::max(Memory::PageSize<Type>, std::size_t { 1u }) };
+
+        struct Segment
+        {
+            Segment() noexcept : Next {}
+            {
+            }
+
+            std::atomic<Segment*> Next;
+            alignas(Type) std::byte Storage[SegmentCapacity * sizeof(Type)];
+        };
+
+        using SegmentAllocator = typename std::allocator_traits<AllocatorParameter>::template rebind_alloc<Segment>;
+        using SegmentAllocatorTraits = std::allocator_traits<SegmentAllocator>;
+
+    public:
+        using AllocatorType = AllocatorParameter;
+        using ValueType = Type;
+
+
+        ProducerQueue(const AllocatorType& Allocator, const std::thread::id Owner)
+            : Allocator { Allocator },
+              Owner { Owner },
+              Next {},
+              Tail { Acquire(nullptr) },
+              TailIndex {},
+              Produced {},
+              Head { Tail },
+              HeadIndex {},
+              Consumed {},
+              Spare {}
+        {
+        }
+
+        ProducerQueue(const ProducerQueue&) = delete;
+
+        ProducerQueue(ProducerQueue&&) = delete;
+
+        ~ProducerQueue() noexcept
+        {
+            Drain([](Type&&) noexcept {});
+
+            for (Segment* Current { Head }; Current;)
+            {
+                Release(std::exchange(Current, Current->Next.load(std::memory_order_relaxed)));
+            }
+
+            if (Segment* Retired { Spare.load(std::memory_order_relaxed) })
+            {
+                Release(Retired);
+            }
+        }
+
+        ProducerQueue& operator=(const ProducerQueue&) = delete;
+
+        ProducerQueue& operator=(ProducerQueue&&) = delete;
+
+        template <typename... Args>
+        void Push(Args&&... Arguments)
+        {
+            if (TailIndex == SegmentCapacity)
+            {
+                Segment* Fresh { Acquire(Spare.exchange(nullptr, std::memory_order_acquire)) };
+                Tail->Next.store(Fresh, std::memory_order_release);
+                Tail = Fresh;
+                TailIndex = 0u;
+            }
+
+            if constexpr (std::is_aggregate_v<Type> && (sizeof...(Args) != 0u || !std::default_initializable<Type>))
+            {
+                std::construct_at(Slot(Tail, TailIndex), Type { std::forward<Args>(Arguments)... });
+            }
+            else
+            {
+                std::construct_at(Slot(Tail, TailIndex), std::forward<Args>(Arguments)...);
+            }
+
+            ++TailIndex;
+            Produced.store(Produced.load(std::memory_order_relaxed) + 1u, std::memory_order_release);
+        }
+
+        template <typename CallableType>
+        void Drain(CallableType&& Callable)
+        {
+            const std::size_t Available { Produced.load(std::memory_order_acquire) - Consumed.load(std::memory_order_relaxed) };
+
+            for (std::size_t Position = 0u; Position < Available; ++Position)
+            {
+                if (HeadIndex == SegmentCapacity)
+                {
+                    Retire(std::exchange(Head, Head->Next.load(std::memory_order_acquire)));
+                    HeadIndex = 0u;
+                }
+
+                Type* Current { Slot(Head, HeadIndex++) };
+                Consumed.store(Consumed.load(std::memory_order_relaxed) + 1u, std::memory_order_release);
+
+                try
+                {
+                    Callable(std::move(*Current));
+                }
+                catch (...)
+                {
+                    std::destroy_at(Current);
+                    throw;
+                }
+
+                std::destroy_at(Current);
+            }
+        }
+
+        //Approximate outside the consumer, Consumed is acquired before Produced so the difference never wraps
+        [[nodiscard]] std::size_t GetSize() const noexcept
+        {
+            const std::size_t Popped { Consumed.load(std::memory_order_acquire) };
+            return Produced.load(std::memory_order_acquire) - Popped;
+        }
+
+        [[nodiscard]] std::thread::id GetOwner() const noexcept
+        {
+            return Owner;
+        }
+
+        [[nodiscard]] ProducerQueue* GetNext() const noexcept
+        {
+            return Next;
+        }
+
+        void SetNext(ProducerQueue* const Queue) noexcept
+        {
+            Next = Queue;
+        }
+
+    private:
+        [[nodiscard]] static Type* Slot(Segment* const Target, const std::size_t Index) noexcept
+        {
+            return std::launder(reinterpret_cast<Type*>(Target->Storage)) + Index;
+        }
+
+        [[nodiscard]] Segment* Acquire(Segment* Recycled)
+        {
+            if (Recycled)
+            {
+                Recycled->Next.store(nullptr, std::memory_order_relaxed);
+                return Recycled;
+            }
+
+            Segment* Fresh { SegmentAllocatorTraits::allocate(Allocator, 1u) };
+            SegmentAllocatorTraits::construct(Allocator, Fresh);
+            return Fresh;
+        }
+
+        void Retire(Segment* const Target) noexcept
+        {
+            if (Segment* Previous { Spare.exchange(Target, std::memory_order_acq_rel) })
+            {
+                Release(Previous);
+            }
+        }
+
+        void Release(Segment* const Target) noexcept
+        {
+            SegmentAllocatorTraits::destroy(Allocator, Target);
+            SegmentAllocatorTraits::deallocate(Allocator, Target, 1u);
+        }
+
+        SegmentAllocator Allocator;
+        const std::thread::id Owner;
+        ProducerQueue* Next;
+
+        alignas(Memory::CacheLineSize) Segment* Tail;
+        std::size_t TailIndex;
+        std::atomic<std::size_t> Produced;
+
+        alignas(Memory::CacheLineSize) Segment* Head;
+        std::size_t HeadIndex;
+        std::atomic<std::size_t> Consumed;
+
+        alignas(Memory::CacheLineSize) std::atomic<Segment*> Spare;
+    };
+}
+
+#endif // ENGINE_SOURCES_EVENTS_EVENT_LOOP_INTERNAL_FILE_PRODUCER_QUEUE_H
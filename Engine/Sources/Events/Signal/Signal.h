@@ -4,20 +4,24 @@
 #include <Events/ConnectionArgument.h>
 #include <Events/Delegate/Action.h>
 #include <Events/Delegate/Delegate.h>
+#include <Events/Delegate/InlineDelegate.h>
 
+#include <concepts>
 #include <memory>
 #include <vector>
 
 namespace egg::Events
 {
-    template <typename Type, typename = std::allocator<Delegate<Type>>>
+    template <typename Type, typename = std::allocator<Delegate<Type>>, typename = Delegate<Type>>
     class Signal;
 
 
-    template <typename ReturnType, typename... Args, typename AllocatorParameter>
-    class Signal<ReturnType(Args...), AllocatorParameter>
+    template <typename ReturnType, typename... Args, typename AllocatorParameter, typename SlotParameter>
+    class Signal<ReturnType(Args...), AllocatorParameter, SlotParameter>
     {
-        using SlotType = Delegate<ReturnType(Args...)>;
+        using SlotType = SlotParameter;
+
+        static_assert(std::same_as<typename SlotType::Signature, ReturnType(Args...)>, "Slot signature differs from the signal signature");
 
         using ContainerAllocatorTraits = std::allocator_traits<AllocatorParameter>;
         using ContainerType = std::vector<SlotType, typename ContainerAllocatorTraits::template rebind_alloc<SlotType>>;
@@ -99,6 +103,12 @@ namespace egg::Events
             return ConnectDelegate(std::move(WrappedFunction), Payload);
         }
 
+        template <typename FunctorType> requires SlotStorable<SlotType, std::decay_t<FunctorType>>
+        constexpr Action<void(SlotType)> Connect(FunctorType&& Functor)
+        {
+            return ConnectDelegate(SlotType { std::forward<FunctorType>(Functor) });
+        }
+
         constexpr void Publish(Args... Arguments) const
         {
             for (std::size_t Position = GetSize(); Position--;)
@@ -169,6 +179,11 @@ namespace egg::Events
             DisconnectDelegate(WrappedFunction, Payload);
         }
 
+        constexpr void Disconnect(SlotType Slot)
+        {
+            DisconnectDelegate(std::move(Slot));
+        }
+
         template <typename Type>
         constexpr void Disconnect(Type& ValueOrInstance)
         {
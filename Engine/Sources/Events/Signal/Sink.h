@@ -3,16 +3,20 @@
 
 #include <Events/Signal/Signal.h>
 
+#include <type_traits>
+#include <utility>
+
 namespace egg::Events
 {
     template <typename>
     class Sink;
 
-    template <typename ReturnType, typename... Args, typename Allocator>
-    class Sink<Signal<ReturnType(Args...), Allocator>>
+    template <typename ReturnType, typename... Args, typename Allocator, typename Slot>
+    class Sink<Signal<ReturnType(Args...), Allocator, Slot>>
     {
     public:
-        using SignalType = Signal<ReturnType(Args...), Allocator>;
+        using SignalType = Signal<ReturnType(Args...), Allocator, Slot>;
+        using SlotType = Slot;
 
         using ResultType = typename SignalType::ResultType;
         using Signature = typename SignalType::Signature;
@@ -52,6 +56,12 @@ namespace egg::Events
             return Connections.Connect(WrappedFunction, Payload);
         }
 
+        template <typename FunctorType> requires SlotStorable<SlotType, std::decay_t<FunctorType>>
+        constexpr Action<void(SlotType)> Connect(FunctorType&& Functor)
+        {
+            return Connections.Connect(std::forward<FunctorType>(Functor));
+        }
+
         template <auto Candidate>
         constexpr void Disconnect()
         {
@@ -81,6 +91,11 @@ namespace egg::Events
             Connections.Disconnect(WrappedFunction, Payload);
         }
 
+        constexpr void Disconnect(SlotType Callable)
+        {
+            Connections.Disconnect(std::move(Callable));
+        }
+
         template <typename Type>
         constexpr void Disconnect(Type& ValueOrInstance)
         {
@@ -0,0 +1,30 @@
+#ifndef ENGINE_SOURCES_JOBS_FILE_EXECUTOR_H
+#define ENGINE_SOURCES_JOBS_FILE_EXECUTOR_H
+
+#include <Memory/Constants.h>
+
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+
+namespace egg::Jobs
+{
+    inline constexpr std::size_t ChunksPerThread { 4u };
+
+    inline constexpr std::size_t MinimalChunkSize { 1024u };
+
+    template <typename Type>
+    concept Executor = requires(Type& Value, const std::size_t Size, void (*Callable)(std::size_t, std::size_t))
+    {
+        { Value.GetConcurrency() } -> std::convertible_to<std::size_t>;
+        Value.ParallelFor(Size, Size, Callable);
+    };
+
+    [[nodiscard]] constexpr std::size_t GetChunkSize(const std::size_t Size, const std::size_t Concurrency, const std::size_t Alignment) noexcept
+    {
+        const std::size_t Chunk { std::max(Size / (std::max(Concurrency, std::size_t { 1u }) * ChunksPerThread), MinimalChunkSize) };
+        return (Chunk + Alignment - 1u) / Alignment * Alignment;
+    }
+}
+
+#endif // ENGINE_SOURCES_JOBS_FILE_EXECUTOR_H
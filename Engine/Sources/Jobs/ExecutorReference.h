@@ -0,0 +1,53 @@
+#ifndef ENGINE_SOURCES_JOBS_FILE_EXECUTOR_REFERENCE_H
+#define ENGINE_SOURCES_JOBS_FILE_EXECUTOR_REFERENCE_H
+
+#include <Events/Delegate/Delegate.h>
+#include <Jobs/Executor.h>
+
+#include <concepts>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <type_traits>
+
+namespace egg::Jobs
+{
+    class ExecutorReference final
+    {
+        using RangeType = Events::Delegate<void(std::size_t, std::size_t)>;
+        using RunSignature = void(const void*, std::size_t, std::size_t, RangeType);
+
+    public:
+        template <Executor ExecutorType> requires (!std::same_as<std::remove_const_t<ExecutorType>, ExecutorReference>)
+        explicit ExecutorReference(ExecutorType& Target) noexcept
+            : Instance { std::addressof(Target) },
+              Run { [](const void* const Instance, const std::size_t Size, const std::size_t Grain, const RangeType Range)
+              {
+                  static_cast<ExecutorType*>(const_cast<void*>(Instance))->ParallelFor(Size, Grain, Range);
+              } },
+              Concurrency { Target.GetConcurrency() }
+        {
+        }
+
+        [[nodiscard]] std::size_t GetConcurrency() const noexcept
+        {
+            return Concurrency;
+        }
+
+        template <std::invocable<std::size_t, std::size_t> CallableType>
+        void ParallelFor(const std::size_t Size, const std::size_t Grain, const CallableType& Callable) const
+        {
+            Run(Instance, Size, Grain, RangeType { [](const void* const Payload, const std::size_t First, const std::size_t Last)
+            {
+                std::invoke(*static_cast<const CallableType*>(Payload), First, Last);
+            }, Callable });
+        }
+
+    private:
+        const void* Instance;
+        RunSignature* Run;
+        std::size_t Concurrency;
+    };
+}
+
+#endif // ENGINE_SOURCES_JOBS_FILE_EXECUTOR_REFERENCE_H
@@ -0,0 +1,226 @@
+#include "./JobPool.h"
+
+#include <limits>
+
+namespace egg::Jobs
+{
+    namespace
+    {
+        constexpr std::size_t ExternalIndex { std::numeric_limits<std::size_t>::max() };
+
+        thread_local const JobPool* CurrentPool {};
+        thread_local std::size_t CurrentIndex { ExternalIndex };
+
+        std::size_t GetCurrentIndex(const JobPool* Pool) noexcept
+        {
+            return CurrentPool == Pool ? CurrentIndex : ExternalIndex;
+        }
+    }
+
+    JobPool::JobPool() : JobPool { GetDefaultWorkersCount() }
+    {
+    }
+
+    JobPool::JobPool(const std::size_t WorkersCount)
+        : Queues(std::max(WorkersCount, std::size_t { 1u })),
+          Pending {},
+          Sleeping {},
+          NextQueue {},
+          Stopping {}
+    {
+        Workers.reserve(WorkersCount);
+
+        for (std::size_t Index = 0u; Index < WorkersCount; ++Index)
+        {
+            Workers.emplace_back(&JobPool::WorkerLoop, this, Index);
+        }
+    }
+
+    JobPool::~JobPool()
+    {
+        {
+            std::lock_guard Lock { SleepMutex };
+            Stopping.store(true, std::memory_order_release);
+        }
+
+        SleepCondition.notify_all();
+        Workers.clear();
+    }
+
+    void JobPool::Submit(const JobType Callable, const std::size_t FirstArgument, const std::size_t LastArgument, CounterType& Counter)
+    {
+        if (FirstArgument >= LastArgument)
+        {
+            return;
+        }
+
+        const std::size_t Count { LastArgument - FirstArgument };
+        Counter.fetch_add(Count, std::memory_order_relaxed);
+
+        const std::size_t Start { NextQueue.fetch_add(1u, std::memory_order_relaxed) };
+
+        for (std::size_t Offset = 0u; Offset < std::min(Count, Queues.size()); ++Offset)
+        {
+            Queue& Current { Queues[(Start + Offset) % Queues.size()] };
+            std::lock_guard Lock { Current.Mutex };
+
+            for (std::size_t Argument = FirstArgument + Offset; Argument < LastArgument; Argument += Queues.size())
+            {
+                Current.Jobs.push_back(Job { Callable, Argument, &Counter });
+            }
+        }
+
+        Pending.fetch_add(Count);
+
+        if (!Sleeping.load())
+        {
+            return;
+        }
+
+        {
+            std::lock_guard Lock { SleepMutex };
+        }
+
+        if (Count == 1u)
+        {
+            SleepCondition.notify_one();
+        }
+        else
+        {
+            SleepCondition.notify_all();
+        }
+    }
+
+    void JobPool::Wait(const CounterType& Counter)
+    {
+        const std::size_t Index { GetCurrentIndex(this) };
+
+        while (Counter.load(std::memory_order_acquire))
+        {
+            if (!TryRunJob(Index))
+            {
+                std::this_thread::yield();
+            }
+        }
+    }
+
+    bool JobPool::RunPendingJob()
+    {
+        return TryRunJob(GetCurrentIndex(this));
+    }
+
+    std::size_t JobPool::GetConcurrency() const noexcept
+    {
+        return Workers.size() + 1u;
+    }
+
+    std::size_t JobPool::GetWorkersCount() const noexcept
+    {
+        return Workers.size();
+    }
+
+    std::size_t JobPool::GetThreadIndex() const noexcept
+    {
+        const std::size_t Index { GetCurrentIndex(this) };
+        return Index == ExternalIndex ? Workers.size() : Index;
+    }
+
+    std::size_t JobPool::GetDefaultWorkersCount() noexcept
+    {
+        return std::max(std::thread::hardware_concurrency(), 2u) - 1u;
+    }
+
+    void JobPool::WorkerLoop(const std::size_t Index)
+    {
+        CurrentPool = this;
+        CurrentIndex = Index;
+
+        while (true)
+        {
+            if (TryRunJob(Index))
+            {
+                continue;
+            }
+
+            std::unique_lock Lock { SleepMutex };
+            Sleeping.fetch_add(1u);
+            SleepCondition.wait(Lock, [this]
+            {
+                return Stopping.load(std::memory_order_acquire) || Pending.load();
+            });
+            Sleeping.fetch_sub(1u);
+
+            if (Stopping.load(std::memory_order_acquire) && !Pending.load(std::memory_order_acquire))
+            {
+                return;
+            }
+        }
+    }
+
+    bool JobPool::TryRunJob(const std::size_t Index)
+    {
+        if (Job Current {}; TryPop(Index, Current) || TrySteal(Index, Current))
+        {
+            Pending.fetch_sub(1u, std::memory_order_relaxed);
+            Execute(Current);
+            return true;
+        }
+
+        return false;
+    }
+
+    bool JobPool::TryPop(const std::size_t Index, Job& Result)
+    {
+        if (Index == ExternalIndex)
+        {
+            return false;
+        }
+
+        Queue& Own { Queues[Index] };
+        std::lock_guard Lock { Own.Mutex };
+
+        if (Own.Jobs.empty())
+        {
+            return false;
+        }
+
+        Result = Own.Jobs.back();
+        Own.Jobs.pop_back();
+        return true;
+    }
+
+    bool JobPool::TrySteal(const std::size_t Index, Job& Result)
+    {
+        const std::size_t Start { Index == ExternalIndex ? 0u : Index + 1u };
+
+        for (std::size_t Offset = 0u; Offset < Queues.size(); ++Offset)
+        {
+            const std::size_t Victim { (Start + Offset) % Queues.size() };
+
+            if (Victim == Index)
+            {
+                continue;
+            }
+
+            Queue& Other { Queues[Victim] };
+            std::unique_lock Lock { Other.Mutex, std::try_to_lock };
+
+            if (!Lock.owns_lock() || Other.Jobs.empty())
+            {
+                continue;
+            }
+
+            Result = Other.Jobs.front();
+            Other.Jobs.pop_front();
+            return true;
+        }
+
+        return false;
+    }
+
+    void JobPool::Execute(const Job& Current)
+    {
+        Current.Callable(Current.Argument);
+        Current.Counter->fetch_sub(1u, std::memory_order_release);
+    }
+}
@@ -0,0 +1,132 @@
+#ifndef ENGINE_SOURCES_JOBS_JOB_POOL_FILE_JOB_POOL_H
+#define ENGINE_SOURCES_JOBS_JOB_POOL_FILE_JOB_POOL_H
+
+#include <Config/Config.h>
+#include <Events/ConnectionArgument.h>
+#include <Events/Delegate/Delegate.h>
+#include <Memory/Constants.h>
+
+#include <algorithm>
+#include <atomic>
+#include <concepts>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace egg::Jobs
+{
+    class JobPool final
+    {
+        template <typename CallableType>
+        struct RangeTask
+        {
+            void Run(const std::size_t Chunk) const
+            {
+                const std::size_t First { Chunk * Grain };
+                std::invoke(Callable, First, std::min(First + Grain, Size));
+            }
+
+            std::size_t Size;
+            std::size_t Grain;
+            CallableType& Callable;
+        };
+
+    public:
+        using JobType = Events::Delegate<void(std::size_t)>;
+        using CounterType = std::atomic<std::size_t>;
+
+
+        JobPool();
+
+        explicit JobPool(std::size_t WorkersCount);
+
+        JobPool(const JobPool&) = delete;
+
+        JobPool(JobPool&&) = delete;
+
+        ~JobPool();
+
+        JobPool& operator=(const JobPool&) = delete;
+
+        JobPool& operator=(JobPool&&) = delete;
+
+        void Submit(JobType Callable, std::size_t FirstArgument, std::size_t LastArgument, CounterType& Counter);
+
+        void Wait(const CounterType& Counter);
+
+        bool RunPendingJob();
+
+        template <std::invocable<std::size_t, std::size_t> CallableType>
+        void ParallelFor(const std::size_t Size, const std::size_t Grain, CallableType Callable)
+        {
+            EGG_ASSERT(Grain, "Grain must be greater than zero");
+
+            const std::size_t ChunksCount { (Size + Grain - 1u) / Grain };
+
+            if (ChunksCount <= 1u || Workers.empty())
+            {
+                for (std::size_t First = 0u; First < Size; First += Grain)
+                {
+                    std::invoke(Callable, First, std::min(First + Grain, Size));
+                }
+                return;
+            }
+
+            const RangeTask<CallableType> Task { Size, Grain, Callable };
+            CounterType Counter {};
+
+            Submit(JobType { Events::ConnectionArgument<&RangeTask<CallableType>::Run>, Task }, 1u, ChunksCount, Counter);
+            Task.Run(0u);
+            Wait(Counter);
+        }
+
+        [[nodiscard]] std::size_t GetConcurrency() const noexcept;
+
+        [[nodiscard]] std::size_t GetWorkersCount() const noexcept;
+
+        [[nodiscard]] std::size_t GetThreadIndex() const noexcept;
+
+        [[nodiscard]] static std::size_t GetDefaultWorkersCount() noexcept;
+
+    private:
+        struct Job
+        {
+            JobType Callable;
+            std::size_t Argument;
+            CounterType* Counter;
+        };
+
+        struct alignas(Memory::CacheLineSize) Queue
+        {
+            std::mutex Mutex;
+            std::deque<Job> Jobs;
+        };
+
+        void WorkerLoop(std::size_t Index);
+
+        bool TryRunJob(std::size_t Index);
+
+        bool TryPop(std::size_t Index, Job& Result);
+
+        bool TrySteal(std::size_t Index, Job& Result);
+
+        static void Execute(const Job& Current);
+
+        std::vector<Queue> Queues;
+        std::vector<std::jthread> Workers;
+
+        alignas(Memory::CacheLineSize) std::atomic<std::size_t> Pending;
+        std::atomic<std::size_t> Sleeping;
+        std::atomic<std::size_t> NextQueue;
+        std::atomic<bool> Stopping;
+
+        std::mutex SleepMutex;
+        std::condition_variable SleepCondition;
+    };
+}
+
+#endif // ENGINE_SOURCES_JOBS_JOB_POOL_FILE_JOB_POOL_H
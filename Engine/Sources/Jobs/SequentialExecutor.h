@@ -0,0 +1,34 @@
+#ifndef ENGINE_SOURCES_JOBS_FILE_SEQUENTIAL_EXECUTOR_H
+#define ENGINE_SOURCES_JOBS_FILE_SEQUENTIAL_EXECUTOR_H
+
+#include <Config/Config.h>
+
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <functional>
+
+namespace egg::Jobs
+{
+    class SequentialExecutor final
+    {
+    public:
+        [[nodiscard]] constexpr std::size_t GetConcurrency() const noexcept
+        {
+            return 1u;
+        }
+
+        template <std::invocable<std::size_t, std::size_t> CallableType>
+        constexpr void ParallelFor(const std::size_t Size, const std::size_t Grain, CallableType Callable) const
+        {
+            EGG_ASSERT(Grain, "Grain must be greater than zero");
+
+            for (std::size_t First = 0u; First < Size; First += Grain)
+            {
+                std::invoke(Callable, First, std::min(First + Grain, Size));
+            }
+        }
+    };
+}
+
+#endif // ENGINE_SOURCES_JOBS_FILE_SEQUENTIAL_EXECUTOR_H
@@ -7,6 +7,7 @@
 #include <climits>
 #include <concepts>
 #include <cstddef>
+#include <numeric>
 
 namespace egg::Memory
 {
@@ -16,6 +17,12 @@ namespace egg::Memory
     template <typename Type>
     inline constexpr std::size_t PageSize { PageSizeInBytes / std::bit_ceil(sizeof(Type)) };
 
+    inline constexpr std::size_t CacheLineSize { 64u };
+    static_assert(std::has_single_bit(CacheLineSize), "Cache line size must be a power of two");
+
+    template <typename Type>
+    inline constexpr std::size_t CacheLineAlignedCount { CacheLineSize / std::gcd(CacheLineSize, sizeof(Type)) };
+
     inline constexpr std::size_t ByteMultiplier { CHAR_BIT };
     static_assert(std::has_single_bit(ByteMultiplier), "The number of bits in a byte must be a power of two");
 
@@ -0,0 +1,68 @@
+#ifndef ENGINE_SOURCES_MEMORY_FRAME_ARENA_FILE_ARENA_ALLOCATOR_H
+#define ENGINE_SOURCES_MEMORY_FRAME_ARENA_FILE_ARENA_ALLOCATOR_H
+
+#include <Memory/FrameArena/FrameArena.h>
+
+#include <cstddef>
+#include <limits>
+#include <new>
+#include <type_traits>
+
+namespace egg::Memory
+{
+    template <typename Type>
+    class ArenaAllocator
+    {
+    public:
+        using value_type = Type;
+        using propagate_on_container_copy_assignment = std::true_type;
+        using propagate_on_container_move_assignment = std::true_type;
+        using propagate_on_container_swap = std::true_type;
+        using is_always_equal = std::false_type;
+
+
+        ArenaAllocator() noexcept : Arena { &FrameArena::GetThreadArena() }
+        {
+        }
+
+        constexpr explicit ArenaAllocator(FrameArena& Arena) noexcept : Arena { &Arena }
+        {
+        }
+
+        template <typename OtherType>
+        constexpr ArenaAllocator(const ArenaAllocator<OtherType>& Other) noexcept : Arena { Other.GetArena() }
+        {
+        }
+
+        [[nodiscard]] Type* allocate(const std::size_t Count)
+        {
+            if (Count > std::numeric_limits<std::size_t>::max() / sizeof(Type))
+            {
+                throw std::bad_array_new_length {};
+            }
+
+            return static_cast<Type*>(Arena->Allocate(Count * sizeof(Type), alignof(Type)));
+        }
+
+        void deallocate(Type* const Pointer, const std::size_t Count) noexcept
+        {
+            Arena->Deallocate(Pointer, Count * sizeof(Type));
+        }
+
+        [[nodiscard]] constexpr FrameArena* GetArena() const noexcept
+        {
+            return Arena;
+        }
+
+        template <typename OtherType>
+        [[nodiscard]] constexpr bool operator==(const ArenaAllocator<OtherType>& Right) const noexcept
+        {
+            return Arena == Right.GetArena();
+        }
+
+    private:
+        FrameArena* Arena;
+    };
+}
+
+#endif // ENGINE_SOURCES_MEMORY_FRAME_ARENA_FILE_ARENA_ALLOCATOR_H
@@ -0,0 +1,128 @@
+#include "./FrameArena.h"
+
+#include <Memory/Constants.h>
+
+#include <algorithm>
+#include <new>
+#include <utility>
+
+namespace egg::Memory
+{
+    struct FrameArena::Block
+    {
+        Block* Previous;
+        std::size_t Size;
+    };
+
+    namespace
+    {
+        constexpr std::size_t HeaderSize { (sizeof(void*) + sizeof(std::size_t) + CacheLineSize - 1u) & ~(CacheLineSize - 1u) };
+    }
+
+    FrameArena::FrameArena(const std::size_t BlockSize) noexcept
+        : Current {},
+          Cursor {},
+          End {},
+          BlockSize { std::max(BlockSize, HeaderSize + CacheLineSize) },
+          Used {},
+          Capacity {}
+    {
+    }
+
+    FrameArena::FrameArena(FrameArena&& Other) noexcept
+        : Current { std::exchange(Other.Current, nullptr) },
+          Cursor { std::exchange(Other.Cursor, nullptr) },
+          End { std::exchange(Other.End, nullptr) },
+          BlockSize { Other.BlockSize },
+          Used { std::exchange(Other.Used, 0u) },
+          Capacity { std::exchange(Other.Capacity, 0u) }
+    {
+    }
+
+    FrameArena::~FrameArena() noexcept
+    {
+        Release();
+    }
+
+    FrameArena& FrameArena::operator=(FrameArena&& Other) noexcept
+    {
+        if (this != &Other)
+        {
+            Release();
+            Current = std::exchange(Other.Current, nullptr);
+            Cursor = std::exchange(Other.Cursor, nullptr);
+            End = std::exchange(Other.End, nullptr);
+            BlockSize = Other.BlockSize;
+            Used = std::exchange(Other.Used, 0u);
+            Capacity = std::exchange(Other.Capacity, 0u);
+        }
+
+        return *this;
+    }
+
+    void FrameArena::Reset() noexcept
+    {
+        Used = 0u;
+
+        if (Current && Current->Previous)
+        {
+            BlockSize = std::bit_ceil(Capacity);
+            Release();
+            return;
+        }
+
+        if (Current)
+        {
+            Cursor = reinterpret_cast<std::byte*>(Current) + HeaderSize;
+        }
+    }
+
+    std::size_t FrameArena::GetBlocksCount() const noexcept
+    {
+        std::size_t Count {};
+
+        for (const Block* Target { Current }; Target; Target = Target->Previous)
+        {
+            ++Count;
+        }
+
+        return Count;
+    }
+
+    FrameArena& FrameArena::GetThreadArena() noexcept
+    {
+        thread_local FrameArena Arena {};
+        return Arena;
+    }
+
+    void* FrameArena::AllocateSlow(const std::size_t Size, const std::size_t Alignment)
+    {
+        const std::size_t Required { HeaderSize + Size + std::max(Alignment, CacheLineSize) };
+        const std::size_t Granted { std::max(BlockSize, std::bit_ceil(Required)) };
+
+        Block* const Fresh { static_cast<Block*>(::operator new(Granted, std::align_val_t { CacheLineSize })) };
+        Fresh->Previous = Current;
+        Fresh->Size = Granted;
+
+        Current = Fresh;
+        Cursor = reinterpret_cast<std::byte*>(Fresh) + HeaderSize;
+        End = reinterpret_cast<std::byte*>(Fresh) + Granted;
+        Capacity += Granted;
+
+        return Allocate(Size, Alignment);
+    }
+
+    void FrameArena::Release() noexcept
+    {
+        while (Current)
+        {
+            Block* const Previous { Current->Previous };
+            ::operator delete(Current, Current->Size, std::align_val_t { CacheLineSize });
+            Current = Previous;
+        }
+
+        Cursor = nullptr;
+        End = nullptr;
+        Capacity = 0u;
+    }
+}
@@ -0,0 +1,88 @@
+#ifndef ENGINE_SOURCES_MEMORY_FRAME_ARENA_FILE_FRAME_ARENA_H
+#define ENGINE_SOURCES_MEMORY_FRAME_ARENA_FILE_FRAME_ARENA_H
+
+#include <Config/Config.h>
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+
+namespace egg::Memory
+{
+    class FrameArena final
+    {
+    public:
+        static constexpr std::size_t DefaultBlockSize { 64u * 1024u };
+
+
+        explicit FrameArena(std::size_t BlockSize = DefaultBlockSize) noexcept;
+
+        FrameArena(const FrameArena&) = delete;
+
+        FrameArena(FrameArena&& Other) noexcept;
+
+        ~FrameArena() noexcept;
+
+        FrameArena& operator=(const FrameArena&) = delete;
+
+        FrameArena& operator=(FrameArena&& Other) noexcept;
+
+        [[nodiscard]] void* Allocate(const std::size_t Size, const std::size_t Alignment)
+        {
+            EGG_ASSERT(std::has_single_bit(Alignment), "Alignment must be a power of two");
+
+            const std::uintptr_t Address { (reinterpret_cast<std::uintptr_t>(Cursor) + Alignment - 1u) & ~(Alignment - 1u) };
+
+            if (!Cursor || Address + Size > reinterpret_cast<std::uintptr_t>(End))
+            {
+                return AllocateSlow(Size, Alignment);
+            }
+
+            std::byte* const Result { reinterpret_cast<std::byte*>(Address) };
+            Used += Size;
+            Cursor = Result + Size;
+            return Result;
+        }
+
+        void Deallocate(void* const Pointer, const std::size_t Size) noexcept
+        {
+            if (static_cast<std::byte*>(Pointer) + Size == Cursor)
+            {
+                Cursor = static_cast<std::byte*>(Pointer);
+                Used -= Size;
+            }
+        }
+
+        void Reset() noexcept;
+
+        [[nodiscard]] std::size_t GetUsed() const noexcept
+        {
+            return Used;
+        }
+
+        [[nodiscard]] std::size_t GetCapacity() const noexcept
+        {
+            return Capacity;
+        }
+
+        [[nodiscard]] std::size_t GetBlocksCount() const noexcept;
+
+        [[nodiscard]] static FrameArena& GetThreadArena() noexcept;
+
+    private:
+        struct Block;
+
+        [[nodiscard]] void* AllocateSlow(std::size_t Size, std::size_t Alignment);
+
+        void Release() noexcept;
+
+        Block* Current;
+        std::byte* Cursor;
+        std::byte* End;
+        std::size_t BlockSize;
+        std::size_t Used;
+        std::size_t Capacity;
+    };
+}
+
+#endif // ENGINE_SOURCES_MEMORY_FRAME_ARENA_FILE_FRAME_ARENA_H
@@ -0,0 +1,131 @@
+#include "./MappedFile.h"
+
+#include <stdexcept>
+#include <utility>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace egg::Memory
+{
+    MappedFile::MappedFile(const std::filesystem::path& Path) : Data {}, Size {}
+    {
+#ifdef _WIN32
+        const HANDLE File { CreateFileW(Path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr) };
+
+        if (File == INVALID_HANDLE_VALUE)
+        {
+            throw std::runtime_error("Failed to open mapped file");
+        }
+
+        LARGE_INTEGER FileSize {};
+
+        if (!GetFileSizeEx(File, &FileSize))
+        {
+            CloseHandle(File);
+            throw std::runtime_error("Failed to query mapped file size");
+        }
+
+        Size = static_cast<std::size_t>(FileSize.QuadPart);
+
+        if (Size)
+        {
+            const HANDLE Mapping { CreateFileMappingW(File, nullptr, PAGE_WRITECOPY, 0u, 0u, nullptr) };
+            CloseHandle(File);
+
+            if (!Mapping)
+            {
+                throw std::runtime_error("Failed to map file");
+            }
+
+            Data = MapViewOfFile(Mapping, FILE_MAP_COPY, 0u, 0u, 0u);
+            CloseHandle(Mapping);
+
+            if (!Data)
+            {
+                throw std::runtime_error("Failed to map file");
+            }
+        }
+        else
+        {
+            CloseHandle(File);
+        }
+#else
+        const int File { open(Path.c_str(), O_RDONLY | O_CLOEXEC) };
+
+        if (File < 0)
+        {
+            throw std::runtime_error("Failed to open mapped file");
+        }
+
+        struct stat Status {};
+
+        if (fstat(File, &Status))
+        {
+            close(File);
+            throw std::runtime_error("Failed to query mapped file size");
+        }
+
+        Size = static_cast<std::size_t>(Status.st_size);
+
+        if (Size)
+        {
+            Data = mmap(nullptr, Size, PROT_READ | PROT_WRITE, MAP_PRIVATE, File, 0);
+
+            if (Data == MAP_FAILED)
+            {
+                Data = nullptr;
+                close(File);
+                throw std::runtime_error("Failed to map file");
+            }
+        }
+
+        close(File);
+#endif
+    }
+
+    MappedFile::MappedFile(MappedFile&& Other) noexcept
+        : Data { std::exchange(Other.Data, nullptr) },
+          Size { std::exchange(Other.Size, 0u) }
+    {
+    }
+
+    MappedFile::~MappedFile() noexcept
+    {
+        Release();
+    }
+
+    MappedFile& MappedFile::operator=(MappedFile&& Other) noexcept
+    {
+        if (this != &Other)
+        {
+            Release();
+            Data = std::exchange(Other.Data, nullptr);
+            Size = std::exchange(Other.Size, 0u);
+        }
+
+        return *this;
+    }
+
+    void MappedFile::Release() noexcept
+    {
+        if (!Data) return;
+
+#ifdef _WIN32
+        UnmapViewOfFile(Data);
+#else
+        munmap(Data, Size);
+#endif
+
+        Data = nullptr;
+        Size = 0u;
+    }
+}
@@ -0,0 +1,43 @@
+#ifndef ENGINE_SOURCES_MEMORY_MAPPED_FILE_FILE_MAPPED_FILE_H
+#define ENGINE_SOURCES_MEMORY_MAPPED_FILE_FILE_MAPPED_FILE_H
+
+#include <cstddef>
+#include <filesystem>
+#include <span>
+
+namespace egg::Memory
+{
+    class MappedFile final
+    {
+    public:
+        explicit MappedFile(const std::filesystem::path& Path);
+
+        MappedFile(const MappedFile&) = delete;
+
+        MappedFile(MappedFile&& Other) noexcept;
+
+        ~MappedFile() noexcept;
+
+        MappedFile& operator=(const MappedFile&) = delete;
+
+        MappedFile& operator=(MappedFile&& Other) noexcept;
+
+        [[nodiscard]] std::span<std::byte> GetData() const noexcept
+        {
+            return { static_cast<std::byte*>(Data), Size };
+        }
+
+        [[nodiscard]] std::size_t GetSize() const noexcept
+        {
+            return Size;
+        }
+
+    private:
+        void Release() noexcept;
+
+        void* Data;
+        std::size_t Size;
+    };
+}
+
+#endif // ENGINE_SOURCES_MEMORY_MAPPED_FILE_FILE_MAPPED_FILE_H
@@ -0,0 +1,112 @@
+#include "./PagePool.h"
+
+#include <new>
+#include <utility>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#endif
+
+namespace egg::Memory
+{
+    PagePool::PagePool(const Backing Mode) noexcept
+        : Free {},
+          Last {},
+          Cursor {},
+          End {},
+          Held {},
+          InUse {},
+          Acquired {},
+          Reused {},
+          Mode { Mode }
+    {
+    }
+
+    PagePool::~PagePool() noexcept
+    {
+        const std::size_t SlabSize { GetSlabSize() };
+
+        for (std::byte* const Slab : Slabs)
+        {
+            ::operator delete(Slab, SlabSize, std::align_val_t { SlabSize });
+        }
+    }
+
+    void* PagePool::Allocate()
+    {
+        const std::scoped_lock Lock { Mutex };
+        ++Acquired;
+        ++InUse;
+
+        if (Free)
+        {
+            ++Reused;
+
+            if (Free == Last)
+            {
+                Last = nullptr;
+            }
+
+            return std::exchange(Free, Free->Next);
+        }
+
+        if (Cursor + BlockSize > End)
+        {
+            try
+            {
+                Grow();
+            }
+            catch (...)
+            {
+                --Acquired;
+                --InUse;
+                throw;
+            }
+        }
+
+        ++Held;
+        return std::exchange(Cursor, Cursor + BlockSize);
+    }
+
+    void PagePool::Deallocate(void* const Pointer) noexcept
+    {
+        if (!Pointer) return;
+
+        const std::scoped_lock Lock { Mutex };
+        FreeBlock* const Released { ::new (Pointer) FreeBlock { nullptr } };
+        (Last ? Last->Next : Free) = Released;
+        Last = Released;
+        --InUse;
+    }
+
+    PagePoolStatistics PagePool::GetStatistics() const
+    {
+        const std::scoped_lock Lock { Mutex };
+        return { Slabs.size() * GetSlabSize(), Held, InUse, Acquired, Reused };
+    }
+
+    PagePool& PagePool::GetDefault() noexcept
+    {
+        static PagePool* const Pool { new PagePool {} };
+        return *Pool;
+    }
+
+    void PagePool::Grow()
+    {
+        const std::size_t SlabSize { GetSlabSize() };
+        Slabs.reserve(Slabs.size() + 1u);
+
+        std::byte* const Slab { static_cast<std::byte*>(::operator new(SlabSize, std::align_val_t { SlabSize })) };
+
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+        if (Mode == Backing::Huge)
+        {
+            ::madvise(Slab, SlabSize, MADV_HUGEPAGE);
+        }
+#endif
+
+        Slabs.push_back(Slab);
+        Cursor = Slab;
+        End = Slab + SlabSize;
+    }
+}
@@ -0,0 +1,97 @@
+#ifndef ENGINE_SOURCES_MEMORY_PAGE_POOL_FILE_PAGE_POOL_H
+#define ENGINE_SOURCES_MEMORY_PAGE_POOL_FILE_PAGE_POOL_H
+
+#include <Memory/Constants.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+namespace egg::Memory
+{
+    struct PagePoolStatistics
+    {
+        std::size_t Reserved;
+        std::size_t Held;
+        std::size_t InUse;
+        std::size_t Acquired;
+        std::size_t Reused;
+    };
+
+
+    class PagePool final
+    {
+    public:
+        enum class Backing : std::uint8_t
+        {
+            Regular,
+            Huge
+        };
+
+        static constexpr std::size_t BlockSize { PageSizeInBytes };
+        static constexpr std::size_t BlockAlignment { CacheLineSize };
+        static constexpr std::size_t RegularSlabSize { 256u * 1024u };
+        static constexpr std::size_t HugeSlabSize { 2u * 1024u * 1024u };
+
+
+        explicit PagePool(Backing Mode = Backing::Regular) noexcept;
+
+        PagePool(const PagePool&) = delete;
+
+        PagePool(PagePool&&) = delete;
+
+        ~PagePool() noexcept;
+
+        PagePool& operator=(const PagePool&) = delete;
+
+        PagePool& operator=(PagePool&&) = delete;
+
+        [[nodiscard]] void* Allocate();
+
+        void Deallocate(void* Pointer) noexcept;
+
+        [[nodiscard]] PagePoolStatistics GetStatistics() const;
+
+        [[nodiscard]] Backing GetBacking() const noexcept
+        {
+            return Mode;
+        }
+
+        [[nodiscard]] static constexpr bool Fits(const std::size_t Size, const std::size_t Alignment) noexcept
+        {
+            return Size > BlockSize / 2u && Size <= BlockSize && Alignment <= BlockAlignment;
+        }
+
+        //Never destroyed, so containers with static storage duration can still release their pages at exit
+        [[nodiscard]] static PagePool& GetDefault() noexcept;
+
+    private:
+        //Lives inside a released block, so live blocks carry no header and slabs are packed at BlockSize
+        struct FreeBlock
+        {
+            FreeBlock* Next;
+        };
+
+        [[nodiscard]] std::size_t GetSlabSize() const noexcept
+        {
+            return Mode == Backing::Huge ? HugeSlabSize : RegularSlabSize;
+        }
+
+        void Grow();
+
+        mutable std::mutex Mutex;
+        std::vector<std::byte*> Slabs;
+        FreeBlock* Free;
+        FreeBlock* Last;
+        std::byte* Cursor;
+        std::byte* End;
+        std::size_t Held;
+        std::size_t InUse;
+        std::size_t Acquired;
+        std::size_t Reused;
+        const Backing Mode;
+    };
+}
+
+#endif // ENGINE_SOURCES_MEMORY_PAGE_POOL_FILE_PAGE_POOL_H
@@ -0,0 +1,80 @@
+#ifndef ENGINE_SOURCES_MEMORY_PAGE_POOL_FILE_PAGE_POOL_ALLOCATOR_H
+#define ENGINE_SOURCES_MEMORY_PAGE_POOL_FILE_PAGE_POOL_ALLOCATOR_H
+
+#include <Memory/PagePool/PagePool.h>
+
+#include <cstddef>
+#include <limits>
+#include <memory>
+#include <new>
+#include <type_traits>
+
+namespace egg::Memory
+{
+    template <typename Type>
+    class PagePoolAllocator
+    {
+    public:
+        using value_type = Type;
+        using propagate_on_container_copy_assignment = std::true_type;
+        using propagate_on_container_move_assignment = std::true_type;
+        using propagate_on_container_swap = std::true_type;
+        using is_always_equal = std::false_type;
+
+
+        PagePoolAllocator() noexcept : Pool { &PagePool::GetDefault() }
+        {
+        }
+
+        constexpr explicit PagePoolAllocator(PagePool& Pool) noexcept : Pool { &Pool }
+        {
+        }
+
+        template <typename OtherType>
+        constexpr PagePoolAllocator(const PagePoolAllocator<OtherType>& Other) noexcept : Pool { Other.GetPool() }
+        {
+        }
+
+        [[nodiscard]] Type* allocate(const std::size_t Count)
+        {
+            if (Count > std::numeric_limits<std::size_t>::max() / sizeof(Type))
+            {
+                throw std::bad_array_new_length {};
+            }
+
+            if (PagePool::Fits(Count * sizeof(Type), alignof(Type)))
+            {
+                return static_cast<Type*>(Pool->Allocate());
+            }
+
+            return std::allocator<Type> {}.allocate(Count);
+        }
+
+        void deallocate(Type* const Pointer, const std::size_t Count) noexcept
+        {
+            if (PagePool::Fits(Count * sizeof(Type), alignof(Type)))
+            {
+                Pool->Deallocate(Pointer);
+                return;
+            }
+
+            std::allocator<Type> {}.deallocate(Pointer, Count);
+        }
+
+        [[nodiscard]] constexpr PagePool* GetPool() const noexcept
+        {
+            return Pool;
+        }
+
+        template <typename OtherType>
+        [[nodiscard]] constexpr bool operator==(const PagePoolAllocator<OtherType>& Right) const noexcept
+        {
+            return Pool == Right.GetPool();
+        }
+
+    private:
+        PagePool* Pool;
+    };
+}
+
+#endif // ENGINE_SOURCES_MEMORY_PAGE_POOL_FILE_PAGE_POOL_ALLOCATOR_H
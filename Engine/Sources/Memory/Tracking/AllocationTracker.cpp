@@ -0,0 +1,46 @@
+#include "./AllocationTracker.h"
+
+namespace egg::Memory
+{
+    AllocationTracker::AllocationTracker() noexcept
+        : Allocations {},
+          Deallocations {},
+          LiveBytes {},
+          PeakBytes {},
+          FrameAllocations {},
+          LastFrameAllocations {}
+    {
+    }
+
+    void AllocationTracker::NextFrame() noexcept
+    {
+        LastFrameAllocations.store(FrameAllocations.exchange(0u, std::memory_order_relaxed), std::memory_order_relaxed);
+    }
+
+    void AllocationTracker::Reset() noexcept
+    {
+        Allocations.store(0u, std::memory_order_relaxed);
+        Deallocations.store(0u, std::memory_order_relaxed);
+        PeakBytes.store(LiveBytes.load(std::memory_order_relaxed), std::memory_order_relaxed);
+        FrameAllocations.store(0u, std::memory_order_relaxed);
+        LastFrameAllocations.store(0u, std::memory_order_relaxed);
+    }
+
+    AllocationStatistics AllocationTracker::GetStatistics() const noexcept
+    {
+        return {
+            Allocations.load(std::memory_order_relaxed),
+            Deallocations.load(std::memory_order_relaxed),
+            LiveBytes.load(std::memory_order_relaxed),
+            PeakBytes.load(std::memory_order_relaxed),
+            FrameAllocations.load(std::memory_order_relaxed),
+            LastFrameAllocations.load(std::memory_order_relaxed)
+        };
+    }
+
+    AllocationTracker& AllocationTracker::GetDefault() noexcept
+    {
+        static AllocationTracker Tracker {};
+        return Tracker;
+    }
+}
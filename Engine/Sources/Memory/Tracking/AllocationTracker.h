@@ -0,0 +1,72 @@
+#ifndef ENGINE_SOURCES_MEMORY_TRACKING_FILE_ALLOCATION_TRACKER_H
+#define ENGINE_SOURCES_MEMORY_TRACKING_FILE_ALLOCATION_TRACKER_H
+
+#include <atomic>
+#include <cstddef>
+
+namespace egg::Memory
+{
+    struct AllocationStatistics
+    {
+        std::size_t Allocations;
+        std::size_t Deallocations;
+        std::size_t LiveBytes;
+        std::size_t PeakBytes;
+        std::size_t FrameAllocations;
+        std::size_t LastFrameAllocations;
+    };
+
+
+    class AllocationTracker final
+    {
+    public:
+        AllocationTracker() noexcept;
+
+        AllocationTracker(const AllocationTracker&) = delete;
+
+        AllocationTracker(AllocationTracker&&) = delete;
+
+        ~AllocationTracker() noexcept = default;
+
+        AllocationTracker& operator=(const AllocationTracker&) = delete;
+
+        AllocationTracker& operator=(AllocationTracker&&) = delete;
+
+        void RecordAllocation(const std::size_t Bytes) noexcept
+        {
+            Allocations.fetch_add(1u, std::memory_order_relaxed);
+            FrameAllocations.fetch_add(1u, std::memory_order_relaxed);
+
+            const std::size_t Live { LiveBytes.fetch_add(Bytes, std::memory_order_relaxed) + Bytes };
+
+            for (std::size_t Peak { PeakBytes.load(std::memory_order_relaxed) };
+                 Peak < Live && !PeakBytes.compare_exchange_weak(Peak, Live, std::memory_order_relaxed);)
+            {
+            }
+        }
+
+        void RecordDeallocation(const std::size_t Bytes) noexcept
+        {
+            Deallocations.fetch_add(1u, std::memory_order_relaxed);
+            LiveBytes.fetch_sub(Bytes, std::memory_order_relaxed);
+        }
+
+        void NextFrame() noexcept;
+
+        void Reset() noexcept;
+
+        [[nodiscard]] AllocationStatistics GetStatistics() const noexcept;
+
+        [[nodiscard]] static AllocationTracker& GetDefault() noexcept;
+
+    private:
+        std::atomic<std::size_t> Allocations;
+        std::atomic<std::size_t> Deallocations;
+        std::atomic<std::size_t> LiveBytes;
+        std::atomic<std::size_t> PeakBytes;
+        std::atomic<std::size_t> FrameAllocations;
+        std::atomic<std::size_t> LastFrameAllocations;
+    };
+}
+
+#endif // ENGINE_SOURCES_MEMORY_TRACKING_FILE_ALLOCATION_TRACKER_H
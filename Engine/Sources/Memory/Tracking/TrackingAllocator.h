@@ -0,0 +1,85 @@
+#ifndef ENGINE_SOURCES_MEMORY_TRACKING_FILE_TRACKING_ALLOCATOR_H
+#define ENGINE_SOURCES_MEMORY_TRACKING_FILE_TRACKING_ALLOCATOR_H
+
+#include <Memory/Tracking/AllocationTracker.h>
+
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+
+namespace egg::Memory
+{
+    template <typename Type, typename UpstreamParameter = std::allocator<Type>>
+    class TrackingAllocator
+    {
+        using UpstreamTraits = std::allocator_traits<UpstreamParameter>;
+
+        static_assert(std::is_same_v<typename UpstreamTraits::value_type, Type>, "Upstream allocator must allocate the tracked type");
+
+    public:
+        using value_type = Type;
+        using UpstreamType = UpstreamParameter;
+        using propagate_on_container_copy_assignment = std::true_type;
+        using propagate_on_container_move_assignment = std::true_type;
+        using propagate_on_container_swap = std::true_type;
+        using is_always_equal = std::false_type;
+
+        template <typename OtherType>
+        struct rebind
+        {
+            using other = TrackingAllocator<OtherType, typename UpstreamTraits::template rebind_alloc<OtherType>>;
+        };
+
+
+        TrackingAllocator() noexcept(std::is_nothrow_default_constructible_v<UpstreamType>)
+            : Upstream {}, Tracker { &AllocationTracker::GetDefault() }
+        {
+        }
+
+        constexpr explicit TrackingAllocator(AllocationTracker& Tracker, const UpstreamType& Upstream = {}) noexcept
+            : Upstream { Upstream }, Tracker { &Tracker }
+        {
+        }
+
+        template <typename OtherType, typename OtherUpstream>
+        constexpr TrackingAllocator(const TrackingAllocator<OtherType, OtherUpstream>& Other) noexcept
+            : Upstream { Other.GetUpstream() }, Tracker { Other.GetTracker() }
+        {
+        }
+
+        [[nodiscard]] Type* allocate(const std::size_t Count)
+        {
+            Type* const Result { std::to_address(UpstreamTraits::allocate(Upstream, Count)) };
+            Tracker->RecordAllocation(Count * sizeof(Type));
+            return Result;
+        }
+
+        void deallocate(Type* const Pointer, const std::size_t Count) noexcept
+        {
+            Tracker->RecordDeallocation(Count * sizeof(Type));
+            UpstreamTraits::deallocate(Upstream, Pointer, Count);
+        }
+
+        [[nodiscard]] constexpr const UpstreamType& GetUpstream() const noexcept
+        {
+            return Upstream;
+        }
+
+        [[nodiscard]] constexpr AllocationTracker* GetTracker() const noexcept
+        {
+            return Tracker;
+        }
+
+        template <typename OtherType, typename OtherUpstream>
+        [[nodiscard]] constexpr bool operator==(const TrackingAllocator<OtherType, OtherUpstream>& Right) const noexcept
+        {
+            return Tracker == Right.GetTracker() && Upstream == Right.GetUpstream();
+        }
+
+    private:
+        [[no_unique_address]] UpstreamType Upstream;
+        AllocationTracker* Tracker;
+    };
+}
+
+#endif // ENGINE_SOURCES_MEMORY_TRACKING_FILE_TRACKING_ALLOCATOR_H
@@ -1,6 +1,8 @@
 #ifndef ENGINE_SOURCES_TYPES_DEDUCTION_INTERNAL_FILE_REMOVE_ELEMENT_H
 #define ENGINE_SOURCES_TYPES_DEDUCTION_INTERNAL_FILE_REMOVE_ELEMENT_H
 
+#include "./CombineTuples.h"
+
 #include <tuple>
 #include <type_traits>
 
@@ -22,7 +24,7 @@ namespace egg::Types::Internal
 
     template <typename Type, template<typename...> typename Tuple, typename Other, typename... Types>
     struct RemoveTupleType<Type, Tuple<Other, Types...>>
-        : CombineTuples<Tuple, Tuple<Other>, typename RemoveTupleType<Type, Types...>::type>
+        : CombineTuples<Tuple, Tuple<Other>, typename RemoveTupleType<Type, Tuple<Types...>>::type>
     {
     };
 }
@@ -0,0 +1,53 @@
+#include <Containers/Algorithms/ParallelSort.h>
+#include <gtest/gtest.h>
+#include <Jobs/JobPool/JobPool.h>
+#include <Jobs/SequentialExecutor.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <random>
+#include <vector>
+
+namespace
+{
+    std::vector<std::uint32_t> GetRandomValues(const std::size_t Count)
+    {
+        std::mt19937 Generator { static_cast<std::uint32_t>(Count) };
+        std::vector<std::uint32_t> Values(Count);
+        std::ranges::generate(Values, [&Generator] { return static_cast<std::uint32_t>(Generator() % 1'000u); });
+        return Values;
+    }
+}
+
+TEST(ParallelSortTest, SequentialExecutor)
+{
+    constexpr egg::Jobs::SequentialExecutor Executor {};
+
+    for (const std::size_t Count : { std::size_t { 0u }, std::size_t { 1u }, std::size_t { 1'000u }, egg::Containers::ParallelSortThreshold * 2u })
+    {
+        std::vector Values { GetRandomValues(Count) };
+        egg::Containers::ParallelSort { Executor }(Values.begin(), Values.end());
+        EXPECT_TRUE(std::ranges::is_sorted(Values));
+    }
+}
+
+TEST(ParallelSortTest, JobPool)
+{
+    egg::Jobs::JobPool Pool { 3u };
+
+    for (const std::size_t Count : { egg::Containers::ParallelSortThreshold, egg::Containers::ParallelSortThreshold * 5u + 3u })
+    {
+        std::vector Values { GetRandomValues(Count) };
+        std::vector Expected { Values };
+        std::ranges::sort(Expected, std::ranges::greater {});
+
+        egg::Containers::ParallelSort { Pool }(Values.rbegin(), Values.rend(), std::ranges::less {}, [](const std::uint32_t Value)
+        {
+            return Value;
+        });
+
+        EXPECT_EQ(Values, Expected);
+    }
+}
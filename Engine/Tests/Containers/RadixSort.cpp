@@ -0,0 +1,87 @@
+#include <Containers/Algorithms/RadixSort.h>
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <random>
+#include <utility>
+#include <vector>
+
+namespace
+{
+    template <typename Type>
+    std::vector<Type> GetRandomValues(const std::size_t Count, const Type Min, const Type Max)
+    {
+        std::mt19937_64 Generator { Count };
+        std::vector<Type> Values(Count);
+
+        if constexpr (std::floating_point<Type>)
+        {
+            std::ranges::generate(Values, [&] { return std::uniform_real_distribution<Type> { Min, Max }(Generator); });
+        }
+        else
+        {
+            std::ranges::generate(Values, [&] { return std::uniform_int_distribution<Type> { Min, Max }(Generator); });
+        }
+
+        return Values;
+    }
+}
+
+TEST(RadixSortTest, Unsigned)
+{
+    for (const std::size_t Count : { 0u, 1u, 100u, 10'000u })
+    {
+        std::vector Values { GetRandomValues<std::uint64_t>(Count, 0u, std::numeric_limits<std::uint64_t>::max()) };
+        std::vector Expected { Values };
+
+        egg::Containers::RadixSort(Values.begin(), Values.end());
+        std::ranges::sort(Expected);
+
+        EXPECT_EQ(Values, Expected);
+    }
+}
+
+TEST(RadixSortTest, SignedDescending)
+{
+    std::vector Values { GetRandomValues<std::int32_t>(10'000u, -1'000, 1'000) };
+    std::vector Expected { Values };
+
+    egg::Containers::RadixSort(Values.begin(), Values.end(), std::greater {});
+    std::ranges::sort(Expected, std::greater {});
+
+    EXPECT_EQ(Values, Expected);
+}
+
+TEST(RadixSortTest, Floating)
+{
+    std::vector Values { GetRandomValues<double>(10'000u, -1e6, 1e6) };
+    Values.insert(Values.end(), { -0.0, 0.0, std::numeric_limits<double>::infinity(), -std::numeric_limits<double>::infinity() });
+    std::vector Expected { Values };
+
+    egg::Containers::RadixSort(Values.rbegin(), Values.rend(), std::ranges::less {});
+    std::ranges::sort(Expected.rbegin(), Expected.rend());
+
+    EXPECT_EQ(Values, Expected);
+}
+
+TEST(RadixSortTest, ProjectionIsStable)
+{
+    std::vector<std::pair<std::uint16_t, std::size_t>> Values;
+    const std::vector Keys { GetRandomValues<std::uint16_t>(5'000u, 0u, 31u) };
+
+    for (std::size_t i = 0u; i < Keys.size(); ++i)
+    {
+        Values.emplace_back(Keys[i], i);
+    }
+
+    std::vector Expected { Values };
+
+    egg::Containers::RadixSort(Values.begin(), Values.end(), std::less {}, &std::pair<std::uint16_t, std::size_t>::first);
+    std::ranges::stable_sort(Expected, {}, &std::pair<std::uint16_t, std::size_t>::first);
+
+    EXPECT_EQ(Values, Expected);
+}
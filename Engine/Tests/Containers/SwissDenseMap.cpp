@@ -0,0 +1,172 @@
+#include "../Single.h"
+
+#include <Containers/DenseMap/SwissDenseMap.h>
+#include <gtest/gtest.h>
+
+#include <random>
+#include <ranges>
+#include <unordered_map>
+
+class SwissDenseMapTest : public testing::Test
+{
+protected:
+    using KeyType = std::size_t;
+    using ValueType = EntityType;
+    using Hash = std::identity;
+    using KeyEqual = std::equal_to<>;
+    using Allocator = std::allocator<std::pair<const KeyType, ValueType>>;
+    using ConvertableToKey = unsigned long long;
+
+    using SwissDenseMapType = egg::Containers::SwissDenseMap<KeyType, ValueType, Hash, KeyEqual, Allocator>;
+
+    SwissDenseMapTest()
+    {
+        SwissDenseMap.Reserve(IterationsCount);
+        for (std::size_t i = 0u; i < IterationsCount; ++i)
+        {
+            SwissDenseMap.Emplace(i, GetEntityAt(i));
+        }
+    }
+
+    SwissDenseMapType SwissDenseMap;
+};
+
+TEST_F(SwissDenseMapTest, Insert)
+{
+    for (std::size_t i = 0u; i < IterationsCount; ++i)
+    {
+        auto [It, IsInserted] { SwissDenseMap.Insert(std::pair { i, GetEntityAt(i) }) };
+        EXPECT_FALSE(IsInserted);
+    }
+
+    for (std::size_t i = IterationsCount; i < IterationsCount * 2u; ++i)
+    {
+        auto [It, IsInserted] { SwissDenseMap.Insert(std::pair { i, GetEntityAt(i) }) };
+        ASSERT_TRUE(IsInserted);
+        EXPECT_EQ(It, SwissDenseMap.Find(i));
+        EXPECT_EQ(It->first, i);
+        EXPECT_EQ(It->second, GetEntityAt(i));
+    }
+
+    EXPECT_EQ(SwissDenseMap.GetSize(), IterationsCount * 2u);
+}
+
+TEST_F(SwissDenseMapTest, Emplace)
+{
+    for (std::size_t i = 0u; i < IterationsCount; ++i)
+    {
+        auto [It, IsInserted] { SwissDenseMap.Emplace(std::piecewise_construct, std::make_tuple(i), std::make_tuple(GetEntityAt(i))) };
+        EXPECT_FALSE(IsInserted);
+    }
+
+    for (std::size_t i = IterationsCount; i < IterationsCount * 2u; ++i)
+    {
+        auto [It, IsInserted] { SwissDenseMap.Emplace(std::piecewise_construct, std::make_tuple(i), std::make_tuple(GetEntityAt(i))) };
+        ASSERT_TRUE(IsInserted);
+        EXPECT_EQ(It, SwissDenseMap.Find(i));
+        EXPECT_EQ(It->second, GetEntityAt(i));
+    }
+
+    EXPECT_EQ(SwissDenseMap.GetSize(), IterationsCount * 2u);
+}
+
+TEST_F(SwissDenseMapTest, InsertOrAssign)
+{
+    for (std::size_t i = 0u; i < IterationsCount; ++i)
+    {
+        auto [It, IsInserted] { SwissDenseMap.InsertOrAssign(i, GetEntityAtReversed(i)) };
+        EXPECT_FALSE(IsInserted);
+        EXPECT_EQ(It->second, GetEntityAtReversed(i));
+    }
+}
+
+TEST_F(SwissDenseMapTest, Erase)
+{
+    EXPECT_FALSE(SwissDenseMap.Erase(IterationsCount));
+
+    for (std::size_t i = 0u; i < IterationsCount; ++i)
+    {
+        EXPECT_TRUE(SwissDenseMap.Erase(i));
+        EXPECT_FALSE(SwissDenseMap.Contains(i));
+
+        for (std::size_t j = i + 1u; j < IterationsCount; ++j)
+        {
+            EXPECT_EQ(SwissDenseMap.At(j), GetEntityAt(j));
+        }
+    }
+
+    EXPECT_TRUE(SwissDenseMap.Empty());
+}
+
+TEST_F(SwissDenseMapTest, EraseIterator)
+{
+    for (auto It = SwissDenseMap.Begin(); It != SwissDenseMap.End();)
+    {
+        const auto KeyToErase { It->first };
+        It = SwissDenseMap.Erase(SwissDenseMapType::ConstIterator { It });
+        EXPECT_FALSE(SwissDenseMap.Contains(KeyToErase));
+    }
+}
+
+TEST_F(SwissDenseMapTest, Rehash)
+{
+    const std::size_t RehashTo { std::max(SwissDenseMap.GetCapacity(), IterationsCount * 64u) };
+    SwissDenseMap.Rehash(RehashTo);
+    EXPECT_EQ(SwissDenseMap.GetCapacity(), std::bit_ceil(RehashTo));
+
+    for (std::size_t i = 0u; i < IterationsCount; ++i)
+    {
+        EXPECT_EQ(SwissDenseMap.At(i), GetEntityAt(i));
+    }
+}
+
+TEST_F(SwissDenseMapTest, Find)
+{
+    EXPECT_EQ(SwissDenseMap.Find(IterationsCount), SwissDenseMap.End());
+
+    for (auto It = SwissDenseMap.Begin(), End = SwissDenseMap.End(); It != End; ++It)
+    {
+        EXPECT_EQ(SwissDenseMap.Find(It->first), It);
+        EXPECT_EQ(SwissDenseMap.Find(static_cast<ConvertableToKey>(It->first)), It);
+    }
+}
+
+TEST_F(SwissDenseMapTest, Subscript)
+{
+    EXPECT_FALSE(SwissDenseMap.Contains(IterationsCount));
+    SwissDenseMap[IterationsCount] = GetEntityAt(IterationsCount);
+    EXPECT_TRUE(SwissDenseMap.Contains(IterationsCount));
+}
+
+TEST_F(SwissDenseMapTest, MatchesUnorderedMap)
+{
+    std::unordered_map<KeyType, std::size_t> Expected;
+    egg::Containers::SwissDenseMap<KeyType, std::size_t> Map;
+    std::mt19937_64 Random { 42u };
+
+    for (std::size_t i = 0u; i < 100'000u; ++i)
+    {
+        const KeyType Key { Random() % 4'096u };
+
+        if (Random() % 3u)
+        {
+            EXPECT_EQ(Map.InsertOrAssign(Key, i).second, Expected.insert_or_assign(Key, i).second);
+        }
+        else
+        {
+            EXPECT_EQ(Map.Erase(Key), Expected.erase(Key) == 1u);
+        }
+    }
+
+    ASSERT_EQ(Map.GetSize(), Expected.size());
+
+    for (const auto& [Key, Value] : Expected)
+    {
+        EXPECT_EQ(Map.At(Key), Value);
+    }
+
+    for (const auto& [Key, Value] : Map)
+    {
+        EXPECT_EQ(Expected.at(Key), Value);
+    }
+}
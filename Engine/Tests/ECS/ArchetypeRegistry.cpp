@@ -0,0 +1,194 @@
+#include "../Single.h"
+
+#include <ECS/ArchetypeRegistry.h>
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace
+{
+    struct Position
+    {
+        float X;
+        float Y;
+    };
+
+    struct Velocity
+    {
+        float X;
+        float Y;
+    };
+
+    struct Name
+    {
+        std::string Value;
+    };
+
+    struct Tag
+    {
+    };
+}
+
+class ArchetypeRegistryTest : public testing::Test
+{
+protected:
+    static constexpr std::size_t EntitiesCount { 5'000u };
+
+    ArchetypeRegistryTest()
+    {
+        for (std::size_t i = 0u; i < EntitiesCount; ++i)
+        {
+            const EntityType Entity { Registry.Create() };
+            Registry.Emplace<Position>(Entity, static_cast<float>(i), 0.f);
+
+            if (i % 2u)
+            {
+                Registry.Emplace<Velocity>(Entity, 1.f, 2.f);
+            }
+
+            if (i % 5u == 0u)
+            {
+                Registry.Emplace<Tag>(Entity);
+            }
+
+            Entities.push_back(Entity);
+        }
+    }
+
+    egg::ECS::ArchetypeRegistry<EntityType> Registry;
+    std::vector<EntityType> Entities;
+};
+
+TEST_F(ArchetypeRegistryTest, EmplaceAndGet)
+{
+    for (std::size_t i = 0u; i < EntitiesCount; ++i)
+    {
+        EXPECT_TRUE(Registry.Contains<Position>(Entities[i]));
+        EXPECT_EQ(Registry.Contains<Velocity>(Entities[i]), i % 2u == 1u);
+        EXPECT_EQ(Registry.Contains<Tag>(Entities[i]), i % 5u == 0u);
+        EXPECT_FLOAT_EQ(Registry.Get<Position>(Entities[i]).X, static_cast<float>(i));
+    }
+
+    EXPECT_EQ(Registry.GetArchetypesCount(), 5u);
+}
+
+TEST_F(ArchetypeRegistryTest, Erase)
+{
+    for (std::size_t i = 1u; i < EntitiesCount; i += 2u)
+    {
+        Registry.Erase<Velocity>(Entities[i]);
+    }
+
+    for (std::size_t i = 0u; i < EntitiesCount; ++i)
+    {
+        EXPECT_FALSE(Registry.Contains<Velocity>(Entities[i]));
+        EXPECT_FLOAT_EQ(Registry.Get<Position>(Entities[i]).X, static_cast<float>(i));
+    }
+}
+
+TEST_F(ArchetypeRegistryTest, Destroy)
+{
+    for (std::size_t i = 0u; i < EntitiesCount; i += 3u)
+    {
+        Registry.Destroy(Entities[i]);
+    }
+
+    for (std::size_t i = 0u; i < EntitiesCount; ++i)
+    {
+        EXPECT_EQ(Registry.Valid(Entities[i]), i % 3u != 0u);
+
+        if (i % 3u)
+        {
+            EXPECT_FLOAT_EQ(Registry.Get<Position>(Entities[i]).X, static_cast<float>(i));
+        }
+        else
+        {
+            EXPECT_FALSE(Registry.Contains<Position>(Entities[i]));
+        }
+    }
+
+    const EntityType Recycled { Registry.Create() };
+    EXPECT_FALSE(Registry.Contains<Position>(Recycled));
+}
+
+TEST_F(ArchetypeRegistryTest, Group)
+{
+    const auto Group { Registry.Group<Position>(egg::ECS::View<const Velocity>, egg::ECS::Exclude<Tag>) };
+    std::size_t Visited {};
+
+    Group.Each([&Visited](const EntityType Entity, Position& Current, const Velocity& Speed)
+    {
+        EXPECT_EQ(EntityTraitsType::ToEntity(Entity) % 2u, 1u);
+        EXPECT_NE(EntityTraitsType::ToEntity(Entity) % 5u, 0u);
+        Current.Y += Speed.Y;
+        ++Visited;
+    });
+
+    EXPECT_EQ(Visited, Group.GetSize());
+    EXPECT_EQ(Visited, EntitiesCount / 2u - EntitiesCount / 10u);
+
+    for (std::size_t i = 0u; i < EntitiesCount; ++i)
+    {
+        EXPECT_FLOAT_EQ(Registry.Get<Position>(Entities[i]).Y, i % 2u && i % 5u ? 2.f : 0.f);
+    }
+}
+
+TEST_F(ArchetypeRegistryTest, GroupTracksNewArchetypes)
+{
+    const auto Group { Registry.Group<>(egg::ECS::View<Position, Name>) };
+    EXPECT_TRUE(Group.Empty());
+
+    Registry.Emplace<Name>(Entities.front(), "First");
+    Registry.Emplace<Name>(Entities.back(), "Last");
+
+    std::vector<std::string> Names;
+    Group.Each([&Names](const Position&, const Name& Current)
+    {
+        Names.push_back(Current.Value);
+    });
+
+    EXPECT_EQ(Names.size(), 2u);
+    EXPECT_EQ(Group.GetArchetypesCount(), 2u);
+}
+
+TEST_F(ArchetypeRegistryTest, EachChunk)
+{
+    const auto Group { Registry.Group<>(egg::ECS::View<const Position>) };
+    std::size_t Visited {};
+
+    Group.EachChunk([&Visited](const std::span<const EntityType> Chunk, const std::span<const Position> Positions)
+    {
+        EXPECT_EQ(Chunk.size(), Positions.size());
+        Visited += Chunk.size();
+    });
+
+    EXPECT_EQ(Visited, EntitiesCount);
+}
+
+TEST_F(ArchetypeRegistryTest, NonTrivialElements)
+{
+    for (std::size_t i = 0u; i < EntitiesCount; ++i)
+    {
+        Registry.Emplace<Name>(Entities[i], std::to_string(i));
+    }
+
+    for (std::size_t i = 0u; i < EntitiesCount; i += 2u)
+    {
+        Registry.Erase<Position>(Entities[i]);
+    }
+
+    for (std::size_t i = 0u; i < EntitiesCount; ++i)
+    {
+        EXPECT_EQ(Registry.Get<Name>(Entities[i]).Value, std::to_string(i));
+    }
+
+    Registry.Clear();
+
+    for (const EntityType Entity : Entities)
+    {
+        EXPECT_FALSE(Registry.Valid(Entity));
+    }
+}
@@ -0,0 +1,277 @@
+#include "../Single.h"
+
+#include <ECS/Registry.h>
+#include <ECS/CommandBuffer/CommandBuffer.h>
+#include <ECS/CommandBuffer/ParallelCommandBuffer.h>
+#include <gtest/gtest.h>
+#include <Jobs/JobPool/JobPool.h>
+
+#include <atomic>
+#include <bit>
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    struct Position
+    {
+        float X;
+        float Y;
+    };
+
+    struct Name
+    {
+        std::string Value;
+    };
+
+    struct Dead
+    {
+    };
+
+    using RegistryType = egg::ECS::Registry<EntityType>;
+    using CommandBufferType = egg::ECS::CommandBuffer<RegistryType>;
+}
+
+class CommandBufferTest : public testing::Test
+{
+protected:
+    static constexpr std::size_t EntitiesCount { 1'000u };
+
+    CommandBufferTest() : Commands { Registry }
+    {
+        Entities.resize(EntitiesCount);
+        Registry.Create(Entities.begin(), Entities.end());
+
+        for (std::size_t i = 0u; i < EntitiesCount; ++i)
+        {
+            Registry.Emplace<Position>(Entities[i], static_cast<float>(i), 0.f);
+        }
+    }
+
+    RegistryType Registry;
+    CommandBufferType Commands;
+    std::vector<EntityType> Entities;
+};
+
+TEST_F(CommandBufferTest, DeferredWhileIterating)
+{
+    const auto Group { Registry.Group<Position>() };
+
+    Group.Each([this](const EntityType Entity, const Position& Current)
+    {
+        if (static_cast<std::size_t>(Current.X) % 2u)
+        {
+            Commands.Emplace<Dead>(Entity);
+            Commands.Destroy(Entity);
+        }
+        else
+        {
+            Commands.Emplace<Name>(Entity, std::to_string(static_cast<std::size_t>(Current.X)));
+        }
+    });
+
+    EXPECT_EQ(Registry.GetPoolFor<Position>().GetSize(), EntitiesCount);
+    EXPECT_EQ(Commands.GetSize(), EntitiesCount + EntitiesCount / 2u);
+
+    Commands.Flush();
+
+    EXPECT_TRUE(Commands.Empty());
+    EXPECT_EQ(Registry.GetPoolFor<Position>().GetSize(), EntitiesCount / 2u);
+    EXPECT_EQ(Registry.GetPoolFor<Dead>().GetSize(), 0u);
+
+    for (std::size_t i = 0u; i < EntitiesCount; ++i)
+    {
+        EXPECT_EQ(Registry.Valid(Entities[i]), i % 2u == 0u);
+
+        if (i % 2u == 0u)
+        {
+            EXPECT_EQ(Registry.Get<Name>(Entities[i]).Value, std::to_string(i));
+        }
+    }
+}
+
+TEST_F(CommandBufferTest, PendingEntities)
+{
+    const auto First { Commands.Create() };
+    const auto Second { Commands.Create() };
+
+    Commands.Emplace<Position>(First, 1.f, 2.f);
+    Commands.Emplace<Name>(Second, "Second");
+    Commands.Patch<Position>(First, [](Position& Current) { Current.Y = 3.f; });
+    Commands.Flush();
+
+    const EntityType FirstEntity { Commands.Resolve(First) };
+    const EntityType SecondEntity { Commands.Resolve(Second) };
+
+    ASSERT_TRUE(Registry.Valid(FirstEntity));
+    ASSERT_TRUE(Registry.Valid(SecondEntity));
+    EXPECT_FLOAT_EQ(Registry.Get<Position>(FirstEntity).X, 1.f);
+    EXPECT_FLOAT_EQ(Registry.Get<Position>(FirstEntity).Y, 3.f);
+    EXPECT_EQ(Registry.Get<Name>(SecondEntity).Value, "Second");
+    EXPECT_FALSE(Registry.Contains<Position>(SecondEntity));
+}
+
+TEST_F(CommandBufferTest, OrderWithinPool)
+{
+    Commands.Erase<Position>(Entities[0]);
+    Commands.Emplace<Position>(Entities[0], 5.f, 5.f);
+    Commands.Patch<Position>(Entities[0], [](Position& Current) { Current.X += 1.f; });
+    Commands.Flush();
+
+    EXPECT_FLOAT_EQ(Registry.Get<Position>(Entities[0]).X, 6.f);
+}
+
+TEST_F(CommandBufferTest, ClearDiscardsPayloads)
+{
+    const auto Shared { std::make_shared<int>(0) };
+
+    Commands.Patch<Position>(Entities[0], [Shared](Position&) {});
+    Commands.Emplace<Name>(Entities[0], std::string(64u, 'x'));
+    EXPECT_EQ(Shared.use_count(), 2);
+
+    Commands.Clear();
+
+    EXPECT_EQ(Shared.use_count(), 1);
+    EXPECT_FALSE(Registry.Contains<Name>(Entities[0]));
+}
+
+TEST_F(CommandBufferTest, SpliceOwnsPayloads)
+{
+    {
+        CommandBufferType Source { Registry };
+        Source.Emplace<Name>(Entities[0], std::string(64u, 'x'));
+
+        Commands.Emplace<Name>(Entities[2], std::string(64u, 'z'));
+        Commands.Splice(Source);
+
+        Source.Clear();
+        Source.Emplace<Name>(Entities[1], std::string(64u, 'y'));
+    }
+
+    Commands.Flush();
+
+    EXPECT_EQ(Registry.Get<Name>(Entities[0]).Value, std::string(64u, 'x'));
+    EXPECT_EQ(Registry.Get<Name>(Entities[2]).Value, std::string(64u, 'z'));
+    EXPECT_FALSE(Registry.Contains<Name>(Entities[1]));
+
+    Commands.Emplace<Name>(Entities[3], std::string(64u, 'w'));
+    Commands.Flush();
+
+    EXPECT_EQ(Registry.Get<Name>(Entities[0]).Value, std::string(64u, 'x'));
+    EXPECT_EQ(Registry.Get<Name>(Entities[3]).Value, std::string(64u, 'w'));
+}
+
+TEST_F(CommandBufferTest, ParallelRecording)
+{
+    egg::Jobs::JobPool Pool { 3u };
+    egg::ECS::ParallelCommandBuffer<RegistryType> Parallel { Registry, Pool };
+
+    Pool.ParallelFor(EntitiesCount, 16u, [this, &Parallel](const std::size_t First, const std::size_t Last)
+    {
+        CommandBufferType& Local { Parallel.GetLocal() };
+
+        for (std::size_t i = First; i < Last; ++i)
+        {
+            Local.Emplace<Name>(Entities[i], std::to_string(i));
+
+            if (i % 4u == 0u)
+            {
+                Local.Emplace<Position>(Local.Create(), static_cast<float>(i), 1.f);
+            }
+        }
+    });
+
+    EXPECT_EQ(Parallel.GetSize(), EntitiesCount + EntitiesCount / 2u);
+    Parallel.Flush();
+
+    EXPECT_TRUE(Parallel.Empty());
+    EXPECT_EQ(Registry.GetPoolFor<Name>().GetSize(), EntitiesCount);
+    EXPECT_EQ(Registry.GetPoolFor<Position>().GetSize(), EntitiesCount + EntitiesCount / 4u);
+
+    for (std::size_t i = 0u; i < EntitiesCount; ++i)
+    {
+        EXPECT_EQ(Registry.Get<Name>(Entities[i]).Value, std::to_string(i));
+    }
+}
+
+TEST_F(CommandBufferTest, ParallelExternalOwner)
+{
+    egg::Jobs::JobPool Pool { 2u };
+    egg::ECS::ParallelCommandBuffer<RegistryType> Parallel { Registry, Pool };
+
+    EXPECT_EQ(Parallel.GetExternalOwner(), std::thread::id {});
+
+    Parallel.GetLocal().Emplace<Name>(Entities[0], "Main");
+    EXPECT_EQ(Parallel.GetExternalOwner(), std::this_thread::get_id());
+    EXPECT_EQ(&Parallel.GetLocal(), &Parallel.GetLocal());
+
+    Parallel.Flush();
+    EXPECT_EQ(Parallel.GetExternalOwner(), std::thread::id {});
+
+    std::thread::id Recorder {};
+
+    std::thread { [this, &Parallel, &Recorder]
+    {
+        Parallel.GetLocal().Emplace<Name>(Entities[1], "Other");
+        Recorder = Parallel.GetExternalOwner();
+    } }.join();
+
+    EXPECT_NE(Recorder, std::this_thread::get_id());
+    EXPECT_NE(Recorder, std::thread::id {});
+
+    Parallel.Flush();
+
+    EXPECT_EQ(Registry.Get<Name>(Entities[0]).Value, "Main");
+    EXPECT_EQ(Registry.Get<Name>(Entities[1]).Value, "Other");
+}
+
+TEST_F(CommandBufferTest, ParallelResolve)
+{
+    egg::Jobs::JobPool Pool { 3u };
+    egg::ECS::ParallelCommandBuffer<RegistryType> Parallel { Registry, Pool };
+
+    struct Spawned
+    {
+        CommandBufferType* Local;
+        CommandBufferType::PendingEntity Entity;
+        std::size_t Value;
+    };
+
+    std::vector<Spawned> Records(EntitiesCount);
+    std::atomic<std::size_t> Threads {};
+    const auto Deadline { std::chrono::steady_clock::now() + std::chrono::seconds { 1 } };
+
+    Pool.ParallelFor(EntitiesCount, 16u, [&Pool, &Parallel, &Records, &Threads, Deadline](const std::size_t First, const std::size_t Last)
+    {
+        Threads.fetch_or(std::size_t { 1u } << Pool.GetThreadIndex());
+
+        while (std::popcount(Threads.load()) < 2 && std::chrono::steady_clock::now() < Deadline)
+        {
+            std::this_thread::yield();
+        }
+
+        CommandBufferType& Local { Parallel.GetLocal() };
+
+        for (std::size_t i = First; i < Last; ++i)
+        {
+            const auto Entity { Local.Create() };
+            Local.Emplace<Position>(Entity, static_cast<float>(i), 2.f);
+            Records[i] = Spawned { &Local, Entity, i };
+        }
+    });
+
+    Parallel.Flush();
+
+    for (const Spawned& Record : Records)
+    {
+        const EntityType Entity { Parallel.Resolve(*Record.Local, Record.Entity) };
+
+        ASSERT_TRUE(Registry.Valid(Entity));
+        EXPECT_FLOAT_EQ(Registry.Get<Position>(Entity).X, static_cast<float>(Record.Value));
+        EXPECT_FLOAT_EQ(Registry.Get<Position>(Entity).Y, 2.f);
+    }
+}
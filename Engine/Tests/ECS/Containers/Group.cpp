@@ -0,0 +1,245 @@
+#include "../../Single.h"
+
+#include <Containers/Algorithms/RadixSort.h>
+#include <ECS/Registry.h>
+#include <ECS/Containers/Group/Group.h>
+#include <gtest/gtest.h>
+#include <Jobs/SequentialExecutor.h>
+#include <Jobs/JobPool/JobPool.h>
+
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <limits>
+
+namespace
+{
+    struct Position
+    {
+        float X;
+        float Y;
+    };
+
+    struct Velocity
+    {
+        float X;
+        float Y;
+    };
+
+    struct Frozen
+    {
+    };
+}
+
+class GroupTest : public testing::Test
+{
+protected:
+    static constexpr std::size_t EntitiesCount { 10'000u };
+
+    GroupTest() : Pool { 3u }
+    {
+        for (std::size_t i = 0u; i < EntitiesCount; ++i)
+        {
+            const EntityType Entity { Registry.Create() };
+            const float Value { static_cast<float>(i) };
+
+            Registry.GetPoolFor<Position>().Emplace(Entity, Value, Value);
+
+            if (i % 2u)
+            {
+                Registry.GetPoolFor<Velocity>().Emplace(Entity, 1.f, 2.f);
+            }
+
+            if (i % 3u == 0u)
+            {
+                Registry.GetPoolFor<Frozen>().Push(Entity);
+            }
+        }
+    }
+
+    template <typename GroupType>
+    void ExpectMoved(const GroupType& Group) const
+    {
+        for (const EntityType Entity : Group.Entities())
+        {
+            const auto& [X, Y] { Registry.GetPoolFor<Position>()->Get(Entity) };
+            const float Value { static_cast<float>(EntityTraitsType::ToEntity(Entity)) };
+
+            EXPECT_FLOAT_EQ(X, Value + 1.f);
+            EXPECT_FLOAT_EQ(Y, Value + 2.f);
+        }
+    }
+
+    static constexpr auto Move { [](Position& Current, const Velocity& Speed)
+    {
+        Current.X += Speed.X;
+        Current.Y += Speed.Y;
+    } };
+
+    egg::ECS::Registry<EntityType> Registry;
+    egg::Jobs::JobPool Pool;
+};
+
+TEST_F(GroupTest, ParallelEachOwned)
+{
+    const auto Group { Registry.Group<Position, Velocity>() };
+    Group.ParallelEach(Move, Pool);
+
+    EXPECT_EQ(Group.GetSize(), EntitiesCount / 2u);
+    ExpectMoved(Group);
+}
+
+TEST_F(GroupTest, ParallelEachPartiallyOwned)
+{
+    const auto Group { Registry.Group<Position>(egg::ECS::View<const Velocity>, egg::ECS::Exclude<Frozen>) };
+    std::atomic<std::size_t> Visited {};
+
+    Group.ParallelEach([&Visited](const EntityType Entity, Position& Current, const Velocity& Speed)
+    {
+        EXPECT_EQ(EntityTraitsType::ToEntity(Entity) % 2u, 1u);
+        EXPECT_NE(EntityTraitsType::ToEntity(Entity) % 3u, 0u);
+        Move(Current, Speed);
+        Visited.fetch_add(1u, std::memory_order_relaxed);
+    }, Pool);
+
+    EXPECT_EQ(Visited.load(), Group.GetSize());
+    ExpectMoved(Group);
+}
+
+TEST_F(GroupTest, ParallelEachNonOwned)
+{
+    const auto Group { Registry.Group<>(egg::ECS::View<Position, const Velocity>) };
+    Group.ParallelEach(Move, Pool);
+
+    ExpectMoved(Group);
+}
+
+TEST_F(GroupTest, ParallelEachSingle)
+{
+    const auto Group { Registry.Group<Position>() };
+    std::atomic<std::size_t> Visited {};
+
+    Group.ParallelEach([&Visited](Position& Current)
+    {
+        Current.X += 1.f;
+        Current.Y += 2.f;
+        Visited.fetch_add(1u, std::memory_order_relaxed);
+    }, Pool);
+
+    EXPECT_EQ(Visited.load(), EntitiesCount);
+    ExpectMoved(Group);
+}
+
+TEST_F(GroupTest, ParallelEachEmptyElement)
+{
+    const auto Group { Registry.Group<>(egg::ECS::View<Frozen>) };
+    std::atomic<std::size_t> Visited {};
+
+    Group.ParallelEach([&Visited](const EntityType Entity)
+    {
+        EXPECT_EQ(EntityTraitsType::ToEntity(Entity) % 3u, 0u);
+        Visited.fetch_add(1u, std::memory_order_relaxed);
+    }, Pool);
+
+    EXPECT_EQ(Visited.load(), Group.GetSize());
+}
+
+TEST_F(GroupTest, ParallelEachMatchesEach)
+{
+    const auto Group { Registry.Group<Position, Velocity>() };
+    egg::Jobs::SequentialExecutor Sequential;
+    std::size_t Serial {};
+    std::atomic<std::size_t> Parallel {};
+
+    Group.Each([&Serial](const EntityType Entity, const Position&, const Velocity&)
+    {
+        Serial += EntityTraitsType::ToIntegral(Entity);
+    });
+
+    Group.ParallelEach([&Parallel](const EntityType Entity, const Position&, const Velocity&)
+    {
+        Parallel.fetch_add(EntityTraitsType::ToIntegral(Entity), std::memory_order_relaxed);
+    }, Pool);
+
+    EXPECT_EQ(Parallel.load(), Serial);
+
+    Parallel.store(0u);
+    Group.ParallelEach([&Parallel](const EntityType Entity, const Position&, const Velocity&)
+    {
+        Parallel.fetch_add(EntityTraitsType::ToIntegral(Entity), std::memory_order_relaxed);
+    }, Sequential);
+
+    EXPECT_EQ(Parallel.load(), Serial);
+}
+
+TEST_F(GroupTest, RadixSort)
+{
+    const auto Owned { Registry.Group<Position>(egg::ECS::View<const Velocity>) };
+    Owned.Sort<Position>(std::greater {}, egg::Containers::RadixSort, [](const Position& Current) { return Current.X; });
+
+    float Previous { std::numeric_limits<float>::infinity() };
+
+    for (const EntityType Entity : Owned.Entities())
+    {
+        const Position& Current { Registry.Get<Position>(Entity) };
+        EXPECT_LT(Current.X, Previous);
+        EXPECT_FLOAT_EQ(Current.Y, static_cast<float>(EntityTraitsType::ToEntity(Entity)));
+        Previous = Current.X;
+    }
+
+    const auto NonOwned { Registry.Group<>(egg::ECS::View<const Position, const Velocity>) };
+    NonOwned.Sort<const Position>(std::less {}, egg::Containers::RadixSort, [](const Position& Current) { return Current.X; });
+
+    std::size_t Visited {};
+    Previous = -1.f;
+
+    NonOwned.Each([&Visited, &Previous](const Position& Current, const Velocity&)
+    {
+        EXPECT_GT(Current.X, Previous);
+        Previous = Current.X;
+        ++Visited;
+    });
+
+    EXPECT_EQ(Visited, EntitiesCount / 2u);
+}
+
+TEST_F(GroupTest, SortIncremental)
+{
+    const auto ByX { [](const Position& Current) { return Current.X; } };
+    const auto Owned { Registry.Group<Position>(egg::ECS::View<const Velocity>) };
+
+    for (std::size_t Frame = 0u; Frame < 2u; ++Frame)
+    {
+        Owned.SortIncremental<Position>(std::greater {}, ByX);
+
+        float Previous { std::numeric_limits<float>::infinity() };
+
+        for (const EntityType Entity : Owned.Entities())
+        {
+            const Position& Current { Registry.Get<Position>(Entity) };
+            EXPECT_LE(Current.X, Previous);
+            EXPECT_FLOAT_EQ(Current.Y, static_cast<float>(EntityTraitsType::ToEntity(Entity)));
+            Previous = Current.X;
+        }
+
+        Owned.Each([](Position& Current, const Velocity&)
+        {
+            Current.X += static_cast<int>(Current.Y) % 4 == 1 ? 5.f : 0.f;
+        });
+    }
+
+    const auto NonOwned { Registry.Group<>(egg::ECS::View<const Position, const Velocity>) };
+    NonOwned.SortIncremental<const Position>(std::less {}, ByX);
+
+    std::size_t Visited {};
+    float Previous { -1.f };
+
+    NonOwned.Each([&Visited, &Previous](const Position& Current, const Velocity&)
+    {
+        EXPECT_GE(Current.X, Previous);
+        Previous = Current.X;
+        ++Visited;
+    });
+
+    EXPECT_EQ(Visited, EntitiesCount / 2u);
+}
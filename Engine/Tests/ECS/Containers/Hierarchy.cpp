@@ -0,0 +1,185 @@
+#include "../../Single.h"
+
+#include <ECS/Containers/Hierarchy/Hierarchy.h>
+#include <ECS/Containers/Storage/Storage.h>
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <vector>
+
+namespace
+{
+    struct Transform
+    {
+        float Local;
+        float World;
+    };
+}
+
+class HierarchyTest : public testing::Test
+{
+protected:
+    using HierarchyType = egg::ECS::Containers::Hierarchy<EntityType>;
+
+    static constexpr std::size_t EntitiesCount { 64u };
+
+    HierarchyTest()
+    {
+        for (std::size_t i = EntitiesCount; i-- > 0u;)
+        {
+            Hierarchy.Attach(GetEntityAt(i), i ? GetEntityAt((i - 1u) / 3u) : EntityTraitsType::Tombstone);
+        }
+    }
+
+    [[nodiscard]] std::size_t GetPosition(const EntityType Entity) const
+    {
+        return Hierarchy.GetSize() - Hierarchy.GetIndex(Entity) - 1u;
+    }
+
+    HierarchyType Hierarchy;
+};
+
+TEST_F(HierarchyTest, ArrangeDepthFirst)
+{
+    EXPECT_FALSE(Hierarchy.IsArranged());
+    Hierarchy.Arrange();
+    EXPECT_TRUE(Hierarchy.IsArranged());
+
+    for (std::size_t i = 1u; i < EntitiesCount; ++i)
+    {
+        EXPECT_LT(GetPosition(GetEntityAt((i - 1u) / 3u)), GetPosition(GetEntityAt(i)));
+    }
+
+    EXPECT_EQ(Hierarchy.Get(GetEntityAt(0u)).Descendants, EntitiesCount - 1u);
+    EXPECT_EQ(Hierarchy.Get(GetEntityAt(63u)).Descendants, 0u);
+
+    const std::size_t First { GetPosition(GetEntityAt(1u)) };
+    std::size_t Count {};
+
+    for (const EntityType Entity : Hierarchy.GetSubtree(GetEntityAt(1u)))
+    {
+        EXPECT_EQ(GetPosition(Entity), First + Count++);
+        EXPECT_TRUE(Entity == GetEntityAt(1u) || Hierarchy.IsAncestor(GetEntityAt(1u), Entity));
+    }
+
+    EXPECT_EQ(Count, Hierarchy.Get(GetEntityAt(1u)).Descendants + 1u);
+    EXPECT_EQ(Count, 37u);
+}
+
+TEST_F(HierarchyTest, ReparentAndErase)
+{
+    Hierarchy.Attach(GetEntityAt(2u), GetEntityAt(3u));
+    EXPECT_TRUE(Hierarchy.IsAncestor(GetEntityAt(3u), GetEntityAt(7u)));
+
+    Hierarchy.Erase(GetEntityAt(3u));
+    EXPECT_EQ(Hierarchy.Get(GetEntityAt(2u)).Parent, EntityTraitsType::Tombstone);
+    EXPECT_FALSE(Hierarchy.IsAncestor(GetEntityAt(0u), GetEntityAt(7u)));
+
+    Hierarchy.Detach(GetEntityAt(1u));
+    Hierarchy.Arrange();
+
+    std::size_t Roots {};
+    std::size_t Descendants {};
+
+    for (auto [Entity, Node] : Hierarchy.Each())
+    {
+        if (Node.Parent == EntityTraitsType::Tombstone)
+        {
+            ++Roots;
+            Descendants += Node.Descendants + 1u;
+        }
+        else
+        {
+            EXPECT_LT(GetPosition(Node.Parent), GetPosition(Entity));
+        }
+    }
+
+    EXPECT_EQ(Roots, 6u);
+    EXPECT_EQ(Descendants, EntitiesCount - 1u);
+}
+
+TEST_F(HierarchyTest, Propagate)
+{
+    egg::ECS::Containers::Storage<Transform, EntityType> Transforms;
+
+    for (std::size_t i = 0u; i < EntitiesCount; ++i)
+    {
+        Transforms.Emplace(GetEntityAt(i), 1.f, 0.f);
+    }
+
+    Hierarchy.Arrange(Transforms);
+
+    std::vector<EntityType> Order;
+
+    for (const EntityType Entity : Transforms)
+    {
+        Order.push_back(Entity);
+    }
+
+    EXPECT_EQ(Order, std::vector<EntityType>(Hierarchy.Begin(), Hierarchy.End()));
+
+    Hierarchy.Propagate(Transforms, [](Transform& Current, const Transform* Parent)
+    {
+        Current.World = Current.Local + (Parent ? Parent->World : 0.f);
+    });
+
+    for (std::size_t i = 0u; i < EntitiesCount; ++i)
+    {
+        float Depth { 1.f };
+
+        for (std::size_t Current = i; Current; Current = (Current - 1u) / 3u)
+        {
+            Depth += 1.f;
+        }
+
+        EXPECT_EQ(Transforms.Get(GetEntityAt(i)).World, Depth);
+    }
+}
+
+TEST_F(HierarchyTest, EmplaceKeepsArrangement)
+{
+    Hierarchy.Arrange();
+
+    Hierarchy.Emplace(GetEntityAt(EntitiesCount));
+    Hierarchy.Push(GetEntityAt(EntitiesCount + 1u));
+
+    EXPECT_TRUE(Hierarchy.IsArranged());
+    EXPECT_EQ(Hierarchy.Get(GetEntityAt(EntitiesCount)).Descendants, 0u);
+    EXPECT_EQ(Hierarchy.Get(GetEntityAt(0u)).Descendants, EntitiesCount - 1u);
+
+    const std::size_t First { GetPosition(GetEntityAt(0u)) };
+    std::size_t Count {};
+
+    for (const EntityType Entity : Hierarchy.GetSubtree(GetEntityAt(0u)))
+    {
+        EXPECT_EQ(GetPosition(Entity), First + Count++);
+    }
+
+    EXPECT_EQ(Count, EntitiesCount);
+}
+
+TEST_F(HierarchyTest, PropagateArrangesPool)
+{
+    egg::ECS::Containers::Storage<Transform, EntityType> Transforms;
+
+    for (std::size_t i = 0u; i < EntitiesCount; ++i)
+    {
+        Transforms.Emplace(GetEntityAt(i), 1.f, 0.f);
+    }
+
+    Hierarchy.Propagate(Transforms, [](Transform& Current, const Transform* Parent)
+    {
+        Current.World = Current.Local + (Parent ? Parent->World : 0.f);
+    });
+
+    std::vector<EntityType> Order;
+
+    for (const EntityType Entity : Transforms)
+    {
+        Order.push_back(Entity);
+    }
+
+    EXPECT_TRUE(Hierarchy.IsArranged());
+    EXPECT_EQ(Order, std::vector<EntityType>(Hierarchy.Begin(), Hierarchy.End()));
+    EXPECT_EQ(Transforms.Get(GetEntityAt(4u)).World, 3.f);
+}
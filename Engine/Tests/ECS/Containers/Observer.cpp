@@ -0,0 +1,126 @@
+#include "../../Single.h"
+
+#include <ECS/Registry.h>
+#include <ECS/Containers/Observer/Observer.h>
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+namespace
+{
+    struct Transform
+    {
+        float X;
+    };
+
+    struct Body
+    {
+        float Mass;
+    };
+
+    struct Sleeping
+    {
+    };
+}
+
+class ObserverTest : public testing::Test
+{
+protected:
+    using RegistryType = egg::ECS::Registry<EntityType>;
+    using ObserverType = egg::ECS::Containers::Observer<RegistryType>;
+
+    static constexpr std::size_t EntitiesCount { 100u };
+
+    ObserverTest()
+    {
+        for (std::size_t i = 0u; i < EntitiesCount; ++i)
+        {
+            const EntityType Entity { Registry.Create() };
+            Registry.Emplace<Transform>(Entity, 0.f);
+            Registry.Emplace<Body>(Entity, 1.f);
+            Entities.push_back(Entity);
+        }
+    }
+
+    RegistryType Registry;
+    std::vector<EntityType> Entities;
+};
+
+TEST_F(ObserverTest, CollectsOnce)
+{
+    ObserverType Observer { Registry, egg::ECS::Changed<Transform> };
+    EXPECT_TRUE(Observer.Empty());
+
+    for (std::size_t Repeat = 0u; Repeat < 3u; ++Repeat)
+    {
+        Registry.Patch<Transform>(Entities[3], [](Transform& Current) { Current.X += 1.f; });
+        Registry.Patch<Transform>(Entities[42], [](Transform& Current) { Current.X += 1.f; });
+    }
+
+    const EntityType Created { Registry.Create() };
+    Registry.Emplace<Transform>(Created, 0.f);
+
+    EXPECT_EQ(Observer.GetSize(), 3u);
+    EXPECT_TRUE(Observer.Contains(Entities[3]));
+    EXPECT_TRUE(Observer.Contains(Entities[42]));
+    EXPECT_TRUE(Observer.Contains(Created));
+
+    std::vector<EntityType> Visited;
+    Observer.Consume([&Visited](const EntityType Entity) { Visited.push_back(Entity); });
+
+    EXPECT_EQ(Visited.size(), 3u);
+    EXPECT_TRUE(Observer.Empty());
+    EXPECT_GE(Observer.GetCapacity(), 3u);
+
+    Registry.Patch<Transform>(Entities[3], [](Transform&) {});
+    EXPECT_EQ(std::vector(Observer.Begin(), Observer.End()), std::vector { Entities[3] });
+}
+
+TEST_F(ObserverTest, RequireAndExclude)
+{
+    ObserverType Observer { Registry, egg::ECS::Changed<Transform>, egg::ECS::View<Body>, egg::ECS::Exclude<Sleeping> };
+
+    Registry.Erase<Body>(Entities[0]);
+    Registry.Emplace<Sleeping>(Entities[1]);
+
+    for (std::size_t i = 0u; i < 4u; ++i)
+    {
+        Registry.Patch<Transform>(Entities[i], [](Transform&) {});
+    }
+
+    EXPECT_EQ(Observer.GetSize(), 2u);
+    EXPECT_FALSE(Observer.Contains(Entities[0]));
+    EXPECT_FALSE(Observer.Contains(Entities[1]));
+
+    Registry.Emplace<Sleeping>(Entities[2]);
+    Registry.Erase<Body>(Entities[3]);
+
+    EXPECT_TRUE(Observer.Empty());
+
+    Registry.Patch<Transform>(Entities[4], [](Transform&) {});
+    Registry.Destroy(Entities[4]);
+
+    EXPECT_TRUE(Observer.Empty());
+}
+
+TEST_F(ObserverTest, DisconnectsOnDestruction)
+{
+    {
+        ObserverType Observer { Registry, egg::ECS::Changed<Transform>, egg::ECS::View<Body>, egg::ECS::Exclude<Sleeping> };
+        Registry.Patch<Transform>(Entities[0], [](Transform&) {});
+        EXPECT_EQ(Observer.GetSize(), 1u);
+    }
+
+    Registry.Patch<Transform>(Entities[0], [](Transform&) {});
+    Registry.Emplace<Sleeping>(Entities[0]);
+    Registry.Erase<Body>(Entities[1]);
+
+    ObserverType Observer { Registry, egg::ECS::Changed<Sleeping> };
+    Registry.Emplace<Sleeping>(Entities[5]);
+
+    std::size_t Visited {};
+    Observer.Each([&Visited](const EntityType) { ++Visited; });
+    EXPECT_EQ(Visited, 1u);
+}
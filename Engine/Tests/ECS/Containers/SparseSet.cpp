@@ -5,6 +5,11 @@
 #include <gtest/gtest.h>
 #include <Types/TypeInfo/TypeInfo.h>
 
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
 class SparseSetTest : public testing::Test
 {
 protected:
@@ -300,6 +305,83 @@ TEST_F(SparseSetTest, Sort)
     }
 }
 
+TEST_F(SparseSetTest, SortIncremental)
+{
+    constexpr std::size_t EntitiesCount { 1'000u };
+
+    const auto ExpectSorted { [this]
+    {
+        for (std::size_t i = Sparse.GetSize() - 1u; i; --i)
+        {
+            EXPECT_LT(Sparse[i], Sparse[i - 1u]);
+            EXPECT_EQ(Sparse.GetIndex(Sparse[i]), i);
+        }
+    } };
+
+    Sparse.Clear();
+
+    for (std::size_t i = EntitiesCount; i--;)
+    {
+        Sparse.Push(GetEntityAt(i % 10u < 2u ? i ^ 1u : i));
+    }
+
+    Sparse.SortIncremental(std::less {});
+    ExpectSorted();
+
+    Sparse.SortIncremental(std::less {});
+    ExpectSorted();
+
+    Sparse.Clear();
+
+    for (std::size_t i = 0u; i < EntitiesCount; ++i)
+    {
+        Sparse.Push(GetEntityAt(i));
+    }
+
+    Sparse.SortIncremental(std::less {});
+    ExpectSorted();
+}
+
+TEST_F(SparseSetTest, ContainsMany)
+{
+    constexpr std::size_t EntitiesCount { 200u };
+
+    Sparse.Clear();
+    std::vector<EntityType> Entities;
+
+    for (std::size_t i = 0u; i < EntitiesCount; ++i)
+    {
+        const auto Identifier { static_cast<TraitsType::EntityType>(i % 3u ? i : i + TraitsType::PageSize * 5u) };
+
+        if (i % 4u)
+        {
+            Sparse.Push(TraitsType::Construct(Identifier, static_cast<TraitsType::VersionType>(i % 5u)));
+        }
+
+        Entities.push_back(TraitsType::Construct(Identifier, static_cast<TraitsType::VersionType>(i % 7u ? i % 5u : i % 5u + 1u)));
+    }
+
+    Entities.push_back(TraitsType::Tombstone);
+    Entities.push_back(TraitsType::Construct(TraitsType::PageSize * 2u, 0u));
+    Entities.push_back(TraitsType::Construct(TraitsType::EntityMask - 1u, 0u));
+
+    for (const std::size_t Count : { std::size_t { 0u }, std::size_t { 7u }, std::size_t { 64u }, std::size_t { 65u }, Entities.size() })
+    {
+        std::vector<std::uint64_t> Mask((Count + 63u) / 64u, ~std::uint64_t {});
+        Sparse.ContainsMany(std::span { Entities }.first(Count), Mask);
+
+        for (std::size_t i = 0u; i < Count; ++i)
+        {
+            EXPECT_EQ((Mask[i / 64u] >> i % 64u & 1u) != 0u, Sparse.Contains(Entities[i])) << i;
+        }
+
+        if (Count % 64u)
+        {
+            EXPECT_EQ(Mask.back() >> Count % 64u, 0u);
+        }
+    }
+}
+
 TEST_F(SparseSetTest, Subscript)
 {
     for (std::size_t i = 0u; i < IterationsCount; ++i)
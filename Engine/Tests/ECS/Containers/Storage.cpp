@@ -1,10 +1,21 @@
 #include "../../Single.h"
 
+#include <Containers/Algorithms/ParallelSort.h>
+#include <Containers/Algorithms/RadixSort.h>
 #include <ECS/Containers/Storage/Storage.h>
 #include <ECS/Traits/ComponentTraits.h>
 #include <gtest/gtest.h>
+#include <Jobs/JobPool/JobPool.h>
 
+#include <algorithm>
 #include <cmath>
+#include <cstddef>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <new>
+#include <utility>
+#include <vector>
 
 struct Velocity
 {
@@ -86,6 +97,135 @@ std::ostream& operator<<(std::ostream& Stream, const Velocity& Value)
     return Stream;
 }
 
+struct Tracked
+{
+    std::size_t Value;
+    static constexpr bool TrackChanges { true };
+};
+
+struct Stable
+{
+    std::size_t Value;
+    static constexpr bool TrackChanges { true };
+    static constexpr bool InPlaceDelete { true };
+};
+
+struct Counted
+{
+    Counted() noexcept
+    {
+        ++Alive;
+    }
+
+    Counted(Counted&&) noexcept
+    {
+        ++Alive;
+    }
+
+    Counted& operator=(Counted&&) noexcept = default;
+
+    ~Counted()
+    {
+        --Alive;
+    }
+
+    std::size_t Value {};
+
+    static constexpr bool InPlaceDelete { true };
+    static inline std::size_t Alive {};
+};
+
+struct Fixed
+{
+    std::size_t Value;
+};
+
+inline std::size_t AllocationsBudget { std::numeric_limits<std::size_t>::max() };
+
+template <typename Type>
+struct FailingAllocator
+{
+    using value_type = Type;
+
+    FailingAllocator() noexcept = default;
+
+    template <typename OtherType>
+    FailingAllocator(const FailingAllocator<OtherType>&) noexcept
+    {
+    }
+
+    Type* allocate(const std::size_t Count)
+    {
+        if (AllocationsBudget == 0u)
+        {
+            throw std::bad_alloc {};
+        }
+
+        --AllocationsBudget;
+        return std::allocator<Type> {}.allocate(Count);
+    }
+
+    void deallocate(Type* const Pointer, const std::size_t Count) noexcept
+    {
+        std::allocator<Type> {}.deallocate(Pointer, Count);
+    }
+
+    template <typename OtherType>
+    bool operator==(const FailingAllocator<OtherType>&) const noexcept
+    {
+        return true;
+    }
+};
+
+template <typename ElementType>
+void ExpectInsertRollsBack()
+{
+    egg::ECS::Containers::Storage<ElementType, EntityType, FailingAllocator<ElementType>> Storage;
+
+    Storage.Emplace(GetEntityAt(1u), 1u);
+    Storage.Emplace(GetEntityAt(2u), 2u);
+    Storage.Erase(GetEntityAt(1u));
+
+    const std::size_t Size { Storage.GetSize() };
+
+    std::vector<EntityType> Entities;
+    std::vector<ElementType> Values;
+
+    for (std::size_t i = 1u; i <= 8u; ++i)
+    {
+        Entities.push_back(GetEntityAt(i * EntityTraitsType::PageSize));
+        Values.push_back(ElementType { i });
+    }
+
+    for (std::size_t Budget = 0u;; ++Budget)
+    {
+        AllocationsBudget = Budget;
+
+        try
+        {
+            Storage.Insert(Entities.begin(), Entities.end(), Values.begin());
+        }
+        catch (const std::bad_alloc&)
+        {
+            EXPECT_EQ(Storage.GetSize(), Size);
+            EXPECT_TRUE(Storage.Contains(GetEntityAt(2u)));
+            EXPECT_FALSE(std::ranges::any_of(Entities, [&Storage](const EntityType Entity) { return Storage.Contains(Entity); }));
+            continue;
+        }
+
+        break;
+    }
+
+    AllocationsBudget = std::numeric_limits<std::size_t>::max();
+
+    for (std::size_t i = 0u; i < Entities.size(); ++i)
+    {
+        EXPECT_EQ(Storage.Get(Entities[i]).Value, i + 1u);
+    }
+
+    EXPECT_EQ(Storage.Get(GetEntityAt(2u)).Value, 2u);
+}
+
 class StorageTest : public testing::Test
 {
 protected:
@@ -289,3 +429,292 @@ TEST_F(StorageTest, GetCapacity)
 {
     EXPECT_EQ(Storage.GetCapacity(), ((IterationsCount - 1u) / TraitsType::PageSize + 1u) * TraitsType::PageSize);
 }
+
+TEST_F(StorageTest, ChangeTicksFollowEntities)
+{
+    egg::ECS::Containers::Storage<Tracked, EntityType> Tracking;
+    static_assert(decltype(Tracking)::TracksChanges);
+    static_assert(!egg::ECS::Containers::Storage<Velocity, EntityType>::TracksChanges);
+
+    for (std::size_t i = 0u; i < 40u; ++i)
+    {
+        Tracking.SetCurrentTick(static_cast<egg::ECS::ChangeTick>(i + 1u));
+        Tracking.Emplace(GetEntityAt(i), i);
+    }
+
+    Tracking.SetCurrentTick(100u);
+    Tracking.Patch(GetEntityAt(7u), [](Tracked& Current) { ++Current.Value; });
+    Tracking.MarkChanged(GetEntityAt(31u));
+    Tracking.Erase(GetEntityAt(0u));
+    Tracking.Erase(GetEntityAt(5u));
+    Tracking.Sort([](const EntityType Left, const EntityType Right) { return Left > Right; });
+
+    for (std::size_t i = 1u; i < 40u; ++i)
+    {
+        if (i == 5u) continue;
+        const bool Changed { i == 7u || i == 31u };
+        EXPECT_EQ(Tracking.GetChangedTick(GetEntityAt(i)), Changed ? 100u : i + 1u);
+    }
+
+    std::vector<EntityType> Visited;
+    Tracking.EachChanged(99u, [&Visited](const EntityType Entity, Tracked& Current)
+    {
+        EXPECT_EQ(Current.Value, EntityTraitsType::ToEntity(Entity) + (Entity == GetEntityAt(7u)));
+        Visited.push_back(Entity);
+    });
+
+    std::vector<EntityType> Expected;
+    for (const EntityType Entity : Tracking)
+    {
+        if (Entity == GetEntityAt(7u) || Entity == GetEntityAt(31u))
+        {
+            Expected.push_back(Entity);
+        }
+    }
+
+    EXPECT_EQ(Visited, Expected);
+
+    Visited.clear();
+    std::as_const(Tracking).EachChanged(30u, [&Visited](const EntityType Entity, const Tracked&)
+    {
+        Visited.push_back(Entity);
+    });
+
+    EXPECT_EQ(Visited.size(), 11u);
+
+    Tracking.Clear();
+    Tracking.EachChanged(0u, [](const EntityType, Tracked&) { ADD_FAILURE(); });
+}
+
+TEST_F(StorageTest, RadixSortPermutesPayloadAndTicks)
+{
+    egg::ECS::Containers::Storage<Tracked, EntityType> Tracking;
+
+    for (std::size_t i = 0u; i < 1'000u; ++i)
+    {
+        Tracking.SetCurrentTick(static_cast<egg::ECS::ChangeTick>(i % 7u + 1u));
+        Tracking.Emplace(GetEntityAt(i), (i * 7919u) % 1'000u);
+    }
+
+    Tracking.Sort(std::greater {}, egg::Containers::RadixSort, [&Tracking](const EntityType Entity)
+    {
+        return Tracking.Get(Entity).Value;
+    });
+
+    std::size_t Previous { Tracking.GetSize() };
+
+    for (const EntityType Entity : Tracking)
+    {
+        EXPECT_LT(Tracking.Get(Entity).Value, Previous);
+        Previous = Tracking.Get(Entity).Value;
+    }
+
+    for (std::size_t i = 0u; i < 1'000u; ++i)
+    {
+        EXPECT_EQ(Tracking.Get(GetEntityAt(i)).Value, (i * 7919u) % 1'000u);
+        EXPECT_EQ(Tracking.GetChangedTick(GetEntityAt(i)), i % 7u + 1u);
+    }
+
+    std::size_t Visited {};
+    Tracking.EachChanged(6u, [&Visited](const EntityType Entity, const Tracked&)
+    {
+        EXPECT_EQ(EntityTraitsType::ToEntity(Entity) % 7u, 6u);
+        ++Visited;
+    });
+
+    EXPECT_EQ(Visited, 142u);
+}
+
+TEST_F(StorageTest, SortIncrementalRepairsNearlySortedPayload)
+{
+    egg::ECS::Containers::Storage<Tracked, EntityType> Tracking;
+    std::vector<std::size_t> Expected;
+
+    for (std::size_t i = 0u; i < 1'000u; ++i)
+    {
+        Tracking.SetCurrentTick(static_cast<egg::ECS::ChangeTick>(i % 7u + 1u));
+        Tracking.Emplace(GetEntityAt(i), Expected.emplace_back(i % 50u ? i : i + 75u));
+    }
+
+    const auto ByValue { [&Tracking](const EntityType Entity)
+    {
+        return Tracking.Get(Entity).Value;
+    } };
+
+    for (std::size_t Frame = 0u; Frame < 2u; ++Frame)
+    {
+        Tracking.SortIncremental(std::greater {}, ByValue);
+
+        std::size_t Previous { std::numeric_limits<std::size_t>::max() };
+
+        for (const EntityType Entity : Tracking)
+        {
+            EXPECT_LE(Tracking.Get(Entity).Value, Previous);
+            Previous = Tracking.Get(Entity).Value;
+        }
+
+        for (std::size_t i = 0u; i < 1'000u; ++i)
+        {
+            EXPECT_EQ(Tracking.Get(GetEntityAt(i)).Value, Expected[i]);
+            EXPECT_EQ(Tracking.GetChangedTick(GetEntityAt(i)), i % 7u + 1u);
+        }
+
+        Tracking.Get(GetEntityAt(500u)).Value = Expected[500u] = 0u;
+    }
+}
+
+TEST_F(StorageTest, ParallelSortPermutesPayloadAndTicks)
+{
+    constexpr std::size_t EntitiesCount { egg::Containers::ParallelSortThreshold * 2u };
+
+    egg::Jobs::JobPool Pool { 3u };
+    egg::ECS::Containers::Storage<Tracked, EntityType> Tracking;
+
+    for (std::size_t i = 0u; i < EntitiesCount; ++i)
+    {
+        Tracking.SetCurrentTick(static_cast<egg::ECS::ChangeTick>(i % 7u + 1u));
+        Tracking.Emplace(GetEntityAt(i), (i * 7919u) % EntitiesCount);
+    }
+
+    Tracking.ParallelSort(std::less {}, Pool, [&Tracking](const EntityType Entity)
+    {
+        return Tracking.Get(Entity).Value;
+    });
+
+    std::size_t Expected {};
+
+    for (const EntityType Entity : Tracking)
+    {
+        ASSERT_EQ(Tracking.Get(Entity).Value, Expected++);
+    }
+
+    for (std::size_t i = 0u; i < EntitiesCount; ++i)
+    {
+        ASSERT_EQ(Tracking.Get(GetEntityAt(i)).Value, (i * 7919u) % EntitiesCount);
+        ASSERT_EQ(Tracking.GetChangedTick(GetEntityAt(i)), i % 7u + 1u);
+    }
+
+    std::size_t Visited {};
+    Tracking.EachChanged(6u, [&Visited](const EntityType Entity, const Tracked&)
+    {
+        EXPECT_EQ(EntityTraitsType::ToEntity(Entity) % 7u, 6u);
+        ++Visited;
+    });
+
+    EXPECT_EQ(Visited, (EntitiesCount + 1u) / 7u);
+}
+
+TEST_F(StorageTest, InPlaceDeleteKeepsPointersStable)
+{
+    egg::ECS::Containers::Storage<Stable, EntityType> Pinned;
+    static_assert(decltype(Pinned)::DeletesInPlace);
+
+    std::vector<const Stable*> Addresses;
+
+    for (std::size_t i = 0u; i < 10u; ++i)
+    {
+        Pinned.SetCurrentTick(static_cast<egg::ECS::ChangeTick>(i + 1u));
+        Addresses.push_back(&Pinned.Emplace(GetEntityAt(i), i));
+    }
+
+    Pinned.Erase(GetEntityAt(2u));
+    Pinned.Erase(GetEntityAt(9u));
+    Pinned.Erase(GetEntityAt(5u));
+
+    EXPECT_EQ(Pinned.GetSize(), 10u);
+    EXPECT_TRUE(Pinned.HasTombstones());
+    EXPECT_FALSE(Pinned.Contains(GetEntityAt(5u)));
+
+    for (std::size_t i = 0u; i < 10u; ++i)
+    {
+        if (i == 2u || i == 5u || i == 9u) continue;
+        EXPECT_EQ(&Pinned.Get(GetEntityAt(i)), Addresses[i]);
+    }
+
+    std::vector<std::size_t> Visited;
+
+    for (auto [Entity, Element] : Pinned.Each())
+    {
+        EXPECT_EQ(EntityTraitsType::ToEntity(Entity), Element.Value);
+        Visited.push_back(Element.Value);
+    }
+
+    for (auto [Entity, Element] : Pinned.EachReverse())
+    {
+        EXPECT_EQ(Visited.back(), Element.Value);
+        Visited.pop_back();
+    }
+
+    EXPECT_TRUE(Visited.empty());
+
+    Pinned.SetCurrentTick(50u);
+    EXPECT_EQ(&Pinned.Emplace(GetEntityAt(20u), 20u), Addresses[5u]);
+
+    Pinned.Compact();
+
+    EXPECT_EQ(Pinned.GetSize(), 8u);
+    EXPECT_FALSE(Pinned.HasTombstones());
+
+    for (std::size_t i = 0u; i < 9u; ++i)
+    {
+        if (i == 2u || i == 5u) continue;
+        EXPECT_LT(Pinned.GetIndex(GetEntityAt(i)), Pinned.GetSize());
+        EXPECT_EQ(Pinned.Get(GetEntityAt(i)).Value, i);
+        EXPECT_EQ(Pinned.GetChangedTick(GetEntityAt(i)), i + 1u);
+    }
+
+    EXPECT_EQ(Pinned.Get(GetEntityAt(20u)).Value, 20u);
+    EXPECT_EQ(Pinned.GetChangedTick(GetEntityAt(20u)), 50u);
+
+    std::size_t Changed {};
+    Pinned.EachChanged(7u, [&Changed](const EntityType, const Stable&) { ++Changed; });
+    EXPECT_EQ(Changed, 3u);
+}
+
+TEST_F(StorageTest, InPlaceDeleteDestroysEachElementOnce)
+{
+    {
+        egg::ECS::Containers::Storage<Counted, EntityType> Counting;
+
+        for (std::size_t i = 0u; i < 100u; ++i)
+        {
+            Counting.Emplace(GetEntityAt(i));
+        }
+
+        for (std::size_t i = 0u; i < 100u; i += 3u)
+        {
+            Counting.Erase(GetEntityAt(i));
+        }
+
+        EXPECT_EQ(Counted::Alive, 66u);
+
+        Counting.Compact();
+        EXPECT_EQ(Counted::Alive, 66u);
+        EXPECT_EQ(Counting.GetSize(), 66u);
+
+        for (std::size_t i = 1u; i < 100u; i += 3u)
+        {
+            Counting.Erase(GetEntityAt(i));
+        }
+
+        Counting.Clear();
+        EXPECT_EQ(Counted::Alive, 0u);
+        EXPECT_TRUE(Counting.Empty());
+
+        for (std::size_t i = 0u; i < 10u; ++i)
+        {
+            Counting.Emplace(GetEntityAt(i));
+        }
+
+        Counting.Erase(GetEntityAt(4u));
+        EXPECT_EQ(Counted::Alive, 9u);
+    }
+
+    EXPECT_EQ(Counted::Alive, 0u);
+}
+
+TEST_F(StorageTest, InsertTrivialRollsBackOnAllocationFailure)
+{
+    ExpectInsertRollsBack<Fixed>();
+    ExpectInsertRollsBack<Stable>();
+}
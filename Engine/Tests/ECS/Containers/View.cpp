@@ -0,0 +1,241 @@
+#include "../../Single.h"
+
+#include <ECS/Registry.h>
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstddef>
+#include <vector>
+
+namespace
+{
+    struct Position
+    {
+        float X;
+        float Y;
+    };
+
+    struct Velocity
+    {
+        float X;
+        float Y;
+    };
+
+    struct Frozen
+    {
+    };
+
+    struct Health
+    {
+        int Value;
+        static constexpr bool TrackChanges { true };
+    };
+}
+
+class ViewTest : public testing::Test
+{
+protected:
+    static constexpr std::size_t EntitiesCount { 1'000u };
+
+    ViewTest()
+    {
+        for (std::size_t i = 0u; i < EntitiesCount; ++i)
+        {
+            const EntityType Entity { Registry.Create() };
+            const float Value { static_cast<float>(i) };
+
+            Registry.Emplace<Position>(Entity, Value, Value);
+
+            if (i % 2u)
+            {
+                Registry.Emplace<Velocity>(Entity, 1.f, 2.f);
+            }
+
+            if (i % 3u == 0u)
+            {
+                Registry.Emplace<Frozen>(Entity);
+            }
+        }
+    }
+
+    static bool Matches(const EntityType Entity)
+    {
+        const std::size_t Index { EntityTraitsType::ToEntity(Entity) };
+        return Index % 2u && Index % 3u;
+    }
+
+    static constexpr std::size_t MatchesCount()
+    {
+        std::size_t Count {};
+        for (std::size_t i = 0u; i < EntitiesCount; ++i)
+        {
+            Count += i % 2u && i % 3u;
+        }
+        return Count;
+    }
+
+    egg::ECS::Registry<EntityType> Registry;
+};
+
+TEST_F(ViewTest, Iterate)
+{
+    const auto View { Registry.View<Position, const Velocity>(egg::ECS::Exclude<Frozen>) };
+    std::size_t Visited {};
+
+    for (auto It = View.Begin(); It != View.End(); ++It)
+    {
+        EXPECT_TRUE(Matches(*It));
+        EXPECT_TRUE(View.Contains(*It));
+        ++Visited;
+    }
+
+    EXPECT_EQ(Visited, MatchesCount());
+    EXPECT_EQ(View.GetSizeHint(), EntitiesCount / 2u);
+}
+
+TEST_F(ViewTest, Each)
+{
+    const auto View { Registry.View<Position, const Velocity>(egg::ECS::Exclude<Frozen>) };
+    std::size_t Visited {};
+
+    View.Each([&Visited](const EntityType Entity, Position& Current, const Velocity& Speed)
+    {
+        EXPECT_TRUE(Matches(Entity));
+        Current.X += Speed.X;
+        Current.Y += Speed.Y;
+        ++Visited;
+    });
+
+    EXPECT_EQ(Visited, MatchesCount());
+
+    View.Each([](const EntityType Entity, const Position& Current, const Velocity&)
+    {
+        const float Value { static_cast<float>(EntityTraitsType::ToEntity(Entity)) };
+        EXPECT_FLOAT_EQ(Current.X, Value + 1.f);
+        EXPECT_FLOAT_EQ(Current.Y, Value + 2.f);
+    });
+}
+
+TEST_F(ViewTest, EachLeadingEmptyElement)
+{
+    const auto View { Registry.View<Frozen, Position>() };
+    std::size_t Visited {};
+
+    View.Each([&Visited](const Position& Current)
+    {
+        EXPECT_EQ(static_cast<std::size_t>(Current.X) % 3u, 0u);
+        ++Visited;
+    });
+
+    EXPECT_EQ(Visited, (EntitiesCount + 2u) / 3u);
+}
+
+TEST_F(ViewTest, Get)
+{
+    const auto View { Registry.View<Position, Velocity>() };
+
+    for (const EntityType Entity : View)
+    {
+        auto [Current, Speed] { View.Get<Position, Velocity>(Entity) };
+        EXPECT_FLOAT_EQ(Current.X, static_cast<float>(EntityTraitsType::ToEntity(Entity)));
+        EXPECT_FLOAT_EQ(Speed.Y, 2.f);
+        EXPECT_EQ(&View.Get<Position>(Entity), &Registry.Get<Position>(Entity));
+    }
+}
+
+TEST_F(ViewTest, DoesNotReorderPools)
+{
+    std::vector<EntityType> Before(Registry.GetPoolFor<Position>().Begin(), Registry.GetPoolFor<Position>().End());
+
+    const auto View { Registry.View<Position, Velocity>() };
+    View.Each([](Position&, Velocity&) {});
+
+    const EntityType Entity { Registry.Create() };
+    Registry.Emplace<Velocity>(Entity, 0.f, 0.f);
+    Registry.Emplace<Position>(Entity, 0.f, 0.f);
+    Before.insert(Before.begin(), Entity);
+
+    const std::vector<EntityType> After(Registry.GetPoolFor<Position>().Begin(), Registry.GetPoolFor<Position>().End());
+    EXPECT_EQ(Before, After);
+    EXPECT_TRUE(View.Contains(Entity));
+}
+
+TEST_F(ViewTest, RuntimeView)
+{
+    using RegistryType = decltype(Registry);
+
+    const std::array Gets { RegistryType::GetPoolID<Position>(), RegistryType::GetPoolID<Velocity>() };
+    const std::array Excludes { RegistryType::GetPoolID<Frozen>() };
+
+    const auto View { Registry.RuntimeView(Gets, Excludes) };
+    std::size_t Visited {};
+
+    View.Each([&Visited, &View](const EntityType Entity)
+    {
+        EXPECT_TRUE(Matches(Entity));
+        EXPECT_TRUE(View.Contains(Entity));
+        ++Visited;
+    });
+
+    EXPECT_EQ(Visited, MatchesCount());
+    EXPECT_EQ(View.GetSizeHint(), EntitiesCount / 2u);
+}
+
+TEST_F(ViewTest, RuntimeViewMissingPool)
+{
+    struct Missing
+    {
+    };
+
+    using RegistryType = decltype(Registry);
+
+    const std::array Gets { RegistryType::GetPoolID<Position>(), RegistryType::GetPoolID<Missing>() };
+    const auto View { Registry.RuntimeView(Gets) };
+
+    EXPECT_EQ(View.Begin(), View.End());
+    EXPECT_EQ(View.GetSizeHint(), 0u);
+    EXPECT_FALSE(View.Contains(Registry.Create()));
+}
+
+TEST_F(ViewTest, EachChanged)
+{
+    for (const EntityType Entity : Registry.View<Position>())
+    {
+        Registry.Emplace<Health>(Entity, 10);
+    }
+
+    const egg::ECS::ChangeTick Since { Registry.GetChangeTick() };
+    Registry.AdvanceChangeTick();
+
+    const EntityType Patched { Registry.GetPoolFor<Position>()[5u] };
+    const EntityType Marked { Registry.GetPoolFor<Position>()[600u] };
+    Registry.Patch<Health>(Patched, [](Health& Current) { Current.Value = 0; });
+    Registry.MarkChanged<Health>(Marked);
+
+    std::vector<EntityType> Visited;
+    Registry.View<Health, const Position>(egg::ECS::Exclude<Frozen>).Each(
+        egg::ECS::Changed<Health>, Since, [&Visited](const EntityType Entity, Health&, const Position&)
+    {
+        Visited.push_back(Entity);
+    });
+
+    std::vector<EntityType> Expected;
+    for (const EntityType Entity : { Marked, Patched })
+    {
+        if (!Registry.GetPoolFor<Frozen>().Contains(Entity))
+        {
+            Expected.push_back(Entity);
+        }
+    }
+
+    EXPECT_EQ(Visited, Expected);
+    EXPECT_EQ(Registry.Get<Health>(Patched).Value, 0);
+
+    std::size_t Unchanged {};
+    Registry.View<const Health>().Each(egg::ECS::Changed<const Health>, Registry.GetChangeTick(), [&Unchanged](const Health&)
+    {
+        ++Unchanged;
+    });
+
+    EXPECT_EQ(Unchanged, 0u);
+}
@@ -0,0 +1,142 @@
+#include "../Single.h"
+
+#include <ECS/Registry.h>
+#include <gtest/gtest.h>
+#include <Memory/Constants.h>
+#include <Types/TypeInfo/TypeInfo.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+namespace
+{
+    struct Position
+    {
+        float X;
+        float Y;
+    };
+
+    struct Frozen
+    {
+    };
+}
+
+TEST(RegistryTest, CreateRange)
+{
+    egg::ECS::Registry<EntityType> Registry;
+    std::vector<EntityType> Entities(IterationsCount * 2u);
+
+    Registry.Create(Entities.begin(), Entities.end());
+
+    for (std::size_t i = 0u; i < Entities.size(); ++i)
+    {
+        EXPECT_TRUE(Registry.Valid(Entities[i]));
+        EXPECT_EQ(EntityTraitsType::ToEntity(Entities[i]), i);
+        EXPECT_EQ(EntityTraitsType::ToVersion(Entities[i]), 0u);
+    }
+
+    EXPECT_EQ(EntityTraitsType::ToEntity(Registry.Create()), Entities.size());
+}
+
+TEST(RegistryTest, CreateRangeRecycles)
+{
+    egg::ECS::Registry<EntityType> Registry;
+    std::vector<EntityType> Entities(IterationsCount);
+
+    Registry.Create(Entities.begin(), Entities.end());
+    Registry.Destroy(Entities.begin(), Entities.end());
+
+    for (const EntityType Entity : Entities)
+    {
+        EXPECT_FALSE(Registry.Valid(Entity));
+    }
+
+    std::vector<EntityType> Created(IterationsCount * 2u);
+    Registry.Create(Created.begin(), Created.end());
+
+    for (std::size_t i = 0u; i < Created.size(); ++i)
+    {
+        EXPECT_TRUE(Registry.Valid(Created[i]));
+        EXPECT_EQ(EntityTraitsType::ToVersion(Created[i]), i < IterationsCount ? 1u : 0u);
+    }
+
+    std::ranges::sort(Created, {}, [](const EntityType Entity) { return EntityTraitsType::ToEntity(Entity); });
+
+    for (std::size_t i = 0u; i < Created.size(); ++i)
+    {
+        EXPECT_EQ(EntityTraitsType::ToEntity(Created[i]), i);
+    }
+}
+
+TEST(RegistryTest, DestroyRange)
+{
+    egg::ECS::Registry<EntityType> Registry;
+    std::vector<EntityType> Entities(IterationsCount * 4u);
+
+    Registry.Create(Entities.begin(), Entities.end());
+
+    for (std::size_t i = 0u; i < Entities.size(); ++i)
+    {
+        Registry.Emplace<Position>(Entities[i], static_cast<float>(i), 0.f);
+
+        if (i % 2u)
+        {
+            Registry.Emplace<Frozen>(Entities[i]);
+        }
+    }
+
+    const auto Middle { Entities.begin() + static_cast<std::ptrdiff_t>(Entities.size() / 2u) };
+    Registry.Destroy(Entities.begin(), Middle);
+
+    for (auto It = Entities.begin(); It != Entities.end(); ++It)
+    {
+        const bool Alive { It >= Middle };
+        EXPECT_EQ(Registry.Valid(*It), Alive);
+        EXPECT_EQ(Registry.Contains<Position>(*It), Alive);
+    }
+
+    EXPECT_EQ(Registry.GetPoolFor<Position>().GetSize(), Entities.size() / 2u);
+    EXPECT_EQ(Registry.GetPoolFor<Frozen>().GetSize(), Entities.size() / 4u);
+
+    for (auto It = Middle; It != Entities.end(); ++It)
+    {
+        EXPECT_FLOAT_EQ(Registry.Get<Position>(*It).X, static_cast<float>(It - Entities.begin()));
+    }
+}
+
+TEST(RegistryTest, MemoryReport)
+{
+    egg::ECS::Registry<EntityType> Registry;
+    EXPECT_TRUE(Registry.MemoryReport().empty());
+
+    std::vector<EntityType> Entities(egg::Memory::PageSize<EntityType> + 1u);
+    Registry.Create(Entities.begin(), Entities.end());
+
+    for (const EntityType Entity : Entities)
+    {
+        Registry.Emplace<Position>(Entity, 0.f, 0.f);
+    }
+
+    Registry.Emplace<Frozen>(Entities.back());
+
+    const auto Report { Registry.MemoryReport() };
+    ASSERT_EQ(Report.size(), 2u);
+
+    const auto PositionReport { std::ranges::find(Report, egg::Types::TypeInfo<Position>::GetName(), &egg::ECS::PoolMemoryReport::Name) };
+    const auto FrozenReport { std::ranges::find(Report, egg::Types::TypeInfo<Frozen>::GetName(), &egg::ECS::PoolMemoryReport::Name) };
+
+    ASSERT_NE(PositionReport, Report.end());
+    ASSERT_NE(FrozenReport, Report.end());
+    EXPECT_TRUE(PositionReport->Name.ends_with("Position"));
+
+    const auto& Pool { Registry.GetPoolFor<Position>() };
+    EXPECT_EQ(PositionReport->Size, Entities.size());
+    EXPECT_EQ(PositionReport->Capacity, Pool.GetCapacity());
+    EXPECT_EQ(PositionReport->SparsePages, 2u);
+    EXPECT_EQ(PositionReport->Bytes, (Pool.GetExtent() + Pool.BaseType::GetCapacity()) * sizeof(EntityType) + Pool.GetCapacity() * sizeof(Position));
+
+    EXPECT_EQ(FrozenReport->Size, 1u);
+    EXPECT_EQ(FrozenReport->SparsePages, 2u);
+    EXPECT_EQ(FrozenReport->Bytes, (Registry.GetPoolFor<Frozen>().GetExtent() + Registry.GetPoolFor<Frozen>().GetCapacity()) * sizeof(EntityType));
+}
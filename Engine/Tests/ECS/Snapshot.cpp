@@ -0,0 +1,413 @@
+#include "../Single.h"
+
+#include <ECS/Registry.h>
+#include <ECS/Snapshot/Archive.h>
+#include <ECS/Snapshot/Cooker.h>
+#include <ECS/Snapshot/MappedLoader.h>
+#include <ECS/Snapshot/Snapshot.h>
+#include <ECS/Snapshot/SnapshotLoader.h>
+#include <gtest/gtest.h>
+#include <Memory/MappedFile/MappedFile.h>
+
+#include <array>
+#include <cstddef>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <span>
+#include <sstream>
+#include <stdexcept>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace
+{
+    struct Position
+    {
+        float X;
+        float Y;
+    };
+
+    struct Velocity
+    {
+        double X;
+        double Y;
+        double Z;
+    };
+
+    struct Dead
+    {
+    };
+
+    struct Anchored
+    {
+        explicit Anchored(const std::size_t Value) noexcept : Value { Value }
+        {
+        }
+
+        std::size_t Value;
+    };
+
+    struct Pinned
+    {
+        std::size_t Value;
+        static constexpr bool InPlaceDelete { true };
+    };
+
+    using RegistryType = egg::ECS::Registry<EntityType>;
+}
+
+class SnapshotTest : public testing::Test
+{
+protected:
+    static constexpr std::size_t EntitiesCount { 10'000u };
+
+    SnapshotTest()
+    {
+        Entities.resize(EntitiesCount);
+        Source.Create(Entities.begin(), Entities.end());
+
+        for (std::size_t i = 0u; i < EntitiesCount; i += 3u)
+        {
+            Source.Destroy(Entities[i]);
+            Entities[i] = Source.Create();
+        }
+
+        for (std::size_t i = 0u; i < EntitiesCount; i += 7u)
+        {
+            Source.Destroy(Entities[i]);
+        }
+
+        for (std::size_t i = 0u; i < EntitiesCount; ++i)
+        {
+            if (!Source.Valid(Entities[i]))
+            {
+                continue;
+            }
+
+            Source.Emplace<Position>(Entities[i], static_cast<float>(i), -static_cast<float>(i));
+
+            if (i % 2u)
+            {
+                Source.Emplace<Velocity>(Entities[i], 1.0, static_cast<double>(i), 3.0);
+            }
+
+            if (i % 5u == 0u)
+            {
+                Source.Emplace<Dead>(Entities[i]);
+            }
+        }
+    }
+
+    void ExpectEqual(const RegistryType& Target) const
+    {
+        for (std::size_t i = 0u; i < EntitiesCount; ++i)
+        {
+            const EntityType Entity { Entities[i] };
+
+            ASSERT_EQ(Target.Valid(Entity), Source.Valid(Entity));
+
+            if (!Source.Valid(Entity))
+            {
+                continue;
+            }
+
+            EXPECT_EQ(Target.Get<Position>(Entity).X, Source.Get<Position>(Entity).X);
+            EXPECT_EQ(Target.Contains<Velocity>(Entity), Source.Contains<Velocity>(Entity));
+            EXPECT_EQ(Target.Contains<Dead>(Entity), Source.Contains<Dead>(Entity));
+
+            if (Source.Contains<Velocity>(Entity))
+            {
+                EXPECT_EQ(Target.Get<Velocity>(Entity).Y, Source.Get<Velocity>(Entity).Y);
+            }
+        }
+    }
+
+    void ExpectEqualMapped(const RegistryType& Target) const
+    {
+        for (std::size_t i = 0u; i < EntitiesCount; ++i)
+        {
+            const EntityType Entity { Entities[i] };
+
+            ASSERT_EQ(Target.Valid(Entity), Source.Valid(Entity));
+
+            if (Source.Valid(Entity))
+            {
+                EXPECT_EQ(Target.Get<Position>(Entity).Y, Source.Get<Position>(Entity).Y);
+                EXPECT_EQ(Target.Contains<Dead>(Entity), Source.Contains<Dead>(Entity));
+            }
+        }
+    }
+
+    RegistryType Source;
+    std::vector<EntityType> Entities;
+};
+
+TEST_F(SnapshotTest, RoundTrip)
+{
+    egg::ECS::MemoryOutputArchive Output;
+    egg::ECS::Snapshot { Source }.Entities(Output).Elements<Position, Velocity, Dead>(Output);
+
+    RegistryType Target;
+    egg::ECS::MemoryInputArchive Input { Output.GetData() };
+    egg::ECS::SnapshotLoader { Target }.Entities(Input).Elements<Position, Velocity, Dead>(Input);
+
+    EXPECT_EQ(Input.GetRemaining(), 0u);
+    EXPECT_EQ(Target.GetRecycler().GetSize(), Source.GetRecycler().GetSize());
+    EXPECT_EQ(Target.GetRecycler().GetValidCount(), Source.GetRecycler().GetValidCount());
+    ExpectEqual(Target);
+
+    const EntityType Recycled { Target.Create() };
+    EXPECT_EQ(Recycled, Source.Create());
+}
+
+TEST_F(SnapshotTest, PartialLoad)
+{
+    egg::ECS::MemoryOutputArchive Output;
+    egg::ECS::Snapshot { Source }.Entities(Output).Elements<Position, Velocity, Dead>(Output);
+
+    RegistryType Target;
+    egg::ECS::MemoryInputArchive Input { Output.GetData() };
+    egg::ECS::SnapshotLoader { Target }.Entities(Input).Elements<Velocity>(Input);
+
+    EXPECT_EQ(Input.GetRemaining(), 0u);
+    EXPECT_EQ(Target.GetPoolFor<Velocity>().GetSize(), Source.GetPoolFor<Velocity>().GetSize());
+    EXPECT_TRUE(Target.GetPoolFor<Position>().Empty());
+    EXPECT_TRUE(Target.GetPoolFor<Dead>().Empty());
+}
+
+TEST_F(SnapshotTest, MappedLoad)
+{
+    egg::ECS::MemoryOutputArchive Output;
+    egg::ECS::Snapshot { Source }.Elements<Position, Dead>(Output);
+
+    RegistryType Target;
+    const EntityType Existing { Target.Create() };
+    Target.Emplace<Position>(Existing, 42.f, 42.f);
+
+    std::unordered_map<EntityType, EntityType> Mapping;
+
+    egg::ECS::MemoryInputArchive Input { Output.GetData() };
+    egg::ECS::SnapshotLoader { Target }.Elements<Position, Dead>(Input, [&Target, &Mapping](const EntityType Entity)
+    {
+        const auto [It, Inserted] { Mapping.try_emplace(Entity) };
+
+        if (Inserted)
+        {
+            It->second = Target.Create();
+        }
+
+        return It->second;
+    });
+
+    EXPECT_EQ(Target.Get<Position>(Existing).X, 42.f);
+    EXPECT_EQ(Target.GetPoolFor<Position>().GetSize(), Source.GetPoolFor<Position>().GetSize() + 1u);
+
+    for (const auto& [From, To] : Mapping)
+    {
+        EXPECT_EQ(Target.Get<Position>(To).X, Source.Get<Position>(From).X);
+        EXPECT_EQ(Target.Contains<Dead>(To), Source.Contains<Dead>(From));
+    }
+}
+
+TEST_F(SnapshotTest, StreamArchive)
+{
+    std::stringstream Stream;
+
+    egg::ECS::StreamOutputArchive Output { Stream };
+    egg::ECS::Snapshot { Source }.Entities(Output).Elements<Position, Velocity, Dead>(Output);
+
+    RegistryType Target;
+    egg::ECS::StreamInputArchive Input { Stream };
+    egg::ECS::SnapshotLoader { Target }.Entities(Input).Elements<Position, Velocity, Dead>(Input);
+
+    ExpectEqual(Target);
+}
+
+TEST_F(SnapshotTest, TruncatedArchive)
+{
+    egg::ECS::MemoryOutputArchive Output;
+    egg::ECS::Snapshot { Source }.Entities(Output).Elements<Position>(Output);
+
+    const auto Data { Output.GetData() };
+
+    RegistryType Target;
+    egg::ECS::MemoryInputArchive Input { Data.first(Data.size() / 2u) };
+
+    EXPECT_THROW(egg::ECS::SnapshotLoader { Target }.Entities(Input).Elements<Position>(Input), std::out_of_range);
+}
+
+TEST_F(SnapshotTest, MappedPages)
+{
+    const std::filesystem::path Path { std::filesystem::temp_directory_path() / "egg_snapshot_mapped.bin" };
+
+    {
+        std::ofstream Stream { Path, std::ios::binary };
+        egg::ECS::StreamOutputArchive Output { Stream };
+        egg::ECS::Cooker { Source }.Cook<Position, Velocity, Dead>(Output);
+    }
+
+    const auto File { std::make_shared<egg::Memory::MappedFile>(Path) };
+    const auto Mapping { File->GetData() };
+
+    {
+        RegistryType Target;
+        egg::ECS::MappedLoader { Target }.Load<Position, Dead>(File);
+
+        ExpectEqualMapped(Target);
+        EXPECT_TRUE(Target.GetPoolFor<Velocity>().Empty());
+
+        const auto* Element { reinterpret_cast<const std::byte*>(&Target.GetPoolFor<Position>().Get(Entities[1u])) };
+        EXPECT_GE(Element, Mapping.data());
+        EXPECT_LT(Element, Mapping.data() + Mapping.size());
+
+        Target.Get<Position>(Entities[1u]).X = -1.f;
+        Target.Destroy(Entities[2u]);
+
+        const EntityType Created { Target.Create() };
+        Target.Emplace<Position>(Created, 7.f, 7.f);
+
+        EXPECT_EQ(Target.Get<Position>(Entities[1u]).X, -1.f);
+        EXPECT_EQ(Target.Get<Position>(Created).X, 7.f);
+        EXPECT_EQ(Target.Get<Position>(Entities[4u]).X, 4.f);
+    }
+
+    EXPECT_EQ(File.use_count(), 1);
+
+    RegistryType Reloaded;
+    egg::ECS::MappedLoader { Reloaded }.Load<Position, Velocity, Dead>(std::make_shared<egg::Memory::MappedFile>(Path));
+    ExpectEqual(Reloaded);
+
+    std::filesystem::remove(Path);
+}
+
+TEST_F(SnapshotTest, MappedPagesAfterHeader)
+{
+    const std::filesystem::path Path { std::filesystem::temp_directory_path() / "egg_snapshot_mapped_header.bin" };
+    constexpr std::size_t HeaderSize { 24u };
+
+    {
+        std::ofstream Stream { Path, std::ios::binary };
+        const std::array<char, HeaderSize> Header {};
+        Stream.write(Header.data(), static_cast<std::streamsize>(Header.size()));
+
+        egg::ECS::StreamOutputArchive Output { Stream };
+        egg::ECS::Cooker { Source }.Cook<Position, Velocity, Dead>(Output, HeaderSize);
+    }
+
+    const auto File { std::make_shared<egg::Memory::MappedFile>(Path) };
+
+    {
+        RegistryType Target;
+        egg::ECS::MappedLoader { Target }.Load<Position, Velocity, Dead>(File, HeaderSize);
+
+        ExpectEqual(Target);
+
+        const std::byte* FirstPage {};
+        std::as_const(Target).GetPoolFor<Position>()->EachPage([&FirstPage](const std::span<const Position> Page)
+        {
+            FirstPage = FirstPage ? FirstPage : reinterpret_cast<const std::byte*>(Page.data());
+        });
+
+        EXPECT_EQ(static_cast<std::size_t>(FirstPage - File->GetData().data()) % egg::ECS::Cooker<RegistryType>::PageAlignment, 0u);
+    }
+
+    std::filesystem::remove(Path);
+}
+
+TEST_F(SnapshotTest, InPlaceHoles)
+{
+    for (std::size_t i = 0u; i < EntitiesCount; ++i)
+    {
+        if (Source.Valid(Entities[i]))
+        {
+            Source.Emplace<Pinned>(Entities[i], i);
+        }
+    }
+
+    for (std::size_t i = 0u; i < EntitiesCount; i += 4u)
+    {
+        if (Source.Valid(Entities[i]))
+        {
+            Source.Erase<Pinned>(Entities[i]);
+        }
+    }
+
+    ASSERT_TRUE(Source.GetPoolFor<Pinned>().HasTombstones());
+
+    const auto ExpectPinned { [this](const RegistryType& Target)
+    {
+        for (std::size_t i = 0u; i < EntitiesCount; ++i)
+        {
+            const EntityType Entity { Entities[i] };
+
+            ASSERT_EQ(Target.Contains<Pinned>(Entity), Source.Contains<Pinned>(Entity));
+
+            if (Source.Contains<Pinned>(Entity))
+            {
+                EXPECT_EQ(Target.Get<Pinned>(Entity).Value, i);
+            }
+        }
+
+        EXPECT_FALSE(Target.GetPoolFor<Pinned>()->HasTombstones());
+    } };
+
+    egg::ECS::MemoryOutputArchive Output;
+    egg::ECS::Snapshot { Source }.Entities(Output).Elements<Position, Pinned>(Output);
+
+    RegistryType Target;
+    egg::ECS::MemoryInputArchive Input { Output.GetData() };
+    egg::ECS::SnapshotLoader { Target }.Entities(Input).Elements<Position, Pinned>(Input);
+
+    EXPECT_EQ(Input.GetRemaining(), 0u);
+    ExpectPinned(Target);
+
+    const std::filesystem::path Path { std::filesystem::temp_directory_path() / "egg_snapshot_in_place.bin" };
+
+    {
+        std::ofstream Stream { Path, std::ios::binary };
+        egg::ECS::StreamOutputArchive Cooked { Stream };
+        egg::ECS::Cooker { Source }.Cook<Position, Pinned>(Cooked);
+    }
+
+    {
+        RegistryType Mapped;
+        egg::ECS::MappedLoader { Mapped }.Load<Position, Pinned>(std::make_shared<egg::Memory::MappedFile>(Path));
+        ExpectPinned(Mapped);
+    }
+
+    std::filesystem::remove(Path);
+}
+
+TEST_F(SnapshotTest, WithoutDefaultConstructor)
+{
+    static_assert(!std::is_default_constructible_v<Anchored>);
+
+    for (std::size_t i = 1u; i < EntitiesCount; i += 2u)
+    {
+        if (Source.Valid(Entities[i]))
+        {
+            Source.Emplace<Anchored>(Entities[i], i);
+        }
+    }
+
+    egg::ECS::MemoryOutputArchive Output;
+    egg::ECS::Snapshot { Source }.Entities(Output).Elements<Anchored>(Output);
+
+    RegistryType Target;
+    egg::ECS::MemoryInputArchive Input { Output.GetData() };
+    egg::ECS::SnapshotLoader { Target }.Entities(Input).Elements<Anchored>(Input);
+
+    EXPECT_EQ(Input.GetRemaining(), 0u);
+    EXPECT_EQ(Target.GetPoolFor<Anchored>().GetSize(), Source.GetPoolFor<Anchored>().GetSize());
+
+    for (std::size_t i = 1u; i < EntitiesCount; i += 2u)
+    {
+        if (Source.Valid(Entities[i]))
+        {
+            EXPECT_EQ(Target.Get<Anchored>(Entities[i]).Value, i);
+        }
+    }
+}
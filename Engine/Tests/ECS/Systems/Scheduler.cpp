@@ -0,0 +1,172 @@
+#include <ECS/Systems/System.h>
+#include <ECS/Systems/Scheduler/Scheduler.h>
+#include <gtest/gtest.h>
+#include <Jobs/JobPool/JobPool.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    struct Position
+    {
+    };
+
+    struct Velocity
+    {
+    };
+
+    class RecordingSystem : public egg::Systems::System
+    {
+    public:
+        explicit RecordingSystem(std::atomic<std::size_t>& Clock) : Clock { Clock }
+        {
+        }
+
+        void Initialize() override
+        {
+        }
+
+        void Update(float) override
+        {
+            Order = Clock.fetch_add(1u);
+            Thread = std::this_thread::get_id();
+            ++Updates;
+        }
+
+        void Terminate() override
+        {
+        }
+
+        template <typename... ComponentTypes>
+        RecordingSystem& WithReads()
+        {
+            Reads<ComponentTypes...>();
+            return *this;
+        }
+
+        template <typename... ComponentTypes>
+        RecordingSystem& WithWrites()
+        {
+            Writes<ComponentTypes...>();
+            return *this;
+        }
+
+        RecordingSystem& OnMainThread()
+        {
+            RunOnMainThread();
+            return *this;
+        }
+
+        std::atomic<std::size_t>& Clock;
+        std::size_t Order {};
+        std::size_t Updates {};
+        std::thread::id Thread {};
+    };
+}
+
+class SchedulerTest : public testing::Test
+{
+protected:
+    SchedulerTest() : Pool { 3u }, Scheduler { Pool }
+    {
+    }
+
+    RecordingSystem& Make()
+    {
+        return *Systems.emplace_back(std::make_unique<RecordingSystem>(Clock));
+    }
+
+    void AddAll()
+    {
+        for (const auto& Current : Systems)
+        {
+            Scheduler.Add(*Current);
+        }
+    }
+
+    std::atomic<std::size_t> Clock {};
+    std::vector<std::unique_ptr<RecordingSystem>> Systems;
+    egg::Jobs::JobPool Pool;
+    egg::Systems::Scheduler Scheduler;
+};
+
+TEST_F(SchedulerTest, BuildsDependencies)
+{
+    Make().WithWrites<Position>();
+    Make().WithReads<const Position>();
+    Make().WithReads<Position>().WithWrites<Velocity>();
+    Make().WithWrites<Position>();
+    Make().WithReads<Velocity>();
+    AddAll();
+    Scheduler.Build();
+
+    const auto Successors { [this](const std::size_t Index)
+    {
+        const auto Span { Scheduler.GetSuccessors(Index) };
+        return std::vector<std::size_t> { Span.begin(), Span.end() };
+    } };
+
+    EXPECT_EQ(Successors(0u), (std::vector<std::size_t> { 1u, 2u }));
+    EXPECT_EQ(Successors(1u), (std::vector<std::size_t> { 3u }));
+    EXPECT_EQ(Successors(2u), (std::vector<std::size_t> { 3u, 4u }));
+    EXPECT_TRUE(Successors(3u).empty());
+    EXPECT_TRUE(Successors(4u).empty());
+}
+
+TEST_F(SchedulerTest, UndeclaredSystemsAreExclusive)
+{
+    Make().WithWrites<Position>();
+    Make();
+    Make().WithWrites<Velocity>();
+    AddAll();
+    Scheduler.Update(0.f);
+
+    EXPECT_LT(Systems[0u]->Order, Systems[1u]->Order);
+    EXPECT_LT(Systems[1u]->Order, Systems[2u]->Order);
+    EXPECT_EQ(Systems[1u]->Thread, std::this_thread::get_id());
+}
+
+TEST_F(SchedulerTest, UpdateRespectsDependencies)
+{
+    constexpr std::size_t FramesCount { 100u };
+
+    Make().WithWrites<Position>();
+    Make().WithReads<Position>();
+    Make().WithReads<Position>();
+    Make().WithWrites<Position, Velocity>();
+    Make().WithReads<Velocity>().OnMainThread();
+    AddAll();
+
+    for (std::size_t Frame = 0u; Frame < FramesCount; ++Frame)
+    {
+        Scheduler.Update(0.f);
+
+        EXPECT_LT(Systems[0u]->Order, Systems[1u]->Order);
+        EXPECT_LT(Systems[0u]->Order, Systems[2u]->Order);
+        EXPECT_LT(Systems[1u]->Order, Systems[3u]->Order);
+        EXPECT_LT(Systems[2u]->Order, Systems[3u]->Order);
+        EXPECT_LT(Systems[3u]->Order, Systems[4u]->Order);
+        EXPECT_EQ(Systems[4u]->Thread, std::this_thread::get_id());
+    }
+
+    for (const auto& Current : Systems)
+    {
+        EXPECT_EQ(Current->Updates, FramesCount);
+    }
+}
+
+TEST_F(SchedulerTest, Clear)
+{
+    Make().WithWrites<Position>();
+    AddAll();
+    Scheduler.Clear();
+    Scheduler.Update(0.f);
+
+    EXPECT_EQ(Scheduler.GetSize(), 0u);
+    EXPECT_EQ(Systems[0u]->Updates, 0u);
+}
@@ -0,0 +1,177 @@
+#include <Events/ConnectionArgument.h>
+#include <Events/Delegate/InlineDelegate.h>
+#include <Events/Signal/Signal.h>
+#include <Events/Signal/Sink.h>
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstddef>
+#include <string>
+
+namespace
+{
+    struct Counter
+    {
+        void Add(const int Value)
+        {
+            Total += Value;
+        }
+
+        int Total;
+    };
+
+    int Twice(const int Value)
+    {
+        return Value * 2;
+    }
+
+    int AddPayload(const void* Payload, const int Value)
+    {
+        return *static_cast<const int*>(Payload) + Value;
+    }
+
+    struct Offset
+    {
+        int operator()(const int Value) const
+        {
+            return Value + Amount;
+        }
+
+        bool operator==(const Offset& Other) const
+        {
+            return Amount == Other.Amount;
+        }
+
+        int Amount;
+        int Hint;
+    };
+
+    using DelegateType = egg::Events::InlineDelegate<int(int)>;
+    using SignalType = egg::Events::Signal<void(int), std::allocator<void>, egg::Events::InlineDelegate<void(int)>>;
+}
+
+TEST(InlineDelegateTest, Layout)
+{
+    static_assert(std::is_trivially_copyable_v<DelegateType>);
+    static_assert(DelegateType::Storable<decltype([](int Value) { return Value; })>);
+    static_assert(!DelegateType::Storable<std::array<std::byte, DelegateType::StorageSize + 1u>>);
+    static_assert(!DelegateType::Storable<decltype([Text = std::string {}](int) { return 0; })>);
+
+    EXPECT_FALSE(DelegateType {});
+}
+
+TEST(InlineDelegateTest, OwnsFunctor)
+{
+    int Base { 40 };
+    const std::array<int, 4u> Values { 1, 2, 3, 4 };
+
+    DelegateType Delegate { [&Base, Values](const int Value) { return Base + Values[3u] + Value; } };
+
+    EXPECT_TRUE(Delegate.IsOwning());
+    EXPECT_EQ(Delegate.GetInstance(), nullptr);
+    EXPECT_EQ(Delegate(1), 45);
+
+    const DelegateType Copy { Delegate };
+    Delegate.Reset();
+    Base = 0;
+
+    EXPECT_FALSE(Delegate);
+    EXPECT_EQ(Copy(1), 5);
+}
+
+TEST(InlineDelegateTest, MutableFunctor)
+{
+    DelegateType Delegate { [Calls = 0](const int Value) mutable { return Value + ++Calls; } };
+
+    EXPECT_EQ(Delegate(0), 1);
+    EXPECT_EQ(Delegate(0), 2);
+}
+
+TEST(InlineDelegateTest, Candidates)
+{
+    const int Payload { 3 };
+    Counter Target {};
+
+    const DelegateType Free { egg::Events::ConnectionArgument<&Twice> };
+    const DelegateType Wrapped { &AddPayload, Payload };
+    const egg::Events::InlineDelegate<void(int)> Member { egg::Events::ConnectionArgument<&Counter::Add>, Target };
+
+    EXPECT_EQ(Free(4), 8);
+    EXPECT_EQ(Wrapped(4), 7);
+    EXPECT_EQ(Wrapped.GetInstance(), &Payload);
+    EXPECT_EQ(Member.GetInstance(), &Target);
+
+    Member(5);
+    EXPECT_EQ(Target.Total, 5);
+
+    EXPECT_EQ(Free, DelegateType { egg::Events::ConnectionArgument<&Twice> });
+    EXPECT_NE(Free, Wrapped);
+}
+
+TEST(InlineDelegateTest, SignalSlots)
+{
+    SignalType Signal;
+    egg::Events::Sink<SignalType> Sink { Signal };
+    Counter Target {};
+    int Sum {};
+
+    Sink.Connect<&Counter::Add>(Target);
+    const auto Connection { Sink.Connect([&Sum](const int Value) { Sum += Value * 10; }) };
+
+    EXPECT_EQ(Signal.GetSize(), 2u);
+
+    Signal.Publish(2);
+
+    EXPECT_EQ(Target.Total, 2);
+    EXPECT_EQ(Sum, 20);
+
+    Connection();
+    Signal.Publish(1);
+
+    EXPECT_EQ(Signal.GetSize(), 1u);
+    EXPECT_EQ(Target.Total, 3);
+    EXPECT_EQ(Sum, 20);
+
+    Sink.Disconnect(Target);
+    EXPECT_TRUE(Signal.Empty());
+}
+
+TEST(InlineDelegateTest, FunctorEquality)
+{
+    const int Base { 2 };
+    const auto Lambda { [Base](const int Value) { return Base + Value; } };
+
+    const DelegateType First { Lambda };
+    const DelegateType Second { Lambda };
+    const DelegateType Copy { First };
+
+    EXPECT_EQ(First, Copy);
+    EXPECT_NE(First, Second);
+
+    const DelegateType One { Offset { 1, 0 } };
+
+    EXPECT_EQ(One, DelegateType(Offset { 1, 7 }));
+    EXPECT_NE(One, DelegateType(Offset { 2, 0 }));
+    EXPECT_NE(One, First);
+}
+
+TEST(InlineDelegateTest, DisconnectOwnedSlots)
+{
+    SignalType Signal;
+    egg::Events::Sink<SignalType> Sink { Signal };
+    int Sum {};
+
+    const auto Lambda { [&Sum](const int Value) { Sum += Value; } };
+
+    const auto First { Sink.Connect(Lambda) };
+    Sink.Connect(Lambda);
+
+    First();
+    Signal.Publish(1);
+
+    EXPECT_EQ(Signal.GetSize(), 1u);
+    EXPECT_EQ(Sum, 1);
+
+    Sink.Disconnect(egg::Events::InlineDelegate<void(int)> { Lambda });
+    EXPECT_EQ(Signal.GetSize(), 1u);
+}
@@ -0,0 +1,371 @@
+#include <Events/Dispatcher.h>
+#include <Events/EventLoop/EventLoop.h>
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <cstddef>
+#include <span>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace
+{
+    struct Message
+    {
+        std::size_t Producer;
+        std::size_t Sequence;
+    };
+
+    struct Named
+    {
+        std::string Value;
+    };
+
+    struct Collector
+    {
+        void Receive(const Message& Event)
+        {
+            Received.push_back(Event);
+        }
+
+        std::vector<Message> Received;
+    };
+
+    struct BatchCollector
+    {
+        void Receive(const std::span<const Message> Events)
+        {
+            Batches.push_back(Events.size());
+            Received.insert(Received.end(), Events.begin(), Events.end());
+        }
+
+        std::vector<std::size_t> Batches;
+        std::vector<Message> Received;
+    };
+
+    struct Forwarder
+    {
+        void Receive(const Message& Event)
+        {
+            Received.push_back(Event);
+
+            if (Event.Producer != 0u)
+            {
+                Loop->Enqueue(Event.Producer - 1u, Event.Sequence);
+            }
+        }
+
+        egg::Events::EventLoop<Message>* Loop;
+        std::vector<Message> Received;
+    };
+
+    struct Republisher
+    {
+        void Receive(const Message& Event)
+        {
+            Received.push_back(Event);
+
+            if (Event.Producer != 0u)
+            {
+                Loop->Enqueue(Event.Producer - 1u, Event.Sequence);
+            }
+
+            Loop->Publish();
+        }
+
+        egg::Events::EventLoop<Message>* Loop;
+        std::vector<Message> Received;
+    };
+
+    struct NameCollector
+    {
+        void Receive(const Named& Event)
+        {
+            Received.push_back(Event.Value);
+        }
+
+        std::vector<std::string> Received;
+    };
+}
+
+class EventLoopTest : public testing::Test
+{
+protected:
+    static constexpr std::size_t ProducersCount { 8u };
+    static constexpr std::size_t EventsPerProducer { 50'000u };
+
+    EventLoopTest()
+    {
+        Loop.GetSink().Connect<&Collector::Receive>(Listener);
+    }
+
+    egg::Events::EventLoop<Message> Loop;
+    Collector Listener;
+};
+
+TEST_F(EventLoopTest, EnqueueConcurrentPublishes)
+{
+    Loop.EnqueueConcurrent(0u, 1u);
+    Loop.EnqueueConcurrent(Message { 0u, 2u });
+    Loop.Enqueue(1u, 0u);
+
+    EXPECT_EQ(Loop.GetSize(), 3u);
+    EXPECT_TRUE(Listener.Received.empty());
+
+    Loop.Publish();
+
+    ASSERT_EQ(Listener.Received.size(), 3u);
+    EXPECT_EQ(Listener.Received[0].Producer, 1u);
+    EXPECT_EQ(Listener.Received[1].Sequence, 1u);
+    EXPECT_EQ(Listener.Received[2].Sequence, 2u);
+    EXPECT_EQ(Loop.GetSize(), 0u);
+}
+
+TEST_F(EventLoopTest, ReentrantEnqueueDeferred)
+{
+    Forwarder Forwarding { &Loop, {} };
+    Loop.GetSink().Connect<&Forwarder::Receive>(Forwarding);
+
+    Loop.Enqueue(2u, 0u);
+    Loop.Enqueue(0u, 1u);
+    Loop.Enqueue(1u, 2u);
+
+    Loop.Publish();
+
+    ASSERT_EQ(Forwarding.Received.size(), 3u);
+    EXPECT_EQ(Loop.GetSize(), 2u);
+
+    Loop.Publish();
+
+    ASSERT_EQ(Forwarding.Received.size(), 5u);
+    EXPECT_EQ(Forwarding.Received[3].Sequence, 0u);
+    EXPECT_EQ(Forwarding.Received[3].Producer, 1u);
+    EXPECT_EQ(Forwarding.Received[4].Sequence, 2u);
+    EXPECT_EQ(Forwarding.Received[4].Producer, 0u);
+    EXPECT_EQ(Loop.GetSize(), 1u);
+
+    Loop.Publish();
+
+    EXPECT_EQ(Forwarding.Received.size(), 6u);
+    EXPECT_EQ(Loop.GetSize(), 0u);
+}
+
+TEST_F(EventLoopTest, ReentrantPublishDeferred)
+{
+    Republisher Republishing { &Loop, {} };
+    Loop.GetSink().Connect<&Republisher::Receive>(Republishing);
+
+    Loop.Enqueue(1u, 0u);
+    Loop.Enqueue(1u, 1u);
+
+    Loop.Publish();
+
+    ASSERT_EQ(Republishing.Received.size(), 2u);
+    ASSERT_EQ(Listener.Received.size(), 2u);
+    EXPECT_EQ(Listener.Received[1].Sequence, 1u);
+    EXPECT_EQ(Loop.GetSize(), 2u);
+
+    Loop.Publish();
+
+    ASSERT_EQ(Republishing.Received.size(), 4u);
+    EXPECT_EQ(Republishing.Received[2].Producer, 0u);
+    EXPECT_EQ(Republishing.Received[3].Sequence, 1u);
+    EXPECT_EQ(Listener.Received.size(), 4u);
+    EXPECT_EQ(Loop.GetSize(), 0u);
+}
+
+TEST_F(EventLoopTest, BatchSinkReceivesQueuedRange)
+{
+    BatchCollector Batch;
+    Loop.GetBatchSink().Connect<&BatchCollector::Receive>(Batch);
+
+    Loop.Publish();
+    EXPECT_TRUE(Batch.Batches.empty());
+
+    for (std::size_t Sequence = 0u; Sequence < 100u; ++Sequence)
+    {
+        Loop.Enqueue(0u, Sequence);
+    }
+
+    Loop.Publish();
+
+    ASSERT_EQ(Batch.Batches.size(), 1u);
+    EXPECT_EQ(Batch.Batches.front(), 100u);
+    EXPECT_EQ(Listener.Received.size(), 100u);
+
+    for (std::size_t Sequence = 0u; Sequence < 100u; ++Sequence)
+    {
+        EXPECT_EQ(Batch.Received[Sequence].Sequence, Sequence);
+    }
+
+    Loop.Trigger(Message { 1u, 7u });
+
+    ASSERT_EQ(Batch.Batches.size(), 2u);
+    EXPECT_EQ(Batch.Batches.back(), 1u);
+    EXPECT_EQ(Batch.Received.back().Sequence, 7u);
+    EXPECT_EQ(Listener.Received.back().Sequence, 7u);
+
+    Loop.GetBatchSink().Disconnect<&BatchCollector::Receive>(Batch);
+    Loop.Enqueue(0u, 0u);
+    Loop.Publish();
+
+    EXPECT_EQ(Batch.Batches.size(), 2u);
+    EXPECT_EQ(Listener.Received.size(), 102u);
+}
+
+TEST_F(EventLoopTest, EnqueueConcurrentSpansSegments)
+{
+    for (std::size_t Sequence = 0u; Sequence < EventsPerProducer; ++Sequence)
+    {
+        Loop.EnqueueConcurrent(0u, Sequence);
+
+        if (Sequence % 1'000u == 0u)
+        {
+            Loop.Publish();
+        }
+    }
+
+    Loop.Publish();
+
+    ASSERT_EQ(Listener.Received.size(), EventsPerProducer);
+
+    for (std::size_t Sequence = 0u; Sequence < EventsPerProducer; ++Sequence)
+    {
+        EXPECT_EQ(Listener.Received[Sequence].Sequence, Sequence);
+    }
+}
+
+TEST_F(EventLoopTest, ConcurrentProducers)
+{
+    std::atomic<std::size_t> Finished {};
+    std::vector<std::jthread> Producers;
+
+    for (std::size_t Producer = 0u; Producer < ProducersCount; ++Producer)
+    {
+        Producers.emplace_back([this, Producer, &Finished]
+        {
+            for (std::size_t Sequence = 0u; Sequence < EventsPerProducer; ++Sequence)
+            {
+                Loop.EnqueueConcurrent(Producer, Sequence);
+            }
+
+            Finished.fetch_add(1u, std::memory_order_release);
+        });
+    }
+
+    while (Finished.load(std::memory_order_acquire) != ProducersCount)
+    {
+        Loop.Publish();
+    }
+
+    Producers.clear();
+    Loop.Publish();
+
+    ASSERT_EQ(Listener.Received.size(), ProducersCount * EventsPerProducer);
+
+    std::vector<std::size_t> Expected(ProducersCount);
+
+    for (const Message& Event : Listener.Received)
+    {
+        ASSERT_LT(Event.Producer, ProducersCount);
+        EXPECT_EQ(Event.Sequence, Expected[Event.Producer]++);
+    }
+}
+
+TEST_F(EventLoopTest, ClearDiscardsConcurrentEvents)
+{
+    std::jthread { [this]
+    {
+        Loop.EnqueueConcurrent(1u, 0u);
+        Loop.EnqueueConcurrent(1u, 1u);
+    } };
+
+    Loop.EnqueueConcurrent(0u, 0u);
+
+    EXPECT_EQ(Loop.GetSize(), 3u);
+
+    Loop.Clear();
+    Loop.Publish();
+
+    EXPECT_EQ(Loop.GetSize(), 0u);
+    EXPECT_TRUE(Listener.Received.empty());
+}
+
+TEST_F(EventLoopTest, MoveKeepsConcurrentEvents)
+{
+    Loop.EnqueueConcurrent(0u, 0u);
+
+    egg::Events::EventLoop<Message> Other { std::move(Loop) };
+    Other.EnqueueConcurrent(0u, 1u);
+    Other.Publish();
+
+    ASSERT_EQ(Listener.Received.size(), 2u);
+    EXPECT_EQ(Listener.Received[1].Sequence, 1u);
+
+    Loop.EnqueueConcurrent(0u, 2u);
+    EXPECT_EQ(Loop.GetSize(), 1u);
+    EXPECT_EQ(Other.GetSize(), 0u);
+}
+
+TEST_F(EventLoopTest, ConcurrentNonTrivialEvents)
+{
+    egg::Events::EventLoop<Named> Names;
+    NameCollector Collected;
+    Names.GetSink().Connect<&NameCollector::Receive>(Collected);
+
+    std::jthread { [&Names]
+    {
+        for (std::size_t Index = 0u; Index < 1'000u; ++Index)
+        {
+            Names.EnqueueConcurrent(std::string(32u, 'a') + std::to_string(Index));
+        }
+    } };
+
+    Names.Publish();
+    Names.EnqueueConcurrent(std::string(32u, 'b'));
+
+    ASSERT_EQ(Collected.Received.size(), 1'000u);
+    EXPECT_EQ(Collected.Received.back(), std::string(32u, 'a') + "999");
+    EXPECT_EQ(Names.GetSize(), 1u);
+}
+
+class DispatcherTest : public testing::Test
+{
+protected:
+    egg::Events::Dispatcher<> Dispatcher;
+};
+
+TEST_F(DispatcherTest, EnqueueConcurrent)
+{
+    Collector Listener;
+    Dispatcher.GetSink<Message>().Connect<&Collector::Receive>(Listener);
+
+    std::jthread { [this]
+    {
+        Dispatcher.EnqueueConcurrent<Message>(1u, 0u);
+        Dispatcher.EnqueueConcurrent(Message { 1u, 1u });
+    } };
+
+    EXPECT_EQ(Dispatcher.GetSize<Message>(), 2u);
+
+    Dispatcher.Update();
+
+    ASSERT_EQ(Listener.Received.size(), 2u);
+    EXPECT_EQ(Listener.Received[1].Sequence, 1u);
+}
+
+TEST_F(DispatcherTest, BatchSink)
+{
+    BatchCollector Listener;
+    Dispatcher.GetBatchSink<Message>().Connect<&BatchCollector::Receive>(Listener);
+
+    Dispatcher.Enqueue<Message>(0u, 0u);
+    Dispatcher.Enqueue<Message>(0u, 1u);
+    Dispatcher.Update();
+
+    ASSERT_EQ(Listener.Batches.size(), 1u);
+    EXPECT_EQ(Listener.Batches.front(), 2u);
+    EXPECT_EQ(Listener.Received[1].Sequence, 1u);
+}
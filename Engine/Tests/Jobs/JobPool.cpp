@@ -0,0 +1,114 @@
+#include <gtest/gtest.h>
+#include <Jobs/JobPool/JobPool.h>
+
+#include <atomic>
+#include <cstddef>
+#include <numeric>
+#include <vector>
+
+class JobPoolTest : public testing::Test
+{
+protected:
+    static constexpr std::size_t ElementsCount { 100'000u };
+
+    JobPoolTest() : Pool { 3u }, Values(ElementsCount)
+    {
+        std::iota(Values.begin(), Values.end(), std::size_t {});
+    }
+
+    egg::Jobs::JobPool Pool;
+    std::vector<std::size_t> Values;
+};
+
+TEST_F(JobPoolTest, Concurrency)
+{
+    EXPECT_EQ(Pool.GetWorkersCount(), 3u);
+    EXPECT_EQ(Pool.GetConcurrency(), 4u);
+}
+
+TEST_F(JobPoolTest, ParallelForCoversRange)
+{
+    std::vector<std::atomic<std::size_t>> Visits(ElementsCount);
+
+    Pool.ParallelFor(ElementsCount, 97u, [&Visits](const std::size_t First, const std::size_t Last)
+    {
+        for (std::size_t i = First; i < Last; ++i)
+        {
+            Visits[i].fetch_add(1u, std::memory_order_relaxed);
+        }
+    });
+
+    for (const auto& Visit : Visits)
+    {
+        EXPECT_EQ(Visit.load(), 1u);
+    }
+}
+
+TEST_F(JobPoolTest, ParallelForEmptyRange)
+{
+    bool Invoked { false };
+
+    Pool.ParallelFor(0u, 16u, [&Invoked](std::size_t, std::size_t)
+    {
+        Invoked = true;
+    });
+
+    EXPECT_FALSE(Invoked);
+}
+
+TEST_F(JobPoolTest, ParallelForNested)
+{
+    std::atomic<std::size_t> Sum {};
+
+    Pool.ParallelFor(ElementsCount, ElementsCount / 8u, [this, &Sum](const std::size_t First, const std::size_t Last)
+    {
+        Pool.ParallelFor(Last - First, 1024u, [this, First, &Sum](const std::size_t InnerFirst, const std::size_t InnerLast)
+        {
+            Sum.fetch_add(std::accumulate(
+                Values.begin() + First + InnerFirst,
+                Values.begin() + First + InnerLast,
+                std::size_t {}
+            ), std::memory_order_relaxed);
+        });
+    });
+
+    EXPECT_EQ(Sum.load(), ElementsCount * (ElementsCount - 1u) / 2u);
+}
+
+TEST_F(JobPoolTest, Submit)
+{
+    std::vector<std::size_t> Squares(ElementsCount);
+    egg::Jobs::JobPool::CounterType Counter {};
+
+    auto Square { [&Squares](const std::size_t Argument)
+    {
+        Squares[Argument] = Argument * Argument;
+    } };
+
+    Pool.Submit(egg::Jobs::JobPool::JobType { +[](const void* Payload, const std::size_t Argument)
+    {
+        (*static_cast<const decltype(Square)*>(Payload))(Argument);
+    }, Square }, 0u, ElementsCount, Counter);
+    Pool.Wait(Counter);
+
+    EXPECT_EQ(Counter.load(), 0u);
+
+    for (std::size_t i = 0u; i < ElementsCount; ++i)
+    {
+        EXPECT_EQ(Squares[i], i * i);
+    }
+}
+
+TEST_F(JobPoolTest, WithoutWorkers)
+{
+    egg::Jobs::JobPool Inline { 0u };
+    std::size_t Count {};
+
+    Inline.ParallelFor(1000u, 10u, [&Count](const std::size_t First, const std::size_t Last)
+    {
+        Count += Last - First;
+    });
+
+    EXPECT_EQ(Inline.GetConcurrency(), 1u);
+    EXPECT_EQ(Count, 1000u);
+}
@@ -0,0 +1,198 @@
+#include "../Single.h"
+
+#include <ECS/Registry.h>
+#include <Events/EventLoop/EventLoop.h>
+#include <gtest/gtest.h>
+#include <Memory/FrameArena/ArenaAllocator.h>
+#include <Memory/FrameArena/FrameArena.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    struct Position
+    {
+        float X;
+        float Y;
+    };
+
+    struct alignas(128) Wide
+    {
+        std::byte Data[128];
+    };
+
+    struct Frozen
+    {
+    };
+}
+
+TEST(FrameArenaTest, AllocateAligned)
+{
+    egg::Memory::FrameArena Arena;
+
+    for (const std::size_t Alignment : { 1u, 2u, 8u, 64u, 256u, 4096u })
+    {
+        void* const Pointer { Arena.Allocate(3u, Alignment) };
+        EXPECT_EQ(reinterpret_cast<std::uintptr_t>(Pointer) % Alignment, 0u);
+    }
+
+    EXPECT_EQ(Arena.GetBlocksCount(), 1u);
+}
+
+TEST(FrameArenaTest, DeallocateRollsBackLast)
+{
+    egg::Memory::FrameArena Arena;
+
+    void* const First { Arena.Allocate(64u, 8u) };
+    void* const Second { Arena.Allocate(64u, 8u) };
+
+    Arena.Deallocate(First, 64u);
+    EXPECT_EQ(Arena.Allocate(64u, 8u), static_cast<std::byte*>(Second) + 64u);
+
+    Arena.Deallocate(static_cast<std::byte*>(Second) + 64u, 64u);
+    Arena.Deallocate(Second, 64u);
+    EXPECT_EQ(Arena.Allocate(64u, 8u), Second);
+}
+
+TEST(FrameArenaTest, DeallocateKeepsUsedBalanced)
+{
+    egg::Memory::FrameArena Arena;
+
+    static_cast<void>(Arena.Allocate(1u, 1u));
+
+    for (std::size_t i = 0u; i < 16u; ++i)
+    {
+        void* const Padded { Arena.Allocate(64u, 64u) };
+        EXPECT_EQ(Arena.GetUsed(), 65u);
+
+        Arena.Deallocate(Padded, 64u);
+        EXPECT_EQ(Arena.GetUsed(), 1u);
+    }
+}
+
+TEST(FrameArenaTest, ResetCoalescesBlocks)
+{
+    egg::Memory::FrameArena Arena { 1024u };
+
+    for (std::size_t i = 0u; i < 64u; ++i)
+    {
+        static_cast<void>(Arena.Allocate(256u, 16u));
+    }
+
+    EXPECT_GT(Arena.GetBlocksCount(), 1u);
+
+    Arena.Reset();
+    EXPECT_EQ(Arena.GetUsed(), 0u);
+
+    for (std::size_t Frame = 0u; Frame < 3u; ++Frame)
+    {
+        void* const First { Arena.Allocate(256u, 16u) };
+
+        for (std::size_t i = 1u; i < 64u; ++i)
+        {
+            static_cast<void>(Arena.Allocate(256u, 16u));
+        }
+
+        EXPECT_EQ(Arena.GetBlocksCount(), 1u);
+
+        const std::size_t Capacity { Arena.GetCapacity() };
+        Arena.Reset();
+
+        EXPECT_EQ(Arena.GetCapacity(), Capacity);
+        EXPECT_EQ(Arena.Allocate(256u, 16u), First);
+        Arena.Reset();
+    }
+}
+
+TEST(FrameArenaTest, ThreadArenas)
+{
+    egg::Memory::FrameArena* Local { &egg::Memory::FrameArena::GetThreadArena() };
+    egg::Memory::FrameArena* Remote {};
+
+    std::jthread { [&Remote]
+    {
+        Remote = &egg::Memory::FrameArena::GetThreadArena();
+    } };
+
+    EXPECT_EQ(Local, &egg::Memory::FrameArena::GetThreadArena());
+    EXPECT_NE(Local, Remote);
+    EXPECT_EQ(egg::Memory::ArenaAllocator<int> {}.GetArena(), Local);
+}
+
+TEST(FrameArenaTest, ContainerAllocator)
+{
+    egg::Memory::FrameArena Arena;
+    const egg::Memory::ArenaAllocator<Wide> Allocator { Arena };
+
+    std::vector<Wide, egg::Memory::ArenaAllocator<Wide>> Values { Allocator };
+    Values.resize(100u);
+
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(Values.data()) % alignof(Wide), 0u);
+    EXPECT_EQ(Values.get_allocator(), egg::Memory::ArenaAllocator<int> { Arena });
+    EXPECT_NE(Values.get_allocator(), egg::Memory::ArenaAllocator<int> {});
+    EXPECT_GE(Arena.GetUsed(), 100u * sizeof(Wide));
+}
+
+TEST(FrameArenaTest, Registry)
+{
+    using AllocatorType = egg::Memory::ArenaAllocator<EntityType>;
+
+    egg::Memory::FrameArena Arena;
+
+    for (std::size_t Frame = 0u; Frame < 3u; ++Frame)
+    {
+        {
+            egg::ECS::Registry<EntityType, AllocatorType> Registry { AllocatorType { Arena } };
+            std::vector<EntityType> Entities(1'000u);
+
+            Registry.Create(Entities.begin(), Entities.end());
+
+            for (std::size_t i = 0u; i < Entities.size(); ++i)
+            {
+                Registry.Emplace<Position>(Entities[i], static_cast<float>(i), 0.0f);
+
+                if (i % 2u)
+                {
+                    Registry.Emplace<Frozen>(Entities[i]);
+                }
+            }
+
+            Registry.Destroy(Entities[0u]);
+
+            std::size_t Count {};
+            float Sum {};
+
+            Registry.View<Position>(egg::ECS::Exclude<Frozen>).Each([&Count, &Sum](const Position& Current)
+            {
+                ++Count;
+                Sum += Current.X;
+            });
+
+            EXPECT_EQ(Count, 499u);
+            EXPECT_FLOAT_EQ(Sum, 249'500.0f);
+            EXPECT_EQ(Registry.GetAllocator().GetArena(), &Arena);
+        }
+
+        EXPECT_GT(Arena.GetUsed(), 0u);
+        Arena.Reset();
+    }
+
+    EXPECT_EQ(Arena.GetBlocksCount(), 1u);
+}
+
+TEST(FrameArenaTest, EventLoop)
+{
+    egg::Memory::FrameArena Arena;
+    egg::Events::EventLoop<Position, egg::Memory::ArenaAllocator<Position>> Loop {
+        egg::Memory::ArenaAllocator<Position> { Arena }
+    };
+
+    Loop.Enqueue(1.0f, 2.0f);
+    Loop.Enqueue(3.0f, 4.0f);
+
+    EXPECT_EQ(Loop.GetSize(), 2u);
+    EXPECT_GT(Arena.GetUsed(), 0u);
+}
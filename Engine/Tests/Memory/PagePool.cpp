@@ -0,0 +1,238 @@
+#include "../Single.h"
+
+#include <ECS/Containers/Storage/Storage.h>
+#include <ECS/Registry.h>
+#include <gtest/gtest.h>
+#include <Memory/PagePool/PagePool.h>
+#include <Memory/PagePool/PagePoolAllocator.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    struct Position
+    {
+        float X;
+        float Y;
+        float Z;
+    };
+
+    constexpr std::size_t PagesCount { 40u };
+}
+
+TEST(PagePoolTest, RecyclesBlocks)
+{
+    egg::Memory::PagePool Pool;
+
+    void* const First { Pool.Allocate() };
+    void* const Second { Pool.Allocate() };
+
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(First) % egg::Memory::PagePool::BlockAlignment, 0u);
+    EXPECT_NE(First, Second);
+
+    Pool.Deallocate(First);
+    EXPECT_EQ(Pool.Allocate(), First);
+
+    const egg::Memory::PagePoolStatistics Statistics { Pool.GetStatistics() };
+    EXPECT_EQ(Statistics.Reserved, egg::Memory::PagePool::RegularSlabSize);
+    EXPECT_EQ(Statistics.Held, 2u);
+    EXPECT_EQ(Statistics.InUse, 2u);
+    EXPECT_EQ(Statistics.Acquired, 3u);
+    EXPECT_EQ(Statistics.Reused, 1u);
+
+    Pool.Deallocate(First);
+    Pool.Deallocate(Second);
+    EXPECT_EQ(Pool.GetStatistics().InUse, 0u);
+}
+
+TEST(PagePoolTest, GrowsSlabs)
+{
+    egg::Memory::PagePool Pool;
+    std::vector<void*> Blocks;
+
+    for (std::size_t i = 0u; i < PagesCount; ++i)
+    {
+        Blocks.push_back(Pool.Allocate());
+    }
+
+    const egg::Memory::PagePoolStatistics Statistics { Pool.GetStatistics() };
+    EXPECT_EQ(Statistics.Held, PagesCount);
+    EXPECT_EQ(Statistics.Reserved % egg::Memory::PagePool::RegularSlabSize, 0u);
+    EXPECT_GE(Statistics.Reserved, PagesCount * egg::Memory::PagePool::BlockSize);
+
+    for (void* const Block : Blocks)
+    {
+        Pool.Deallocate(Block);
+    }
+}
+
+TEST(PagePoolTest, PacksSlabs)
+{
+    constexpr std::size_t BlocksPerSlab { egg::Memory::PagePool::RegularSlabSize / egg::Memory::PagePool::BlockSize };
+
+    egg::Memory::PagePool Pool;
+    std::vector<std::byte*> Blocks;
+
+    for (std::size_t i = 0u; i < BlocksPerSlab; ++i)
+    {
+        Blocks.push_back(static_cast<std::byte*>(Pool.Allocate()));
+    }
+
+    EXPECT_EQ(Pool.GetStatistics().Reserved, egg::Memory::PagePool::RegularSlabSize);
+
+    for (std::size_t i = 1u; i < BlocksPerSlab; ++i)
+    {
+        EXPECT_EQ(Blocks[i] - Blocks[i - 1u], static_cast<std::ptrdiff_t>(egg::Memory::PagePool::BlockSize));
+    }
+
+    for (std::byte* const Block : Blocks)
+    {
+        Pool.Deallocate(Block);
+    }
+}
+
+TEST(PagePoolTest, HugeBacking)
+{
+    egg::Memory::PagePool Pool { egg::Memory::PagePool::Backing::Huge };
+
+    void* const Block { Pool.Allocate() };
+
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(Block) % egg::Memory::PagePool::HugeSlabSize, 0u);
+    EXPECT_EQ(Pool.GetStatistics().Reserved, egg::Memory::PagePool::HugeSlabSize);
+    EXPECT_EQ(Pool.GetBacking(), egg::Memory::PagePool::Backing::Huge);
+
+    Pool.Deallocate(Block);
+}
+
+TEST(PagePoolTest, AllocatorRoutesPages)
+{
+    egg::Memory::PagePool Pool;
+    egg::Memory::PagePoolAllocator<Position> Allocator { Pool };
+
+    constexpr std::size_t PageCount { egg::Memory::PageSize<Position> };
+
+    Position* const Page { Allocator.allocate(PageCount) };
+    Position* const Small { Allocator.allocate(4u) };
+
+    EXPECT_EQ(Pool.GetStatistics().InUse, 1u);
+
+    Allocator.deallocate(Small, 4u);
+    Allocator.deallocate(Page, PageCount);
+
+    EXPECT_EQ(Pool.GetStatistics().InUse, 0u);
+    EXPECT_EQ(Allocator, egg::Memory::PagePoolAllocator<int> { Pool });
+    EXPECT_NE(Allocator, egg::Memory::PagePoolAllocator<int> {});
+}
+
+TEST(PagePoolTest, StorageReusesPages)
+{
+    using AllocatorType = egg::Memory::PagePoolAllocator<Position>;
+
+    egg::Memory::PagePool Pool;
+    egg::ECS::Containers::Storage<Position, EntityType, AllocatorType> Storage { AllocatorType { Pool } };
+
+    const std::size_t Count { PagesCount * egg::Memory::PageSize<Position> };
+    std::size_t Held {};
+
+    for (std::size_t Round = 0u; Round < IterationsCount; ++Round)
+    {
+        for (std::size_t i = 0u; i < Count; ++i)
+        {
+            Storage.Emplace(EntityTraitsType::Construct(i, {}), static_cast<float>(i), 0.0f, 0.0f);
+        }
+
+        EXPECT_GE(Pool.GetStatistics().InUse, PagesCount);
+
+        Storage.Clear();
+        Storage.ShrinkToFit();
+
+        if (!Round)
+        {
+            Held = Pool.GetStatistics().Held;
+        }
+    }
+
+    const egg::Memory::PagePoolStatistics Statistics { Pool.GetStatistics() };
+    EXPECT_EQ(Statistics.Held, Held);
+    EXPECT_GE(Statistics.Reused, (IterationsCount - 1u) * PagesCount);
+}
+
+TEST(PagePoolTest, RegistryChurn)
+{
+    using AllocatorType = egg::Memory::PagePoolAllocator<EntityType>;
+
+    egg::Memory::PagePool Pool;
+    std::size_t Held {};
+
+    for (std::size_t Round = 0u; Round < IterationsCount; ++Round)
+    {
+        egg::ECS::Registry<EntityType, AllocatorType> Registry { AllocatorType { Pool } };
+        std::vector<EntityType> Entities(10'000u);
+
+        Registry.Create(Entities.begin(), Entities.end());
+
+        for (const EntityType Entity : Entities)
+        {
+            Registry.Emplace<Position>(Entity, 1.0f, 2.0f, 3.0f);
+        }
+
+        float Sum {};
+
+        Registry.View<Position>().Each([&Sum](const Position& Current)
+        {
+            Sum += Current.X;
+        });
+
+        EXPECT_FLOAT_EQ(Sum, 10'000.0f);
+        EXPECT_EQ(Registry.GetAllocator().GetPool(), &Pool);
+
+        if (!Round)
+        {
+            Held = Pool.GetStatistics().Held;
+        }
+    }
+
+    const egg::Memory::PagePoolStatistics Statistics { Pool.GetStatistics() };
+    EXPECT_EQ(Statistics.InUse, 0u);
+    EXPECT_EQ(Statistics.Held, Held);
+    EXPECT_GT(Statistics.Reused, 0u);
+}
+
+TEST(PagePoolTest, ConcurrentAllocations)
+{
+    egg::Memory::PagePool Pool;
+    std::vector<std::jthread> Workers;
+
+    for (std::size_t Worker = 0u; Worker < 4u; ++Worker)
+    {
+        Workers.emplace_back([&Pool]
+        {
+            std::vector<void*> Blocks;
+
+            for (std::size_t Round = 0u; Round < 100u; ++Round)
+            {
+                for (std::size_t i = 0u; i < 8u; ++i)
+                {
+                    Blocks.push_back(Pool.Allocate());
+                }
+
+                for (void* const Block : Blocks)
+                {
+                    Pool.Deallocate(Block);
+                }
+
+                Blocks.clear();
+            }
+        });
+    }
+
+    Workers.clear();
+
+    const egg::Memory::PagePoolStatistics Statistics { Pool.GetStatistics() };
+    EXPECT_EQ(Statistics.InUse, 0u);
+    EXPECT_EQ(Statistics.Acquired, 4u * 100u * 8u);
+    EXPECT_LE(Statistics.Held, 4u * 8u);
+}
@@ -0,0 +1,153 @@
+#include "../Single.h"
+
+#include <ECS/Registry.h>
+#include <gtest/gtest.h>
+#include <Memory/FrameArena/ArenaAllocator.h>
+#include <Memory/FrameArena/FrameArena.h>
+#include <Memory/Tracking/AllocationTracker.h>
+#include <Memory/Tracking/TrackingAllocator.h>
+
+#include <cstddef>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    struct Position
+    {
+        float X;
+        float Y;
+    };
+}
+
+TEST(TrackingAllocatorTest, CountsAllocations)
+{
+    egg::Memory::AllocationTracker Tracker;
+
+    {
+        std::vector<int, egg::Memory::TrackingAllocator<int>> Values { egg::Memory::TrackingAllocator<int> { Tracker } };
+        Values.reserve(16u);
+        Values.reserve(64u);
+
+        const egg::Memory::AllocationStatistics Statistics { Tracker.GetStatistics() };
+        EXPECT_EQ(Statistics.Allocations, 2u);
+        EXPECT_EQ(Statistics.Deallocations, 1u);
+        EXPECT_EQ(Statistics.LiveBytes, 64u * sizeof(int));
+        EXPECT_EQ(Statistics.PeakBytes, 80u * sizeof(int));
+    }
+
+    const egg::Memory::AllocationStatistics Statistics { Tracker.GetStatistics() };
+    EXPECT_EQ(Statistics.Deallocations, 2u);
+    EXPECT_EQ(Statistics.LiveBytes, 0u);
+}
+
+TEST(TrackingAllocatorTest, FrameAllocations)
+{
+    egg::Memory::AllocationTracker Tracker;
+    egg::Memory::TrackingAllocator<int> Allocator { Tracker };
+
+    for (std::size_t i = 0u; i < 3u; ++i)
+    {
+        Allocator.deallocate(Allocator.allocate(1u), 1u);
+    }
+
+    EXPECT_EQ(Tracker.GetStatistics().FrameAllocations, 3u);
+
+    Tracker.NextFrame();
+    Allocator.deallocate(Allocator.allocate(1u), 1u);
+
+    const egg::Memory::AllocationStatistics Statistics { Tracker.GetStatistics() };
+    EXPECT_EQ(Statistics.FrameAllocations, 1u);
+    EXPECT_EQ(Statistics.LastFrameAllocations, 3u);
+    EXPECT_EQ(Statistics.Allocations, 4u);
+
+    Tracker.Reset();
+    EXPECT_EQ(Tracker.GetStatistics().Allocations, 0u);
+}
+
+TEST(TrackingAllocatorTest, Rebind)
+{
+    egg::Memory::AllocationTracker Tracker;
+    egg::Memory::FrameArena Arena;
+
+    using AllocatorType = egg::Memory::TrackingAllocator<int, egg::Memory::ArenaAllocator<int>>;
+    using ReboundType = std::allocator_traits<AllocatorType>::rebind_alloc<Position>;
+
+    static_assert(std::is_same_v<ReboundType, egg::Memory::TrackingAllocator<Position, egg::Memory::ArenaAllocator<Position>>>);
+
+    const AllocatorType Allocator { Tracker, egg::Memory::ArenaAllocator<int> { Arena } };
+    ReboundType Rebound { Allocator };
+
+    Position* const Pointer { Rebound.allocate(4u) };
+
+    EXPECT_EQ(Rebound.GetUpstream().GetArena(), &Arena);
+    EXPECT_EQ(Tracker.GetStatistics().LiveBytes, 4u * sizeof(Position));
+    EXPECT_GE(Arena.GetUsed(), 4u * sizeof(Position));
+    EXPECT_EQ(Rebound, Allocator);
+    EXPECT_NE(Rebound, (ReboundType { Tracker, egg::Memory::ArenaAllocator<Position> {} }));
+
+    Rebound.deallocate(Pointer, 4u);
+}
+
+TEST(TrackingAllocatorTest, Registry)
+{
+    using AllocatorType = egg::Memory::TrackingAllocator<EntityType>;
+
+    egg::Memory::AllocationTracker Tracker;
+
+    {
+        egg::ECS::Registry<EntityType, AllocatorType> Registry { AllocatorType { Tracker } };
+        std::vector<EntityType> Entities(1'000u);
+
+        Registry.Create(Entities.begin(), Entities.end());
+
+        for (const EntityType Entity : Entities)
+        {
+            Registry.Emplace<Position>(Entity, 0.0f, 0.0f);
+        }
+
+        Tracker.NextFrame();
+
+        for (const EntityType Entity : Entities)
+        {
+            Registry.Get<Position>(Entity).X += 1.0f;
+        }
+
+        Tracker.NextFrame();
+
+        const egg::Memory::AllocationStatistics Statistics { Tracker.GetStatistics() };
+        EXPECT_GT(Statistics.Allocations, 0u);
+        EXPECT_EQ(Statistics.LastFrameAllocations, 0u);
+        EXPECT_GE(Statistics.LiveBytes, Registry.MemoryReport().front().Bytes);
+    }
+
+    EXPECT_EQ(Tracker.GetStatistics().LiveBytes, 0u);
+}
+
+TEST(TrackingAllocatorTest, ConcurrentRecords)
+{
+    egg::Memory::AllocationTracker Tracker;
+    std::vector<std::jthread> Workers;
+
+    for (std::size_t Worker = 0u; Worker < 4u; ++Worker)
+    {
+        Workers.emplace_back([&Tracker]
+        {
+            egg::Memory::TrackingAllocator<int> Allocator { Tracker };
+
+            for (std::size_t i = 0u; i < 1'000u; ++i)
+            {
+                Allocator.deallocate(Allocator.allocate(8u), 8u);
+            }
+        });
+    }
+
+    Workers.clear();
+
+    const egg::Memory::AllocationStatistics Statistics { Tracker.GetStatistics() };
+    EXPECT_EQ(Statistics.Allocations, 4'000u);
+    EXPECT_EQ(Statistics.Deallocations, 4'000u);
+    EXPECT_EQ(Statistics.LiveBytes, 0u);
+    EXPECT_GE(Statistics.PeakBytes, 8u * sizeof(int));
+}